@@ -37,22 +37,50 @@ bool Asset::ready() const noexcept
 	if (!(m_finalized.load()))
 		return false;
 
-	// Check if we have a fence
-	if (m_fence != nullptr) {
-		// Check if the fence has passed
-		const GLenum state = glClientWaitSync(m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
-		if (state != GL_SIGNALED && state != GL_ALREADY_SIGNALED && state != GL_CONDITION_SATISFIED)
+	// Check if we have a fence, it is only ever used or deleted while holding the lock
+	if (m_fence.load() != nullptr) {
+		// Another thread may be waiting on the fence, report not ready rather than block
+		const std::unique_lock<std::mutex> fenceGuard(m_mutexFinalized, std::try_to_lock);
+		if (!fenceGuard.owns_lock())
 			return false;
-		// Delete fence so we can skip these 2 branches next time
-		glDeleteSync(m_fence);
-		m_fence = nullptr;
+		if (const auto fence = m_fence.load()) {
+			// Check if the fence has passed
+			const GLenum state = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+			if (state != GL_SIGNALED && state != GL_ALREADY_SIGNALED && state != GL_CONDITION_SATISFIED)
+				return false;
+			// Delete fence so we can skip these branches next time
+			glDeleteSync(fence);
+			m_fence = nullptr;
+		}
 	}
 	return true;
 }
 
+void Asset::waitReady() const
+{
+	std::unique_lock<std::mutex> finalizedGuard(m_mutexFinalized);
+	m_finalizedSignal.wait(finalizedGuard, [&] { return m_finalized.load(); });
+
+	// Sleep on the fence rather than polling it, giving up only if the wait itself fails
+	// The lock is kept throughout, so no other thread can delete the fence mid-wait
+	if (const auto fence = m_fence.load()) {
+		while (glClientWaitSync(fence, 0, ASSET_FENCE_TIMEOUT) == GL_TIMEOUT_EXPIRED)
+			continue;
+		glDeleteSync(fence);
+		m_fence = nullptr;
+	}
+}
+
 void Asset::finalize()
 {
-	m_finalized = true;
+	{
+		// Flush so that other contexts waiting on the fence will see it signal
+		std::unique_lock<std::mutex> finalizedGuard(m_mutexFinalized);
+		if (m_fence.load() != nullptr)
+			glFlush();
+		m_finalized = true;
+	}
+	m_finalizedSignal.notify_all();
 
 	// Copy callbacks in case any get added while we're busy
 	const auto copyCallbacks = m_callbacks;
@@ -3,8 +3,10 @@
 #define	ASSET_H
 
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -18,6 +20,17 @@ class Engine;
 using Shared_Asset = std::shared_ptr<Asset>;
 using AssetFinalizedCallback = std::function<void(void)>;
 
+/** Scheduling classes for asset work orders, where higher classes are always started first. */
+enum class Asset_Priority {
+	HIGH,
+	NORMAL,
+	LOW,
+	INHERIT // Use the class of the work order running on this thread, or NORMAL if none
+};
+constexpr size_t ASSET_PRIORITY_COUNT = 3ULL;
+/** The longest a thread sleeps on an asset's fence at once, in nanoseconds. */
+constexpr GLuint64 ASSET_FENCE_TIMEOUT = 1'000'000ULL;
+
 /** An abstract base-class for assets.
 Represents some form of data to be loaded from disk, such as shaders, models, levels, and sounds.
 @note	is an abstract class instead of interface to reduce redundant code.
@@ -43,6 +56,8 @@ public:
 	/** Retrieves whether or not this asset has completed finalizing.
 	@return				true if this asset has finished finalizing, false otherwise. */
 	bool ready() const noexcept;
+	/** Block until this asset has completed finalizing, and any GPU commands it issued have completed. */
+	void waitReady() const;
 	/** Check if an input variadic list of shared assets have all completed finalizing.
 	@tparam	<>			variadic list of assets to check (auto-deducible).
 	@param	firstAsset	the first value to check.
@@ -85,8 +100,11 @@ protected:
 
 	// Protected Attributes
 	Engine& m_engine;
+	std::atomic_bool m_started = false;
 	std::atomic_bool m_finalized = false;
-	mutable GLsync m_fence = nullptr;
+	mutable std::mutex m_mutexFinalized;
+	mutable std::condition_variable m_finalizedSignal;
+	mutable std::atomic<GLsync> m_fence = nullptr;
 	std::string m_filename = "";
 	std::vector<std::pair<std::shared_ptr<bool>, std::function<void()>>> m_callbacks;
 
@@ -69,7 +69,7 @@ void Config::initialize()
 		}
 	}
 	catch (const std::ifstream::failure&) {
-		m_engine.getManager_Messages().error("Config \"" + m_filename + "\" failed to initialize.");
+		m_engine.getManager_Messages().error("Config \"" + m_filename + "\" failed to initialize.", Message_Category::ASSETS);
 	}
 
 	Asset::finalize();
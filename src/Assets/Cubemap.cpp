@@ -65,7 +65,7 @@ void Cubemap::initialize()
 	glTextureParameteri(m_glTexID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	glTextureParameteri(m_glTexID, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 	if (!glIsTexture(m_glTexID))
-		m_engine.getManager_Messages().error("Texture \"" + m_filename + "\" failed to initialize.");
+		m_engine.getManager_Messages().error("Texture \"" + m_filename + "\" failed to initialize.", Message_Category::ASSETS);
 
 	// Finalize
 	m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
@@ -1,5 +1,6 @@
 #include "Assets/Material.h"
 #include "Engine.h"
+#include <algorithm>
 #include <fstream>
 
 
@@ -57,9 +58,21 @@ void Material::initialize()
 
 	// Load all images
 	float materialSize = 512.0F;
+	bool compressed = false;
 	m_engine.getPreferenceState().getOrSetValue(PreferenceState::Preference::C_MATERIAL_SIZE, materialSize);
-	m_images.resize(textureCount);
+	m_engine.getPreferenceState().getOrSetValue(PreferenceState::Preference::C_MATERIAL_COMPRESSION, compressed);
 	m_size = glm::ivec2(static_cast<int>(materialSize));
+
+	// Skip decoding entirely if the packed textures are already cached
+	m_materialData.dimensions = m_size;
+	m_materialData.layers = static_cast<unsigned int>(materialCount * MAX_DIGITAL_IMAGES);
+	m_materialData.format = compressed ? Texture_Format::BC3 : Texture_Format::RGBA8;
+	if (Image_IO::Import_Texture_Cache(getFileName(), m_textures, m_materialData)) {
+		Asset::finalize();
+		return;
+	}
+
+	m_images.resize(textureCount);
 	constexpr Fill_Policy fillPolicies[MAX_PHYSICAL_IMAGES] = {
 		Fill_Policy::CHECKERED,
 		Fill_Policy::SOLID,
@@ -68,26 +81,35 @@ void Material::initialize()
 		Fill_Policy::SOLID,
 		Fill_Policy::SOLID
 	};
+	// Spread the images across the loader threads, helping out until they're all ready
 	for (size_t x = 0; x < textureCount; ++x)
-		m_images[x] = Shared_Image(m_engine, m_textures[x], m_size, false, fillPolicies[x]);
+		m_images[x] = Shared_Image(m_engine, m_textures[x], m_size, true, fillPolicies[x % MAX_PHYSICAL_IMAGES]);
+	auto& assetManager = m_engine.getManager_Assets();
+	for (const auto& image : m_images)
+		assetManager.waitForAsset(image);
 
 	// Merge data into single array
 	const size_t pixelsPerImage = size_t(m_size.x) * size_t(m_size.y) * 4ULL;
-	m_materialData.resize((pixelsPerImage)*MAX_DIGITAL_IMAGES * materialCount);
+	auto& pixelData = m_materialData.pixelData;
+	pixelData.resize((pixelsPerImage)*MAX_DIGITAL_IMAGES * materialCount);
 	size_t arrayIndex = 0;
 	for (size_t tx = 0; tx < textureCount; tx += MAX_PHYSICAL_IMAGES) {
-		for (size_t x = 0; x < pixelsPerImage; ++x, ++arrayIndex)
-			m_materialData[arrayIndex] = m_images[tx + 0]->m_pixelData[x]; // ALBEDO
-		for (size_t x = 0; x < pixelsPerImage; ++x, ++arrayIndex)
-			m_materialData[arrayIndex] = m_images[tx + 1]->m_pixelData[x]; // NORMAL
+		std::copy_n(m_images[tx + 0]->m_pixelData.cbegin(), pixelsPerImage, pixelData.begin() + arrayIndex); // ALBEDO
+		arrayIndex += pixelsPerImage;
+		std::copy_n(m_images[tx + 1]->m_pixelData.cbegin(), pixelsPerImage, pixelData.begin() + arrayIndex); // NORMAL
+		arrayIndex += pixelsPerImage;
 		for (size_t x = 0; x < pixelsPerImage; x += 4, arrayIndex += 4) {
-			m_materialData[arrayIndex + 0] = m_images[tx + 2]->m_pixelData[x]; // METALNESS
-			m_materialData[arrayIndex + 1] = m_images[tx + 3]->m_pixelData[x]; // ROUGHNESS
-			m_materialData[arrayIndex + 2] = m_images[tx + 4]->m_pixelData[x]; // HEIGHT
-			m_materialData[arrayIndex + 3] = m_images[tx + 5]->m_pixelData[x]; // AO
+			pixelData[arrayIndex + 0] = m_images[tx + 2]->m_pixelData[x]; // METALNESS
+			pixelData[arrayIndex + 1] = m_images[tx + 3]->m_pixelData[x]; // ROUGHNESS
+			pixelData[arrayIndex + 2] = m_images[tx + 4]->m_pixelData[x]; // HEIGHT
+			pixelData[arrayIndex + 3] = m_images[tx + 5]->m_pixelData[x]; // AO
 		}
 	}
 
+	// Generate the mip chain here rather than on the GPU, and cache it for next time
+	Image_IO::Generate_Mipmaps(m_materialData, m_materialData.format);
+	Image_IO::Export_Texture_Cache(getFileName(), m_textures, m_materialData);
+
 	// Finalize
 	Asset::finalize();
 }
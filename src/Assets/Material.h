@@ -38,6 +38,7 @@ A material is a collection of textures that are used to approximate a real surfa
 	- occlusion
 @note	supports omission of any or all of the files.
 @note	expects all textures in a material to be the same dimension, and will forcefully resize them (in memory).
+@note	packs its textures into a full mip chain, cached on disk so later runs skip decoding the source images.
 @note	can contain multiple sets of these textures, where each set of 6 form 1 skin for an object.
 @note	owns many Shared_Image objects. */
 class Material final : public Asset {
@@ -59,7 +60,7 @@ public:
 
 
 	// Public Attributes
-	std::vector<GLubyte> m_materialData;
+	Texture_Data m_materialData;
 	glm::ivec2 m_size = glm::ivec2(1);
 	std::vector<std::string> m_textures;
 	std::vector<Shared_Image> m_images;
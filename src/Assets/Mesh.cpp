@@ -1,26 +1,30 @@
 #include "Assets/Mesh.h"
 #include "Utilities/IO/Mesh_IO.h"
+#include "Utilities/IO/Skeleton_Pose.h"
 #include "Engine.h"
 #include "glm/glm.hpp"
 #include "glm/geometric.hpp"
 
 
-Shared_Mesh::Shared_Mesh(Engine& engine, const std::string& filename, const bool& threaded)
+constexpr const char* INDEXED_MESH_TYPE = "Indexed Mesh";
+
+Shared_Mesh::Shared_Mesh(Engine& engine, const std::string& filename, const bool& threaded, const bool& indexed)
 {
+	// Indexed and flat meshes of the same file are kept apart
 	auto newAsset = std::dynamic_pointer_cast<Mesh>(engine.getManager_Assets().shareAsset(
-			typeid(Mesh).name(),
+			indexed ? INDEXED_MESH_TYPE : typeid(Mesh).name(),
 			filename,
-			[&engine, filename]() { return std::make_shared<Mesh>(engine, filename); },
+			[&engine, filename, indexed]() { return std::make_shared<Mesh>(engine, filename, indexed); },
 			threaded
 		));
 	swap(newAsset);
 }
 
-Mesh::Mesh(Engine& engine, const std::string& filename) : Asset(engine, filename) {}
+Mesh::Mesh(Engine& engine, const std::string& filename, const bool& indexed) : Asset(engine, filename), m_indexed(indexed) {}
 
 void Mesh::initialize()
 {
-	if (!Mesh_IO::Import_Model(m_engine, getFileName(), m_geometry)) {
+	if (!Mesh_IO::Import_Model(m_engine, getFileName(), m_geometry, m_indexed)) {
 		// Create hard-coded alternative
 		m_geometry.vertices = { glm::vec3(-1, -1, 0), glm::vec3(1, -1, 0), glm::vec3(1, 1, 0),glm::vec3(-1, -1, 0), glm::vec3(1, 1, 0), glm::vec3(-1, 1, 0) };
 		m_geometry.normals = { glm::vec3(1, 0, 0),  glm::vec3(1, 0, 0),  glm::vec3(1, 0, 0),  glm::vec3(1, 0, 0),  glm::vec3(1, 0, 0),  glm::vec3(1, 0, 0) };
@@ -30,7 +34,10 @@ void Mesh::initialize()
 		m_geometry.materialIndices = { 0U, 0U, 0U, 0U, 0U, 0U };
 		m_geometry.bones.resize(m_geometry.vertices.size());
 		m_geometry.materials.emplace_back(Material_Strings{});
+		if (m_indexed)
+			m_geometry.indices = { 0U, 1U, 2U, 3U, 4U, 5U };
 	}
+	Skeleton_Pose::Bind(m_geometry);
 
 	Asset::finalize();
 }
\ No newline at end of file
@@ -20,8 +20,9 @@ public:
 	@param	engine			reference to the engine to use.
 	@param	filename		the filename to use.
 	@param	threaded		create in a separate thread.
+	@param	indexed			import welded vertices and an index list, instead of a flat triangle list.
 	@return					the desired asset. */
-	explicit Shared_Mesh(Engine& engine, const std::string& filename, const bool& threaded = true);
+	explicit Shared_Mesh(Engine& engine, const std::string& filename, const bool& threaded = true, const bool& indexed = false);
 };
 
 
@@ -32,8 +33,9 @@ public:
 	// Public (De)Constructors
 	/** Construct the Mesh.
 	@param	engine		reference to the engine to use.
-	@param	filename	the asset file name (relative to engine directory). */
-	Mesh(Engine& engine, const std::string& filename);
+	@param	filename	the asset file name (relative to engine directory).
+	@param	indexed		import welded vertices and an index list, instead of a flat triangle list. */
+	Mesh(Engine& engine, const std::string& filename, const bool& indexed = false);
 
 
 	// Public Attributes
@@ -46,6 +48,7 @@ private:
 
 
 	// Private Attributes
+	bool m_indexed = false;
 	friend class Shared_Mesh;
 };
 
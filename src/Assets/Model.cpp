@@ -5,13 +5,14 @@
 
 constexpr const char* DIRECTORY_MODEL = "\\Models\\";
 
-Shared_Model::Shared_Model(Engine& engine, const std::string& filename, const bool& threaded)
+Shared_Model::Shared_Model(Engine& engine, const std::string& filename, const bool& threaded, const Asset_Priority& priority)
 {
 	auto newAsset = std::dynamic_pointer_cast<Model>(engine.getManager_Assets().shareAsset(
 			typeid(Model).name(),
 			filename,
 			[&engine, filename]() { return std::make_shared<Model>(engine, filename); },
-			threaded
+			threaded,
+			priority
 		));
 	swap(newAsset);
 }
@@ -21,7 +22,7 @@ Model::Model(Engine& engine, const std::string& filename) : Asset(engine, filena
 void Model::initialize()
 {
 	// Forward asset creation
-	m_mesh = Shared_Mesh(m_engine, DIRECTORY_MODEL + getFileName(), false);
+	m_mesh = Shared_Mesh(m_engine, DIRECTORY_MODEL + getFileName(), false, true);
 
 	// Generate all the required skins
 	loadMaterial(DIRECTORY_MODEL + getFileName(), m_materialArray, m_mesh->m_geometry.materials);
@@ -44,6 +45,16 @@ void Model::initialize()
 		m_data.m_vertices[x].weights.w = m_mesh->m_geometry.bones[x].Weights[3];
 		m_data.m_vertices[x].matID = (m_mesh->m_geometry.materialIndices[x] * 3);
 	}
+	// Append each level of detail's indices after the full mesh's, so they upload as one range
+	m_data.m_indices = m_mesh->m_geometry.indices;
+	m_data.m_lods.clear();
+	if (!m_data.m_indices.empty()) {
+		m_data.m_lods.push_back({ 0ULL, m_data.m_indices.size(), 0.0F });
+		for (const auto& lod : m_mesh->m_geometry.lods) {
+			m_data.m_lods.push_back({ m_data.m_indices.size(), lod.indices.size(), lod.error });
+			m_data.m_indices.insert(m_data.m_indices.end(), lod.indices.cbegin(), lod.indices.cend());
+		}
+	}
 
 	// Calculate the mesh's min, max, center, and radius
 	calculateAABB(m_data.m_vertices, m_bboxMin, m_bboxMax, m_bboxScale, m_bboxCenter, m_radius);
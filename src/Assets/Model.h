@@ -21,8 +21,9 @@ public:
 	@param	engine			reference to the engine to use.
 	@param	filename		the filename to use.
 	@param	threaded		create in a separate thread.
+	@param	priority		the loading priority to use if threaded.
 	@return					the desired asset. */
-	explicit Shared_Model(Engine& engine, const std::string& filename, const bool& threaded = true);
+	explicit Shared_Model(Engine& engine, const std::string& filename, const bool& threaded = true, const Asset_Priority& priority = Asset_Priority::INHERIT);
 };
 
 /** A 3D mesh formated for model rendering.
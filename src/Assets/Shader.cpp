@@ -60,7 +60,7 @@ void Shader::initialize()
 		// If we ever failed, initialize default shader
 		if (!success) {
 			const std::vector<GLchar> infoLog = getErrorLog();
-			m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to initialize. Reason: " + std::string(infoLog.data(), infoLog.size()));
+			m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to initialize. Reason: " + std::string(infoLog.data(), infoLog.size()), Message_Category::ASSETS);
 
 			// Create hard-coded alternative
 			const std::string filename = getFileName();
@@ -125,7 +125,7 @@ bool Shader::loadCachedBinary(const std::string& relativePath)
 	ShaderHeader header{};
 	std::ifstream file((Engine::Get_Current_Dir() + relativePath + EXT_SHADER_BINARY).c_str(), std::ios::binary | std::ios::in | std::ios::beg);
 	if (!file.is_open()) {
-		m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to open binary cache.");
+		m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to open binary cache.", Message_Category::ASSETS);
 		deleteCachedBinary(relativePath);
 		return false;
 	}
@@ -138,7 +138,7 @@ bool Shader::loadCachedBinary(const std::string& relativePath)
 	glProgramBinary(m_glProgramID, header.format, binary.data(), header.length);
 	if (getProgramiv(GL_LINK_STATUS) == 0) {
 		const auto infoLog = getErrorLog();
-		m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to use binary cache. Reason:\n" + std::string(infoLog.data(), infoLog.size()));
+		m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to use binary cache. Reason:\n" + std::string(infoLog.data(), infoLog.size()), Message_Category::ASSETS);
 		deleteCachedBinary(relativePath);
 		return false;
 	}
@@ -160,7 +160,7 @@ bool Shader::saveCachedBinary(const std::string& relativePath)
 	std::filesystem::create_directories(std::filesystem::path(fullPath).parent_path());
 	std::ofstream file(fullPath, std::ios::binary);
 	if (!file.is_open()) {
-		m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to write to binary cache.");
+		m_engine.getManager_Messages().error("Shader \"" + m_filename + "\" failed to write to binary cache.", Message_Category::ASSETS);
 		return false;
 	}
 
@@ -286,7 +286,7 @@ bool ShaderObj::createGLShader(Engine& engine, const std::string& filename)
 		// Report any errors
 		std::vector<GLchar> infoLog(getShaderiv(GL_INFO_LOG_LENGTH));
 		glGetShaderInfoLog(m_shaderID, static_cast<GLsizei>(infoLog.size()), nullptr, &infoLog[0]);
-		engine.getManager_Messages().error("ShaderObj \"" + filename + "\" failed to compile. Reason:\n" + std::string(infoLog.data(), infoLog.size()));
+		engine.getManager_Messages().error("ShaderObj \"" + filename + "\" failed to compile. Reason:\n" + std::string(infoLog.data(), infoLog.size()), Message_Category::ASSETS);
 		return false;
 	}
 
@@ -56,7 +56,7 @@ void Shader_Pkg::initialize()
 	const bool found = Text_IO::Import_Text(m_engine, DIRECTORY_SHADER_PKG + getFileName() + EXT_PACKAGE, m_packageText);
 
 	if (!found)
-		m_engine.getManager_Messages().error("Shader_Pkg \"" + m_filename + "\" file does not exist");
+		m_engine.getManager_Messages().error("Shader_Pkg \"" + m_filename + "\" file does not exist", Message_Category::ASSETS);
 
 	// parse
 	parse(m_engine, *this);
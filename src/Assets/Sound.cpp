@@ -35,18 +35,18 @@ void Sound::initialize()
 		// No error
 		break;
 	case SoLoud::INVALID_PARAMETER:
-		msgMgr.error("Sound \"" + m_filename + "\" has an invalid parameter.");
+		msgMgr.error("Sound \"" + m_filename + "\" has an invalid parameter.", Message_Category::ASSETS);
 		break;
 	case SoLoud::FILE_NOT_FOUND:
-		msgMgr.error("Sound \"" + m_filename + "\" file does not exist.");
+		msgMgr.error("Sound \"" + m_filename + "\" file does not exist.", Message_Category::ASSETS);
 		break;
 	case SoLoud::FILE_LOAD_FAILED:
-		msgMgr.error("Sound \"" + m_filename + "\" file exists, but could not be loaded.");
+		msgMgr.error("Sound \"" + m_filename + "\" file exists, but could not be loaded.", Message_Category::ASSETS);
 		break;
 	case SoLoud::UNKNOWN_ERROR:
 		[[fallthrough]];
 	default:
-		msgMgr.error("Sound \"" + m_filename + "\" has encountered an unknown error.");
+		msgMgr.error("Sound \"" + m_filename + "\" has encountered an unknown error.", Message_Category::ASSETS);
 		break;
 	};
 	m_soundObj = reinterpret_cast<SoundObj*>(wave);
@@ -6,10 +6,13 @@
 // Importers Used //
 #include "Utilities/IO/Image_IO.h"
 #include "Utilities/IO/Mesh_IO.h"
+#include "Utilities/GL/GL_Fence.h"
+#include "Utilities/Profiler.h"
 
 
 Engine::~Engine()
 {
+	m_assetManager.shutdown();
 	m_modulePhysics.deinitialize();
 	m_moduleUI.deinitialize();
 	m_moduleGraphics.deinitialize();
@@ -17,6 +20,7 @@ Engine::~Engine()
 	m_moduleGame.deinitialize();
 	m_moduleStartScreen.deinitialize();
 	m_moduleECS.deinitialize();
+	GL_Fence::Get_Frame_Sync().reset();
 
 	Image_IO::Deinitialize();
 	m_messageManager.statement("Shutting down...");
@@ -35,6 +39,8 @@ Engine::Engine() noexcept :
 	m_moduleUI(*this),
 	m_modulePhysics(*this)
 {
+	m_messageManager.setLogFile(Get_Current_Dir() + "\\log.txt");
+	Profiler::Set_Thread_Name("Main Thread");
 	Image_IO::Initialize();
 	m_inputBindings.loadFile("binds");
 
@@ -83,6 +89,11 @@ void Engine::printBoilerPlate()
 
 void Engine::tick()
 {
+	// Summarize the previous frame's zones before starting this one
+	Profiler::New_Frame();
+	PROFILE_ZONE("Engine", "Engine::tick");
+	auto& frameSync = GL_Fence::Get_Frame_Sync();
+	frameSync.beginFrame();
 	const float thisTime = GetSystemTime();
 	const float deltaTime = thisTime - m_lastTime;
 	m_lastTime = thisTime;
@@ -101,15 +112,18 @@ void Engine::tick()
 	m_moduleUI.frameTick(deltaTime);
 
 	m_window.swapBuffers();
+	frameSync.endFrame();
 }
 
 void Engine::tickThreaded(std::future<void> exitObject, GLFWwindow* const auxContext)
 {
 	Window::MakeCurrent(auxContext);
+	Profiler::Set_Thread_Name("Asset Loader");
 
-	// Check if thread should shutdown
-	while (exitObject.wait_for(std::chrono::milliseconds(1)) == std::future_status::timeout)
-		m_assetManager.beginWorkOrder();
+	// Sleep until work arrives, stopping once the thread should shutdown
+	while (exitObject.wait_for(std::chrono::milliseconds(0)) == std::future_status::timeout)
+		if (!m_assetManager.beginWorkOrder())
+			break;
 }
 
 bool Engine::shouldClose() const noexcept
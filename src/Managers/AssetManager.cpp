@@ -1,10 +1,22 @@
 #include "Managers/AssetManager.h"
+#include "Utilities/Profiler.h"
 #include <algorithm>
-#include <chrono>
 #include <thread>
 
 
-Shared_Asset AssetManager::shareAsset(const char* assetType, const std::string& filename, const std::function<Shared_Asset(void)>& constructor, const bool& threaded)
+/** The work queue owned by the calling thread, or -1 if it isn't a loader thread. */
+static thread_local int t_queueIndex = -1;
+/** The priority class of the work order running on the calling thread. */
+static thread_local Asset_Priority t_priority = Asset_Priority::NORMAL;
+/** The number of asset waits on the calling thread's stack that are helping with other work orders. */
+static thread_local int t_helpDepth = 0;
+
+AssetManager::AssetManager() :
+	m_queues(std::clamp(std::thread::hardware_concurrency(), 1U, ASSETMANAGER_MAX_THREADS))
+{
+}
+
+Shared_Asset AssetManager::shareAsset(const char* assetType, const std::string& filename, const std::function<Shared_Asset(void)>& constructor, const bool& threaded, const Asset_Priority& priority)
 {
 	// Find out if the asset already exists
 	std::shared_lock<std::shared_mutex> asset_read_guard(m_mutexAssets);
@@ -15,8 +27,7 @@ Shared_Asset AssetManager::shareAsset(const char* assetType, const std::string&
 			// Check if we need to wait for initialization
 			if (!threaded)
 				// Stay here until asset finalizes
-				while (!asset->ready())
-					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				waitForAsset(asset);
 			return asset;
 		}
 	asset_read_guard.unlock();
@@ -30,29 +41,77 @@ Shared_Asset AssetManager::shareAsset(const char* assetType, const std::string&
 	asset_write_guard.release();
 
 	// Initialize now or later, depending if we are threading this order or not
-	if (threaded) {
-		std::unique_lock<std::shared_mutex> worker_write_guard(m_mutexWorkorders);
-		m_workOrders.emplace_back(std::bind(&Asset::initialize, asset));
-	}
+	if (threaded)
+		pushWorkOrder([asset] { tryInitialize(asset); }, priority);
 	else
-		asset->initialize();
+		tryInitialize(asset);
 	return asset;
 }
 
-void AssetManager::beginWorkOrder()
+std::future<void> AssetManager::submitWorkOrder(const Asset_Work_Order& workOrder, const Asset_Priority& priority)
 {
-	// Start reading work orders
-	std::unique_lock<std::shared_mutex> writeGuard(m_mutexWorkorders);
-	if (!m_workOrders.empty()) {
-		// Remove front of queue
-		const Asset_Work_Order workOrder = m_workOrders.front();
-		m_workOrders.pop_front();
-		writeGuard.unlock();
-		writeGuard.release();
-
-		// Initialize asset
-		workOrder();
+	// Wrap the order in a shared task, as work orders must be copyable
+	auto task = std::make_shared<std::packaged_task<void()>>(workOrder);
+	auto future = task->get_future();
+	pushWorkOrder([task] { (*task)(); }, priority);
+	return future;
+}
+
+void AssetManager::prioritize(const Shared_Asset& asset)
+{
+	// The original order becomes a no-op once either copy starts the asset
+	if (asset && !asset->m_started)
+		pushWorkOrder([asset] { tryInitialize(asset); }, Asset_Priority::HIGH);
+}
+
+void AssetManager::waitForAsset(const Shared_Asset& asset)
+{
+	// Initialize the asset on this thread if nobody has started it yet
+	if (!asset || tryInitialize(asset))
+		return;
+
+	// Otherwise help with other work orders until it finalizes, so loader threads never wait on each other's queues
+	// Those orders may wait on assets of their own, so stop nesting past a few levels rather than growing the stack
+	if (t_helpDepth < ASSETMANAGER_MAX_HELP_DEPTH) {
+		++t_helpDepth;
+		while (!asset->m_finalized && tryWorkOrder())
+			continue;
+		--t_helpDepth;
+	}
+
+	// Sleep until it finalizes, as finalized assets may still have GPU commands in flight
+	asset->waitReady();
+}
+
+bool AssetManager::beginWorkOrder()
+{
+	// Assign each loader thread its own queue
+	if (t_queueIndex < 0)
+		t_queueIndex = static_cast<int>(m_workerCount++ % m_queues.size());
+
+	// Sleep until there is work to do
+	{
+		std::unique_lock<std::mutex> signalGuard(m_mutexSignal);
+		m_signal.wait(signalGuard, [&] { return m_pendingOrders > 0ULL || !m_running; });
+		if (!m_running)
+			return false;
+	}
+	tryWorkOrder();
+	return true;
+}
+
+void AssetManager::shutdown()
+{
+	{
+		std::unique_lock<std::mutex> signalGuard(m_mutexSignal);
+		m_running = false;
 	}
+	m_signal.notify_all();
+}
+
+unsigned int AssetManager::getThreadCount() const noexcept
+{
+	return static_cast<unsigned int>(m_queues.size());
 }
 
 void AssetManager::submitNotifyee(const std::pair<std::shared_ptr<bool>, std::function<void()>>& callBack)
@@ -77,11 +136,8 @@ void AssetManager::notifyObservers()
 
 bool AssetManager::readyToUse()
 {
-	{
-		std::shared_lock<std::shared_mutex> readGuard(m_mutexWorkorders);
-		if (!m_workOrders.empty())
-			return false;
-	}
+	if (m_pendingOrders > 0ULL)
+		return false;
 	{
 		std::shared_lock<std::shared_mutex> readGuard(m_mutexAssets);
 		return std::all_of(m_assetMap.begin(), m_assetMap.end(), [](const auto& assetCategory) {
@@ -99,4 +155,73 @@ bool AssetManager::hasChanged()
 	const bool state = m_changed;
 	m_changed = false;
 	return state;
+}
+
+void AssetManager::pushWorkOrder(Asset_Work_Order&& workOrder, const Asset_Priority& priority)
+{
+	const auto priorityClass = priority == Asset_Priority::INHERIT ? t_priority : priority;
+
+	// Loader threads keep their own orders local, everyone else spreads them across the queues
+	const auto queueIndex = t_queueIndex >= 0
+		? static_cast<size_t>(t_queueIndex)
+		: static_cast<size_t>(m_nextQueue++) % m_queues.size();
+	auto& queue = m_queues[queueIndex];
+	{
+		// Count the order while its queue is locked, so it can't be popped before being counted
+		std::unique_lock<std::mutex> queueGuard(queue.m_mutex);
+		queue.m_orders[static_cast<size_t>(priorityClass)].emplace_back(std::move(workOrder));
+		++m_pendingOrders;
+	}
+	{
+		std::unique_lock<std::mutex> signalGuard(m_mutexSignal);
+	}
+	m_signal.notify_one();
+}
+
+bool AssetManager::tryWorkOrder()
+{
+	// Visit every priority class before moving to the next, starting with our own queue then stealing from the others
+	const auto ownIndex = t_queueIndex >= 0 ? static_cast<size_t>(t_queueIndex) : 0ULL;
+	for (size_t priorityClass = 0ULL; priorityClass < ASSET_PRIORITY_COUNT; ++priorityClass) {
+		const auto queueCount = m_queues.size();
+		for (size_t x = 0ULL; x < queueCount; ++x) {
+			auto& queue = m_queues[(ownIndex + x) % queueCount];
+			std::unique_lock<std::mutex> queueGuard(queue.m_mutex);
+			auto& orders = queue.m_orders[priorityClass];
+			if (orders.empty())
+				continue;
+
+			// Owners take the oldest order, thieves take the newest
+			Asset_Work_Order workOrder;
+			if (x == 0ULL) {
+				workOrder = std::move(orders.front());
+				orders.pop_front();
+			}
+			else {
+				workOrder = std::move(orders.back());
+				orders.pop_back();
+			}
+			--m_pendingOrders;
+			queueGuard.unlock();
+
+			// Nested orders submitted from here inherit this order's priority
+			const auto previousPriority = t_priority;
+			t_priority = static_cast<Asset_Priority>(priorityClass);
+			{
+				PROFILE_ZONE("Asset", "AssetManager::workOrder");
+				workOrder();
+			}
+			t_priority = previousPriority;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool AssetManager::tryInitialize(const Shared_Asset& asset)
+{
+	if (asset->m_started.exchange(true))
+		return false;
+	asset->initialize();
+	return true;
 }
\ No newline at end of file
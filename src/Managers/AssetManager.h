@@ -4,26 +4,58 @@
 
 #include "Assets/Asset.h"
 #include "Utilities/MappedChar.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <deque>
+#include <future>
+#include <mutex>
 #include <shared_mutex>
+#include <vector>
 
 
 constexpr unsigned int ASSETMANAGER_MAX_THREADS = 8u;
+/** How many asset waits deep a thread may help with other work orders, before blocking instead. */
+constexpr int ASSETMANAGER_MAX_HELP_DEPTH = 4;
 using Asset_Work_Order = std::function<void(void)>;
 
 /** Manages the storage and retrieval of assets. */
 class AssetManager {
 public:
+	// Public (De)Constructors
+	/** Construct an asset manager, with a work queue for each loader thread the hardware supports. */
+	AssetManager();
+
+
 	// Public Methods
 	/** Checks if an asset already exists with the given filename, fetching if true.
 	@param	assetType			the name of the asset type to search for.
 	@param	filename			the relative filename (within the project directory) of the asset to search for.
 	@param	constructor			a construction method, for creating the asset should it be needed.
 	@param	threaded			flag to create in a separate thread.
+	@param	priority			the scheduling class to use if the asset is threaded.
 	@return						the asset, if found, or blank otherwise. */
-	[[nodiscard]] Shared_Asset shareAsset(const char* assetType, const std::string& filename, const std::function<Shared_Asset(void)>& constructor, const bool& threaded);
-	/** Pop's the first work order and completes it. */
-	void beginWorkOrder();
+	[[nodiscard]] Shared_Asset shareAsset(const char* assetType, const std::string& filename, const std::function<Shared_Asset(void)>& constructor, const bool& threaded, const Asset_Priority& priority = Asset_Priority::INHERIT);
+	/** Queue a work order to be completed by one of the loader threads.
+	@param	workOrder			the work order to complete.
+	@param	priority			the scheduling class to queue the order in.
+	@return						a future fulfilled once the work order completes. */
+	std::future<void> submitWorkOrder(const Asset_Work_Order& workOrder, const Asset_Priority& priority = Asset_Priority::INHERIT);
+	/** Move an asset that has yet to begin initializing to the front of the queue.
+	@param	asset				the asset to prioritize. */
+	void prioritize(const Shared_Asset& asset);
+	/** Block until an asset finalizes, initializing it or helping with other work orders in the meantime.
+	@note						only helps up to ASSETMANAGER_MAX_HELP_DEPTH nested waits deep, then sleeps on the asset.
+	@param	asset				the asset to wait on. */
+	void waitForAsset(const Shared_Asset& asset);
+	/** Waits for and completes the next available work order, from this thread's queue or stolen from another.
+	@return						true if the calling thread should keep working, false if the manager is shutting down. */
+	bool beginWorkOrder();
+	/** Wake all loader threads and stop them from waiting on further work orders. */
+	void shutdown();
+	/** Retrieve the number of loader threads this manager has work queues for.
+	@return						the number of loader threads to create. */
+	unsigned int getThreadCount() const noexcept;
 	/** Forwards an asset-is-finalized notification request, which will be activated from the main thread. */
 	void submitNotifyee(const std::pair<std::shared_ptr<bool>, std::function<void()>>& callBack);
 	/** From the main thread, calls all notification calls (for completed asset loading). */
@@ -37,12 +69,35 @@ public:
 
 
 private:
+	// Private Methods
+	/** Queue a work order without creating a future for it.
+	@param	workOrder			the work order to complete.
+	@param	priority			the scheduling class to queue the order in. */
+	void pushWorkOrder(Asset_Work_Order&& workOrder, const Asset_Priority& priority);
+	/** Pop the highest priority work order available, preferring this thread's queue, and complete it.
+	@return						true if a work order was completed, false if none were available. */
+	bool tryWorkOrder();
+	/** Initialize an asset if no other thread has started doing so.
+	@param	asset				the asset to initialize.
+	@return						true if this thread initialized the asset, false otherwise. */
+	static bool tryInitialize(const Shared_Asset& asset);
+
+
 	// Private Attributes
 	std::shared_mutex m_mutexAssets;
 	VectorMap<Shared_Asset> m_assetMap;
 
-	std::shared_mutex m_mutexWorkorders;
-	std::deque<Asset_Work_Order> m_workOrders;
+	/** A loader thread's work orders, split by priority class. */
+	struct Work_Queue {
+		std::mutex m_mutex;
+		std::array<std::deque<Asset_Work_Order>, ASSET_PRIORITY_COUNT> m_orders;
+	};
+	std::vector<Work_Queue> m_queues;
+	std::atomic_size_t m_pendingOrders = 0ULL;
+	std::atomic_uint m_workerCount = 0U, m_nextQueue = 0U;
+	std::atomic_bool m_running = true;
+	std::mutex m_mutexSignal;
+	std::condition_variable m_signal;
 
 	std::shared_mutex m_mutexNofications;
 	std::vector<std::pair<std::shared_ptr<bool>, std::function<void()>>> m_notifyees;
@@ -1,25 +1,229 @@
 #include "Managers/MessageManager.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 
 
-void MessageManager::statement(const std::string& input)
+/** Source of each manager's generation, starting above the 0 that marks a thread as having no ring. */
+static std::atomic_size_t g_nextGeneration = 1ULL;
+
+MessageManager::~MessageManager()
+{
+	{
+		std::unique_lock<std::mutex> sinkGuard(m_mutexSink);
+		m_running = false;
+	}
+	m_signal.notify_all();
+	if (m_sinkThread.joinable())
+		m_sinkThread.join();
+}
+
+MessageManager::MessageManager() :
+	m_generation(g_nextGeneration.fetch_add(1ULL, std::memory_order_relaxed))
+{
+	m_sinkThread = std::thread(&MessageManager::sinkLoop, this);
+}
+
+void MessageManager::statement(const std::string& input, const Message_Category& category)
+{
+	textOutput(Message_Severity::STATEMENT, category, input);
+}
+
+void MessageManager::warning(const std::string& input, const Message_Category& category)
 {
-	textOutput(input);
+	textOutput(Message_Severity::WARNING, category, input);
 }
 
-void MessageManager::warning(const std::string& input)
+void MessageManager::error(const std::string& input, const Message_Category& category)
 {
-	textOutput("Warning: " + input);
+	textOutput(Message_Severity::FAILURE, category, input);
 }
 
-void MessageManager::error(const std::string& input)
+bool MessageManager::isEnabled(const Message_Severity& severity, const Message_Category& category) const noexcept
 {
-	textOutput("Error: " + input);
+	return severity >= m_threshold.load(std::memory_order_relaxed)
+		&& (static_cast<unsigned int>(category) & m_categoryMask.load(std::memory_order_relaxed)) != 0U;
 }
 
-void MessageManager::textOutput(const std::string& output)
+void MessageManager::setSeverityThreshold(const Message_Severity& severity) noexcept
 {
-	std::unique_lock<std::shared_mutex> write_guard(m_mutex);
-	m_messageLog.push_back(output);
-	std::cout << output + "\n";
+	m_threshold = severity;
+}
+
+void MessageManager::setCategoryMask(const Message_Category& mask) noexcept
+{
+	m_categoryMask = static_cast<unsigned int>(mask);
+}
+
+void MessageManager::setLogFile(const std::string& fullPath)
+{
+	std::unique_lock<std::shared_mutex> writeGuard(m_mutex);
+	m_logFile = std::ofstream(fullPath, std::ios::out | std::ios::trunc);
+}
+
+void MessageManager::flush()
+{
+	const auto target = m_sequence.load();
+	std::unique_lock<std::mutex> sinkGuard(m_mutexSink);
+	m_wake = true;
+	m_signal.notify_one();
+	m_flushed.wait(sinkGuard, [&] { return m_written >= target || !m_running; });
+}
+
+std::deque<std::string> MessageManager::getHistory()
+{
+	std::shared_lock<std::shared_mutex> readGuard(m_mutex);
+	return m_messageLog;
+}
+
+void MessageManager::textOutput(const Message_Severity& severity, const Message_Category& category, const std::string& input)
+{
+	// Reject filtered messages before touching the ring
+	if (!isEnabled(severity, category))
+		return;
+
+	// Wait for the background thread to make room if this thread's ring is full
+	auto& ring = getRing();
+	const auto tail = ring.m_tail.load(std::memory_order_relaxed);
+	while (tail - ring.m_head.load(std::memory_order_acquire) >= MESSAGEMANAGER_RING_SIZE) {
+		wakeSink();
+		std::this_thread::yield();
+	}
+
+	auto& message = ring.m_messages[tail % MESSAGEMANAGER_RING_SIZE];
+	message.m_sequence = m_sequence.fetch_add(1ULL, std::memory_order_relaxed);
+	message.m_severity = severity;
+	message.m_text = input;
+	ring.m_tail.store(tail + 1ULL, std::memory_order_release);
+
+	// Only interrupt the background thread for important messages or busy rings
+	if (severity != Message_Severity::STATEMENT || (tail + 1ULL - ring.m_head.load(std::memory_order_relaxed)) == MESSAGEMANAGER_RING_SIZE / 2ULL)
+		wakeSink();
+}
+
+MessageManager::Message_Ring& MessageManager::getRing()
+{
+	/** Owns the calling thread's ring, releasing it to the background thread once the thread exits. */
+	struct Ring_Owner {
+		size_t m_generation = 0ULL;
+		std::shared_ptr<Message_Ring> m_ring;
+		~Ring_Owner() {
+			if (m_ring)
+				m_ring->m_orphaned = true;
+		}
+	};
+	thread_local Ring_Owner t_owner;
+	// Match on generation rather than address, as a new manager may be built where an old one was
+	if (t_owner.m_generation != m_generation) {
+		if (t_owner.m_ring)
+			t_owner.m_ring->m_orphaned = true;
+		t_owner.m_generation = m_generation;
+		t_owner.m_ring = std::make_shared<Message_Ring>();
+		std::unique_lock<std::mutex> ringGuard(m_mutexRings);
+		m_rings.push_back(t_owner.m_ring);
+	}
+	return *t_owner.m_ring;
+}
+
+size_t MessageManager::writeBatch(const bool& force)
+{
+	std::vector<std::shared_ptr<Message_Ring>> rings;
+	{
+		std::unique_lock<std::mutex> ringGuard(m_mutexRings);
+		rings = m_rings;
+	}
+
+	// Drain every ring, dropping rings whose threads have exited once they're empty
+	auto& batch = m_heldBack;
+	std::vector<const Message_Ring*> emptied;
+	for (const auto& ring : rings) {
+		const bool orphaned = ring->m_orphaned;
+		const auto head = ring->m_head.load(std::memory_order_relaxed);
+		const auto tail = ring->m_tail.load(std::memory_order_acquire);
+		for (auto index = head; index < tail; ++index)
+			batch.emplace_back(std::move(ring->m_messages[index % MESSAGEMANAGER_RING_SIZE]));
+		ring->m_head.store(tail, std::memory_order_release);
+		if (orphaned)
+			emptied.push_back(ring.get());
+	}
+	if (!emptied.empty()) {
+		std::unique_lock<std::mutex> ringGuard(m_mutexRings);
+		m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(), [&](const auto& ring) {
+			return std::find(emptied.cbegin(), emptied.cend(), ring.get()) != emptied.cend();
+			}), m_rings.end());
+	}
+	if (batch.empty())
+		return 0ULL;
+
+	// Restore the order messages were sent in across threads
+	// A thread may take a sequence number before publishing its message, so stop at the first one missing
+	std::sort(batch.begin(), batch.end(), [](const auto& a, const auto& b) noexcept {
+		return a.m_sequence < b.m_sequence;
+		});
+	size_t count(0ULL);
+	for (; count < batch.size() && (force || batch[count].m_sequence == m_nextSequence); ++count)
+		m_nextSequence = batch[count].m_sequence + 1ULL;
+	if (count == 0ULL)
+		return 0ULL;
+
+	// Format the messages that are ready
+	std::string output;
+	std::unique_lock<std::shared_mutex> writeGuard(m_mutex);
+	for (size_t x = 0ULL; x < count; ++x) {
+		auto& message = batch[x];
+		if (message.m_severity == Message_Severity::WARNING)
+			message.m_text.insert(0ULL, "Warning: ");
+		else if (message.m_severity == Message_Severity::FAILURE)
+			message.m_text.insert(0ULL, "Error: ");
+		output += message.m_text + "\n";
+		m_messageLog.emplace_back(std::move(message.m_text));
+	}
+	while (m_messageLog.size() > MESSAGEMANAGER_MAX_HISTORY)
+		m_messageLog.pop_front();
+
+	// Write the whole batch at once
+	std::cout << output;
+	std::cout.flush();
+	if (m_logFile.is_open()) {
+		m_logFile << output;
+		m_logFile.flush();
+	}
+	batch.erase(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(count));
+	return count;
+}
+
+void MessageManager::wakeSink()
+{
+	{
+		std::unique_lock<std::mutex> sinkGuard(m_mutexSink);
+		m_wake = true;
+	}
+	m_signal.notify_one();
+}
+
+void MessageManager::sinkLoop()
+{
+	bool running = true;
+	while (running) {
+		{
+			// Batch up whatever arrives in the meantime, unless woken early
+			std::unique_lock<std::mutex> sinkGuard(m_mutexSink);
+			m_signal.wait_for(sinkGuard, std::chrono::milliseconds(10), [&] { return m_wake || !m_running; });
+			m_wake = false;
+			running = m_running;
+		}
+
+		// Keep draining on shutdown until nothing is left
+		auto count = writeBatch(false);
+		if (!running) {
+			while (const auto remaining = writeBatch(false))
+				count += remaining;
+			count += writeBatch(true);
+		}
+		{
+			std::unique_lock<std::mutex> sinkGuard(m_mutexSink);
+			m_written += count;
+		}
+		m_flushed.notify_all();
+	}
 }
\ No newline at end of file
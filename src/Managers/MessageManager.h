@@ -2,38 +2,148 @@
 #ifndef MESSAGEMANAGER_H
 #define MESSAGEMANAGER_H
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 
+constexpr size_t MESSAGEMANAGER_RING_SIZE = 256ULL;
+constexpr size_t MESSAGEMANAGER_MAX_HISTORY = 1024ULL;
+
+/** The severity of a message, messages below the manager's threshold are discarded. */
+enum class Message_Severity {
+	STATEMENT,
+	WARNING,
+	FAILURE
+};
+
+/** The category of a message, messages outside of the manager's category mask are discarded. */
+enum class Message_Category : unsigned int {
+	GENERAL = 0b0000'0001,
+	ASSETS = 0b0000'0010,
+	GRAPHICS = 0b0000'0100,
+	EDITOR = 0b0000'1000,
+	ALL = 0b1111'1111,
+};
+
 /** Provides some message reporting functionality for the engine.
-Holds a log of text in case they need to be accessed by any external UI */
+Holds a log of text in case they need to be accessed by any external UI.
+Messages are queued into per-thread rings and written out in batches by a background thread. */
 class MessageManager {
 public:
+	// Public (De)Constructors
+	/** Flush all pending messages and stop the background thread. */
+	~MessageManager();
+	/** Construct a message manager, starting its background thread. */
+	MessageManager();
+	/** Disallow message manager move constructor. */
+	MessageManager(MessageManager&&) noexcept = delete;
+	/** Disallow message manager copy constructor. */
+	MessageManager(const MessageManager&) noexcept = delete;
+	/** Disallow message manager move assignment. */
+	MessageManager& operator =(MessageManager&&) noexcept = delete;
+	/** Disallow message manager copy assignment. */
+	MessageManager& operator =(const MessageManager&) noexcept = delete;
+
 
 	// Public Methods
 	/** Prints a general statement into the console.
-	@param	input	std::string message to print. */
-	void statement(const std::string& input);
+	@param	input		std::string message to print.
+	@param	category	the category of the message. */
+	void statement(const std::string& input, const Message_Category& category = Message_Category::GENERAL);
 	/** Prints a warning message into the console.
-	@param	input	std::string message to print. */
-	void warning(const std::string& input);
+	@param	input		std::string message to print.
+	@param	category	the category of the message. */
+	void warning(const std::string& input, const Message_Category& category = Message_Category::GENERAL);
 	/** Prints an error message into the console.
-	@param	input	the error message to be displayed. */
-	void error(const std::string& input);
+	@param	input		the error message to be displayed.
+	@param	category	the category of the message. */
+	void error(const std::string& input, const Message_Category& category = Message_Category::GENERAL);
+	/** Retrieve whether a message would be kept, so that callers can skip building its text.
+	@param	severity	the severity of the message.
+	@param	category	the category of the message.
+	@return				true if the message passes both the severity threshold and category mask, false otherwise. */
+	bool isEnabled(const Message_Severity& severity, const Message_Category& category) const noexcept;
+	/** Discard any future messages below a given severity.
+	@param	severity	the lowest severity to keep. */
+	void setSeverityThreshold(const Message_Severity& severity) noexcept;
+	/** Discard any future messages outside of a set of categories.
+	@param	mask		the categories to keep, combined bitwise. */
+	void setCategoryMask(const Message_Category& mask) noexcept;
+	/** Additionally write all future messages to a file.
+	@param	fullPath	the absolute path to the log file, which is overwritten. */
+	void setLogFile(const std::string& fullPath);
+	/** Block until every message queued so far has been written out. */
+	void flush();
+	/** Retrieve a copy of the most recent messages written out.
+	@return			the message history, oldest first. */
+	std::deque<std::string> getHistory();
 
 
 private:
+	// Private Structures
+	/** A queued message, formatted only once it reaches the background thread. */
+	struct Message {
+		size_t m_sequence = 0ULL;
+		Message_Severity m_severity = Message_Severity::STATEMENT;
+		std::string m_text;
+	};
+	/** A single-producer single-consumer ring of messages, owned by one thread. */
+	struct Message_Ring {
+		std::array<Message, MESSAGEMANAGER_RING_SIZE> m_messages;
+		std::atomic_size_t m_head = 0ULL, m_tail = 0ULL;
+		std::atomic_bool m_orphaned = false;
+	};
+
+
 	// Private Methods
-	/** A helper function that writes the message to a log and to the console.
-	@param	output	the text to write to the log. */
-	void textOutput(const std::string& output);
+	/** A helper function that queues a message for the background thread.
+	@param	severity	the severity of the message.
+	@param	category	the category of the message.
+	@param	input		the text of the message. */
+	void textOutput(const Message_Severity& severity, const Message_Category& category, const std::string& input);
+	/** Retrieve the calling thread's ring, registering a new one if needed.
+	@return				the calling thread's ring. */
+	Message_Ring& getRing();
+	/** Drain every ring, writing the messages out in order.
+	@note				messages are held back until every earlier sequence number has been drained.
+	@param	force		if true, also write any held back messages, skipping missing sequence numbers.
+	@return				the number of messages written. */
+	size_t writeBatch(const bool& force);
+	/** Wake the background thread early. */
+	void wakeSink();
+	/** Background thread loop, writing out batches until stopped. */
+	void sinkLoop();
 
 
 	// Private Attributes
+	/** Unique to this manager, identifying which manager each thread's ring belongs to. */
+	const size_t m_generation;
+	std::atomic<Message_Severity> m_threshold = Message_Severity::STATEMENT;
+	std::atomic_uint m_categoryMask = static_cast<unsigned int>(Message_Category::ALL);
+	std::atomic_size_t m_sequence = 0ULL;
+	/** Messages drained ahead of a sequence number still being queued, only touched by the background thread. */
+	std::vector<Message> m_heldBack;
+	size_t m_nextSequence = 0ULL;
+	std::mutex m_mutexRings;
+	std::vector<std::shared_ptr<Message_Ring>> m_rings;
+	std::mutex m_mutexSink;
+	std::condition_variable m_signal;
+	bool m_running = true, m_wake = false;
+	size_t m_written = 0ULL;
+	std::condition_variable m_flushed;
+	std::ofstream m_logFile;
 	std::shared_mutex m_mutex;
 	std::deque<std::string> m_messageLog;
+	std::thread m_sinkThread;
 };
 
 #endif // MESSAGEMANAGER_H
\ No newline at end of file
@@ -14,6 +14,11 @@ void ECS_Module::deinitialize() noexcept
 {
 }
 
+ecsScheduler& ECS_Module::getScheduler() noexcept
+{
+	return m_scheduler;
+}
+
 void ECS_Module::updateSystems(ecsSystemList& systems, ecsWorld& world, const float& deltaTime)
 {
 	world.updateSystems(systems, deltaTime);
@@ -3,6 +3,7 @@
 #define ECS_MODULE_H
 
 #include "Modules/Engine_Module.h"
+#include "Modules/ECS/ecsScheduler.h"
 #include "Modules/ECS/ecsWorld.h"
 #include "Modules/ECS/ecsSystem.h"
 
@@ -22,6 +23,9 @@ public:
 
 
 	// Public Methods
+	/** Retrieve the scheduler used to update systems across multiple threads.
+	@return				reference to the engine's system scheduler. */
+	ecsScheduler& getScheduler() noexcept;
 	/** Update the components of all systems provided.
 	@param	systems				the systems to update.
 	@param	world				the ecsWorld to source data from.
@@ -43,6 +47,11 @@ public:
 	@param	componentTypes		list of component types to retrieve.
 	@param	func				lambda function serving as a system. */
 	[[maybe_unused]] static void updateSystem(const float& deltaTime, ecsWorld& world, const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes, const std::function<void(const float&, const std::vector<std::vector<ecsBaseComponent*>>&)>& func);
+
+
+private:
+	// Private Attributes
+	ecsScheduler m_scheduler;
 };
 
 #endif // ECS_MODULE_H
\ No newline at end of file
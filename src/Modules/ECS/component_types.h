@@ -7,36 +7,48 @@
 #include "Assets/Collider.h"
 #include "Modules/ECS/ecsComponent.h"
 #include "Modules/Graphics/Common/Camera.h"
+#include "Modules/Physics/Interpolated_MotionState.h"
 #include "Utilities/Transform.h"
 #include "Utilities/IO/Serializer.h"
 #include "glm/glm.hpp"
 #include <btBulletDynamicsCommon.h>
+#include <atomic>
 
 
-constexpr static const char selectedComponentName[] = "Selected_Component";
+/** Retrieve a new change version, unique across every component, for stamping components whose GPU data changed.
+@return					the new version. */
+inline size_t Next_Component_Version() noexcept
+{
+	static std::atomic_size_t version(0ULL);
+	return ++version;
+}
+
+inline constexpr char selectedComponentName[] = "Selected_Component";
 /** Component labeling an entity as "selected by the user". */
 struct Selected_Component final : public ecsComponent<Selected_Component, selectedComponentName> {
 };
 
-constexpr static const char transformName[] = "Transform_Component";
+inline constexpr char transformName[] = "Transform_Component";
 /** Spatial component, defining a position, scale, and orientation, for both local space and world space. */
 struct Transform_Component final : public ecsComponent<Transform_Component, transformName> {
 	Transform m_localTransform, m_worldTransform;
+	// Derived Attributes
+	size_t m_version = 0ULL;
 
 	inline std::vector<char> serialize() {
 		return Serializer::Serialize_Set(std::pair("m_localTransform", m_localTransform), std::pair("m_worldTransform", m_worldTransform));
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data, std::pair("m_localTransform", &m_localTransform), std::pair("m_worldTransform", &m_worldTransform));
 	}
 };
 
-constexpr static const char playerSpawnName[] = "PlayerSpawn_Component";
+inline constexpr char playerSpawnName[] = "PlayerSpawn_Component";
 /** Attribute for entity defining it as a player spawn point. */
 struct PlayerSpawn_Component final : public ecsComponent<PlayerSpawn_Component, playerSpawnName> {
 };
 
-constexpr static const char player3DName[] = "Player3D_Component";
+inline constexpr char player3DName[] = "Player3D_Component";
 /** Attribute defining an entity as a player. */
 struct Player3D_Component final : public ecsComponent<Player3D_Component, player3DName> {
 	glm::vec3 m_rotation = glm::vec3(0.0f);
@@ -44,12 +56,12 @@ struct Player3D_Component final : public ecsComponent<Player3D_Component, player
 	inline std::vector<char> serialize() {
 		return Serializer::Serialize_Set(std::pair("m_rotation", m_rotation));
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data, std::pair("m_rotation", &m_rotation));
 	}
 };
 
-constexpr static const char cameraName[] = "Camera_Component";
+inline constexpr char cameraName[] = "Camera_Component";
 /** Component adding a camera. */
 struct Camera_Component final : public ecsComponent<Camera_Component, cameraName> {
 	Camera m_camera;
@@ -58,12 +70,12 @@ struct Camera_Component final : public ecsComponent<Camera_Component, cameraName
 	inline std::vector<char> serialize() {
 		return Serializer::Serialize_Set(std::pair("m_camera", m_camera));
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data, std::pair("m_camera", &m_camera));
 	}
 };
 
-constexpr static const char boundingSphereName[] = "BoundingSphere_Component";
+inline constexpr char boundingSphereName[] = "BoundingSphere_Component";
 /** Component containing bounding information, only used so far for visual occlusion. */
 struct BoundingSphere_Component final : public ecsComponent<BoundingSphere_Component, boundingSphereName>{
 	glm::vec3 m_positionOffset = glm::vec3(0.0f);
@@ -79,7 +91,7 @@ struct BoundingSphere_Component final : public ecsComponent<BoundingSphere_Compo
 			std::pair("m_cameraCollision", m_cameraCollision)
 		);
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data,
 			std::pair("m_positionOffset", &m_positionOffset),
 			std::pair("m_radius", &m_radius),
@@ -88,7 +100,7 @@ struct BoundingSphere_Component final : public ecsComponent<BoundingSphere_Compo
 	}
 };
 
-constexpr static const char boundingBoxName[] = "BoundingBox_Component";
+inline constexpr char boundingBoxName[] = "BoundingBox_Component";
 /** Component containing bounding information, only used so far for visual occlusion. */
 struct BoundingBox_Component final : public ecsComponent<BoundingBox_Component, boundingBoxName>{
 	glm::vec3 m_positionOffset = glm::vec3(0.0f), m_extent = glm::vec3(0), m_min = glm::vec3(0.0f), m_max = glm::vec3(0.0f);
@@ -105,7 +117,7 @@ struct BoundingBox_Component final : public ecsComponent<BoundingBox_Component,
 			std::pair("m_cameraCollision", m_cameraCollision)
 		);
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data,
 			std::pair("m_positionOffset", &m_positionOffset),
 			std::pair("m_extent", &m_extent),
@@ -116,7 +128,7 @@ struct BoundingBox_Component final : public ecsComponent<BoundingBox_Component,
 	}
 };
 
-constexpr static const char colliderName[] = "Collider_Component";
+inline constexpr char colliderName[] = "Collider_Component";
 /** Component allowing for 3D physics. */
 struct Collider_Component final : public ecsComponent<Collider_Component, colliderName> {
 	// Serialized Attributes
@@ -128,7 +140,7 @@ struct Collider_Component final : public ecsComponent<Collider_Component, collid
 	// Derived Attributes
 	Transform m_worldTransform;
 	Shared_Collider m_collider;
-	std::shared_ptr<btDefaultMotionState> m_motionState = nullptr;
+	std::shared_ptr<Interpolated_MotionState> m_motionState = nullptr;
 	std::shared_ptr<btRigidBody> m_rigidBody = nullptr;
 	std::shared_ptr<btCollisionShape> m_shape = nullptr;
 
@@ -140,7 +152,7 @@ struct Collider_Component final : public ecsComponent<Collider_Component, collid
 			std::pair("m_mass", m_mass)
 		);
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data,
 			std::pair("m_modelName", &m_modelName),
 			std::pair("m_restitution", &m_restitution),
@@ -150,7 +162,7 @@ struct Collider_Component final : public ecsComponent<Collider_Component, collid
 	}
 };
 
-constexpr static const char propName[] = "Prop_Component";
+inline constexpr char propName[] = "Prop_Component";
 /** Component adding a 3D model for rendering. */
 struct Prop_Component final : public ecsComponent<Prop_Component, propName> {
 	// Serialized Attributes
@@ -161,6 +173,7 @@ struct Prop_Component final : public ecsComponent<Prop_Component, propName> {
 	Shared_Model m_model;
 	bool m_uploadModel = false, m_uploadMaterial = false;
 	size_t m_offset = 0ull, m_count = 0ull;
+	GLint m_baseVertex = 0;
 	GLuint m_materialID = 0u;
 
 	inline std::vector<char> serialize() {
@@ -169,7 +182,7 @@ struct Prop_Component final : public ecsComponent<Prop_Component, propName> {
 			std::pair("m_skin", m_skin)
 		);
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data,
 			std::pair("m_modelName", &m_modelName),
 			std::pair("m_skin", &m_skin)
@@ -177,7 +190,7 @@ struct Prop_Component final : public ecsComponent<Prop_Component, propName> {
 	}
 };
 
-constexpr static const char skeletonName[] = "Skeleton_Component";
+inline constexpr char skeletonName[] = "Skeleton_Component";
 /** Component allowing for an entity with a Prop to have skeletal animation. */
 struct Skeleton_Component final : public ecsComponent<Skeleton_Component, skeletonName> {
 	// Serialized Attributes
@@ -186,8 +199,12 @@ struct Skeleton_Component final : public ecsComponent<Skeleton_Component, skelet
 
 	// Derived Attributes
 	Shared_Mesh m_mesh;
-	float m_animTime = 0, m_animStart = 0;
+	float m_animTime = 0, m_animStart = 0, m_posedTime = -1;
+	int m_posedAnimation = -1;
 	std::vector<glm::mat4> m_transforms;
+	std::vector<size_t> m_keyCursors;
+	size_t m_version = 0ULL;
+	int m_paletteOffset = -1;
 
 	inline std::vector<char> serialize() {
 		return Serializer::Serialize_Set(
@@ -195,7 +212,7 @@ struct Skeleton_Component final : public ecsComponent<Skeleton_Component, skelet
 			std::pair("m_playAnim", m_playAnim)
 		);
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data,
 			std::pair("m_animation", &m_animation),
 			std::pair("m_playAnim", &m_playAnim)
@@ -203,7 +220,7 @@ struct Skeleton_Component final : public ecsComponent<Skeleton_Component, skelet
 	}
 };
 
-constexpr static const char shadowName[] = "Shadow_Component";
+inline constexpr char shadowName[] = "Shadow_Component";
 /** Component allowing an entity with a light to have shadows. */
 struct Shadow_Component final : public ecsComponent<Shadow_Component, shadowName> {
 	int m_shadowSpot = -1;
@@ -211,7 +228,7 @@ struct Shadow_Component final : public ecsComponent<Shadow_Component, shadowName
 	std::vector<float> m_updateTimes;
 };
 
-constexpr static const char lightName[] = "Light_Component";
+inline constexpr char lightName[] = "Light_Component";
 /** Component allowing an entity to emit light. */
 struct Light_Component final : public ecsComponent<Light_Component, lightName> {
 	enum class Light_Type : int {
@@ -231,7 +248,7 @@ struct Light_Component final : public ecsComponent<Light_Component, lightName> {
 			std::pair("m_cutoff", m_cutoff)
 		);
 	}
-	inline void deserialize(const std::vector<char>& data) {
+	inline void deserialize(const Serial_Data& data) {
 		Serializer::Deserialize_Set(data,
 			std::pair("m_type", &m_type),
 			std::pair("m_color", &m_color),
@@ -242,7 +259,7 @@ struct Light_Component final : public ecsComponent<Light_Component, lightName> {
 	}
 };
 
-constexpr static const char reflectorName[] = "Reflector_Component";
+inline constexpr char reflectorName[] = "Reflector_Component";
 /** Component giving an entity a cubemap reflection. */
 struct Reflector_Component final : public ecsComponent<Reflector_Component, reflectorName> {
 	std::vector<Camera> m_cameras;
@@ -0,0 +1,86 @@
+#include "Modules/ECS/ecsArchetype.h"
+#include <algorithm>
+
+
+ecsArchetype::ecsArchetype(const ComponentSignature& signature)
+	: m_signature(signature)
+{
+	const auto columnCount = m_signature.size();
+	m_typeSizes.reserve(columnCount);
+	m_columns.resize(columnCount);
+	for (const auto& componentID : m_signature)
+		m_typeSizes.push_back(std::get<3>(ecsBaseComponent::m_componentRegistry[componentID]));
+}
+
+size_t ecsArchetype::size() const noexcept
+{
+	return m_entities.size();
+}
+
+int ecsArchetype::findColumn(const ComponentID& componentID) const noexcept
+{
+	const auto spot = std::lower_bound(m_signature.cbegin(), m_signature.cend(), componentID);
+	if (spot != m_signature.cend() && *spot == componentID)
+		return static_cast<int>(std::distance(m_signature.cbegin(), spot));
+	return -1;
+}
+
+ecsBaseComponent* ecsArchetype::getComponent(const size_t& column, const size_t& row) const noexcept
+{
+	return (ecsBaseComponent*)(&m_columns[column][row * m_typeSizes[column]]);
+}
+
+size_t ecsArchetype::pushRow(const EntityHandle& entityHandle)
+{
+	m_entities.push_back(entityHandle);
+	++m_version;
+	return m_entities.size() - 1ULL;
+}
+
+void ecsArchetype::relocateComponent(const size_t& column, const size_t& row, ecsArchetype& destination, const size_t& destColumn) const
+{
+	const auto typeSize = m_typeSizes[column];
+	const auto* srcData = &m_columns[column][row * typeSize];
+	auto& destMemory = destination.m_columns[destColumn];
+	destMemory.insert(destMemory.end(), srcData, srcData + typeSize);
+}
+
+EntityHandle ecsArchetype::removeRow(const size_t& row, const bool& freeComponents)
+{
+	const auto lastRow = m_entities.size() - 1ULL;
+	const auto columnCount = m_columns.size();
+	for (size_t column = 0; column < columnCount; ++column) {
+		const auto& typeSize = m_typeSizes[column];
+		auto& mem_array = m_columns[column];
+		if (freeComponents) {
+			const auto& freeFn = std::get<1>(ecsBaseComponent::m_componentRegistry[m_signature[column]]);
+			freeFn(getComponent(column, row));
+		}
+		if (row != lastRow)
+			std::memcpy(&mem_array[row * typeSize], &mem_array[lastRow * typeSize], typeSize);
+		mem_array.resize(lastRow * typeSize);
+	}
+
+	EntityHandle movedEntity;
+	if (row != lastRow) {
+		movedEntity = m_entities[lastRow];
+		m_entities[row] = movedEntity;
+	}
+	m_entities.pop_back();
+	++m_version;
+	return movedEntity;
+}
+
+void ecsArchetype::clear()
+{
+	const auto columnCount = m_columns.size();
+	for (size_t column = 0; column < columnCount; ++column) {
+		const auto& freeFn = std::get<1>(ecsBaseComponent::m_componentRegistry[m_signature[column]]);
+		const auto rowCount = m_entities.size();
+		for (size_t row = 0; row < rowCount; ++row)
+			freeFn(getComponent(column, row));
+		m_columns[column].clear();
+	}
+	m_entities.clear();
+	++m_version;
+}
\ No newline at end of file
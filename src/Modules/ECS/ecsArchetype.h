@@ -0,0 +1,68 @@
+#pragma once
+#ifndef ECS_ARCHETYPE_H
+#define ECS_ARCHETYPE_H
+
+#include "Modules/ECS/ecsHandle.h"
+#include "Modules/ECS/ecsComponent.h"
+#include <vector>
+
+
+// Definitions to make life easier
+using ComponentSignature = std::vector<ComponentID>;
+
+/** A block of entities sharing the exact same set of component types.\n
+Components are stored structure-of-arrays style, one contiguous column per component type, where row 'i' of every column belongs to the same entity.
+@note	components are relocated between rows and archetypes by raw byte copy, the same way their memory vectors already are when they grow. */
+struct ecsArchetype {
+	// Public (De)Constructors
+	/** Construct an archetype for a specific component signature.
+	@param	signature		sorted list of the component types held by this archetype. */
+	explicit ecsArchetype(const ComponentSignature& signature);
+
+
+	// Public Methods
+	/** Retrieve the number of entities held by this archetype.
+	@return					the number of rows in this archetype. */
+	size_t size() const noexcept;
+	/** Find the column holding a specific component type.
+	@param	componentID		the runtime ID identifying the component class.
+	@return					the column index on success, -1 if this archetype doesn't hold that type. */
+	int findColumn(const ComponentID& componentID) const noexcept;
+	/** Retrieve a component at a specific column and row.
+	@param	column			the column index, matching an entry in the signature.
+	@param	row				the row index, matching an entity.
+	@return					the component found at that location. */
+	ecsBaseComponent* getComponent(const size_t& column, const size_t& row) const noexcept;
+	/** Append a new row to this archetype, belonging to the entity specified.
+	@param	entityHandle	handle to the entity owning the row.
+	@return					the index of the new row. */
+	size_t pushRow(const EntityHandle& entityHandle);
+	/** Relocate a row's component into another archetype's column without destructing it.
+	@param	column			the source column.
+	@param	row				the source row.
+	@param	destination		the destination archetype.
+	@param	destColumn		the destination column. */
+	void relocateComponent(const size_t& column, const size_t& row, ecsArchetype& destination, const size_t& destColumn) const;
+	/** Remove a row by swapping the last row into its place.
+	@param	row				the row index to remove.
+	@param	freeComponents	if true, destructs the row's components first, otherwise assumes they've been relocated elsewhere.
+	@return					handle to the entity whose row was moved into the removed spot, empty if none were moved. */
+	EntityHandle removeRow(const size_t& row, const bool& freeComponents);
+	/** Destruct all the components held by this archetype, and clear all rows. */
+	void clear();
+
+
+	// Public Attributes
+	/** Sorted list of component types held by this archetype. */
+	ComponentSignature m_signature;
+	/** The byte-size of the components in each column. */
+	std::vector<size_t> m_typeSizes;
+	/** Component data, one column per entry in the signature. */
+	std::vector<ComponentDataSpace> m_columns;
+	/** The entity owning each row. */
+	std::vector<EntityHandle> m_entities;
+	/** Incremented whenever rows are added or removed, invalidating pointers into the columns. */
+	size_t m_version = 0ULL;
+};
+
+#endif // ECS_ARCHETYPE_H
\ No newline at end of file
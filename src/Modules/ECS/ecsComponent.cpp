@@ -34,11 +34,21 @@ std::shared_ptr<ecsBaseComponent> ecsBaseComponent::from_buffer(const std::vecto
 	if (const auto& componentID = m_nameRegistry.search(componentTypeName.c_str())) {
 		const auto& [createFn, freeFn, newFn, size] = m_componentRegistry[*componentID];
 		if (const auto clone = newFn()) {
-			clone->recover_data(std::vector(data.begin() + dataRead, data.begin() + dataRead + classDataSize));
+			clone->recover_data(Serial_Data{ data.data() + dataRead, classDataSize });
 			dataRead += classDataSize;
 			return clone;
 		}
 	}
 	dataRead += classDataSize;
 	return nullptr;
+}
+
+std::shared_ptr<ecsBaseComponent> ecsBaseComponent::from_buffer(const ComponentID& componentID, const Serial_Data& data)
+{
+	if (componentID >= 0 && componentID < static_cast<ComponentID>(m_componentRegistry.size()))
+		if (const auto clone = std::get<2>(m_componentRegistry[componentID])()) {
+			clone->recover_data(data);
+			return clone;
+		}
+	return nullptr;
 }
\ No newline at end of file
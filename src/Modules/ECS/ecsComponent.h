@@ -4,8 +4,10 @@
 
 #include "Modules/ECS/ecsHandle.h"
 #include "Utilities/MappedChar.h"
+#include "Utilities/IO/Serializer.h"
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -16,7 +18,6 @@ struct ecsBaseComponent;
 class ecsWorld;
 using ComponentID = int;
 using ComponentDataSpace = std::vector<uint8_t>;
-using ComponentMap = std::map<ComponentID, ComponentDataSpace>;
 using ComponentCreateFunction = std::function<ComponentID(ComponentDataSpace & memory, const ComponentHandle & componentHandle, const EntityHandle & entityHandle, const ecsBaseComponent * comp)>;
 using ComponentNewFunction = std::function<std::shared_ptr<ecsBaseComponent>()>;
 using ComponentFreeFunction = std::function<void(ecsBaseComponent * comp)>;
@@ -50,6 +51,11 @@ struct ecsBaseComponent {
 	@param	dataRead	reference updated with the number of bytes read.
 	@return				if successful a shared pointer to a new component, nullptr otherwise. */
 	static std::shared_ptr<ecsBaseComponent> from_buffer(const std::vector<char>& data, size_t& dataRead);
+	/** Generate a component of a known type, recovering its data from a view of serialized data.
+	@param	componentID	the runtime ID identifying the component class.
+	@param	data		view of the serialized component data, labeled or fixed-layout.
+	@return				if successful a shared pointer to a new component, nullptr otherwise. */
+	static std::shared_ptr<ecsBaseComponent> from_buffer(const ComponentID& componentID, const Serial_Data& data);
 
 
 	// Public Attributes
@@ -77,7 +83,7 @@ protected:
 	static ComponentID registerType(const ComponentCreateFunction& createFn, const ComponentFreeFunction& freeFn, const ComponentNewFunction& newFn, const size_t& size, const char* string);
 	/** Recover and load component data into this component from a char buffer.
 	@param	data		serialized component data. */
-	virtual void recover_data(const std::vector<char>& data) = 0;
+	virtual void recover_data(const Serial_Data& data) = 0;
 
 
 	// Protected Attributes
@@ -85,8 +91,9 @@ protected:
 	inline static std::vector<std::tuple<ComponentCreateFunction, ComponentFreeFunction, ComponentNewFunction, size_t>> m_componentRegistry = {};
 	/** A map between component class name's and it's runtime variables like ID and size. */
 	inline static MappedChar<ComponentID> m_nameRegistry = MappedChar<ComponentID>();
-	/** Allow the ecsWorld to interact with these members. */
+	/** Allow the ecsWorld and its archetypes to interact with these members. */
 	friend class ecsWorld;
+	friend struct ecsArchetype;
 };
 
 
@@ -105,7 +112,7 @@ struct ecsComponent : public ecsBaseComponent {
 		return {};
 	}
 	/** Default de-serialization method, doing nothing. */
-	inline static void deserialize(const std::vector<char>&) noexcept {}
+	inline static void deserialize(const Serial_Data&) noexcept {}
 	/** Save this component to a char buffer.
 	@return				serialized version of self. */
 	inline std::vector<char> to_buffer() final {
@@ -140,7 +147,7 @@ protected:
 	// Protected Interface Implementation
 	/** Recover previously serialized data.
 	@param	data		serialized version of component. */
-	inline void recover_data(const std::vector<char>& data) final {
+	inline void recover_data(const Serial_Data& data) final {
 		// Previously recovered type name, created this class
 		// Next recover data
 		static_cast<C&>(*this).deserialize(data);
@@ -20,8 +20,12 @@ struct ecsEntity {
 	std::string m_name = "Entity";
 	// The index this entity is found at in the entity vector
 	int m_entityIndex = -1;
-	// The list of component raw-types held by this entity. First of pair is the component ID, second is id to the create function
+	// The list of component raw-types held by this entity. Component ID, column index within the entity's archetype, and component handle
 	std::vector<std::tuple<ComponentID, int, ComponentHandle>> m_components = {};
+	// The archetype holding this entity's components, -1 if the entity has none
+	int m_archetypeIndex = -1;
+	// The row this entity's components occupy within its archetype
+	int m_archetypeRow = -1;
 	// An optional parent for this entity, used when forming larger mega-entities
 	EntityHandle m_parent;
 	// An optional set of children for this entity, whom this entity will be the parent of
@@ -1,32 +1,56 @@
 #include "Modules/ECS/ecsHandle.h"
-#include <algorithm>
 
 
-ecsHandle::ecsHandle(const char id[32])
+ecsHandle::ecsHandle(const char id[32]) noexcept
+{
+	// Decode hex digits without branching: '0'-'9' keep their low nibble, 'a'-'f' and 'A'-'F' gain 9
+	for (int i = 0; i < 16; ++i) {
+		const auto high = static_cast<std::uint8_t>(id[i]);
+		const auto low = static_cast<std::uint8_t>(id[i + 16]);
+		m_uuid.m_high = (m_uuid.m_high << 4) | static_cast<std::uint64_t>((high & 0xFU) + (9U * (high >> 6)));
+		m_uuid.m_low = (m_uuid.m_low << 4) | static_cast<std::uint64_t>((low & 0xFU) + (9U * (low >> 6)));
+	}
+}
+
+ecsHandle::ecsHandle(const ecsBinaryHandle& binary) noexcept
+	: m_uuid(binary)
 {
-	std::copy(&id[0], &id[32], &m_uuid[0]);
 }
 
 bool ecsHandle::operator==(const ecsHandle& other) const noexcept
 {
-	return bool(std::strncmp(m_uuid, other.m_uuid, 32ULL) == 0);
+	return m_uuid == other.m_uuid;
 }
 
 bool ecsHandle::operator<(const ecsHandle& other) const noexcept
 {
-	return bool(std::strncmp(m_uuid, other.m_uuid, 32ULL) < 0);
+	return m_uuid < other.m_uuid;
 }
 
 ecsHandle::operator bool() const noexcept
 {
-	static const ecsHandle empty;
-	return !bool((*this) == empty);
+	return isValid();
 }
 
 bool ecsHandle::isValid() const noexcept
 {
-	static const ecsHandle empty;
-	return !bool((*this) == empty);
+	// Empty handles are entirely zeroed
+	return (m_uuid.m_high | m_uuid.m_low) != 0ULL;
+}
+
+void ecsHandle::toHex(char id[32]) const noexcept
+{
+	// Encode each nibble with a table lookup rather than branching on its value
+	constexpr char hexDigits[] = "0123456789abcdef";
+	for (int i = 0; i < 16; ++i) {
+		id[i] = hexDigits[(m_uuid.m_high >> (60 - (i * 4))) & 0xFULL];
+		id[i + 16] = hexDigits[(m_uuid.m_low >> (60 - (i * 4))) & 0xFULL];
+	}
+}
+
+size_t ecsHandle::hash() const noexcept
+{
+	return m_uuid.hash();
 }
 
 EntityHandle::EntityHandle(const ecsHandle& handle) noexcept
@@ -2,18 +2,59 @@
 #ifndef ECS_HANDLE_H
 #define ECS_HANDLE_H
 
+#include <cstdint>
+#include <functional>
+
+
+/** The 128-bit binary form of an ecsHandle, compared and hashed as two words rather than as 32 hex characters. */
+struct ecsBinaryHandle {
+	/** The upper 64 bits, matching the first 16 hex characters. */
+	std::uint64_t m_high = 0ULL;
+	/** The lower 64 bits, matching the last 16 hex characters. */
+	std::uint64_t m_low = 0ULL;
+	/** Compare against another binary handle.
+	@param	other		an other binary handle to compare against.
+	@return				true if both handles are the same, false otherwise. */
+	inline bool operator==(const ecsBinaryHandle& other) const noexcept {
+		return m_high == other.m_high && m_low == other.m_low;
+	}
+	/** Compare against another binary handle.
+	@param	other		an other binary handle to compare against.
+	@return				true if the handles differ, false otherwise. */
+	inline bool operator!=(const ecsBinaryHandle& other) const noexcept {
+		return !(*this == other);
+	}
+	/** Compare if this should be ordered before another binary handle, matching the ordering of their hex form.
+	@param	other		an other binary handle to compare against.
+	@return				true if this handle is the less than the other handle, false otherwise. */
+	inline bool operator<(const ecsBinaryHandle& other) const noexcept {
+		return m_high < other.m_high || (m_high == other.m_high && m_low < other.m_low);
+	}
+	/** Generate a hash value for this handle.
+	@return				the hash value. */
+	inline size_t hash() const noexcept {
+		// Fold both words together, then spread the result across all bits
+		auto value = m_high ^ (m_low * 0x9E3779B97F4A7C15ULL);
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+		return static_cast<size_t>(value ^ (value >> 31));
+	}
+};
 
 /** A structure used to uniquely identify elements in the engine's ECS 'system'. */
 struct ecsHandle {
-	/** The UUID container. */
-	char m_uuid[32] = { '\0' };
+	/** The UUID container, held in binary form so that containers keyed on handles compare 2 words instead of 32 characters. */
+	ecsBinaryHandle m_uuid;
 	/** Destroy this handle. */
 	inline virtual ~ecsHandle() = default;
 	/** Construct an empty handle. */
 	inline ecsHandle() noexcept = default;
-	/** Construct a specific handle.
+	/** Construct a specific handle, decoding it from hex characters.
 	@param	id			specific handle name as char array of size 32. */
-	explicit ecsHandle(const char id[32]);
+	explicit ecsHandle(const char id[32]) noexcept;
+	/** Construct a handle from its binary form.
+	@param	binary		the 128-bit binary handle. */
+	explicit ecsHandle(const ecsBinaryHandle& binary) noexcept;
 	/** Copy Constructor.
 	@param	other		an other handle to copy from. */
 	inline ecsHandle(const ecsHandle& other) noexcept = default;
@@ -42,6 +83,12 @@ struct ecsHandle {
 	/** Retrieve if this handle is valid.
 	@return				true if this handle is valid, false otherwise. */
 	bool isValid() const noexcept;
+	/** Encode this handle as hex characters, the inverse of the char array constructor.
+	@param	id			output char array of size 32. */
+	void toHex(char id[32]) const noexcept;
+	/** Generate a hash value for this handle.
+	@return				the hash value. */
+	size_t hash() const noexcept;
 };
 
 /** Specialized handle for labeling Entities. */
@@ -66,4 +113,20 @@ struct ComponentHandle final : ecsHandle {
 	inline ComponentHandle& operator=(const ComponentHandle& other) noexcept = default;
 };
 
+/** Allow ECS handles to be used as keys in hashed containers. */
+namespace std {
+	template <> struct hash<ecsHandle> {
+		inline size_t operator()(const ecsHandle& handle) const noexcept { return handle.hash(); }
+	};
+	template <> struct hash<EntityHandle> {
+		inline size_t operator()(const EntityHandle& handle) const noexcept { return handle.hash(); }
+	};
+	template <> struct hash<ComponentHandle> {
+		inline size_t operator()(const ComponentHandle& handle) const noexcept { return handle.hash(); }
+	};
+	template <> struct hash<ecsBinaryHandle> {
+		inline size_t operator()(const ecsBinaryHandle& handle) const noexcept { return handle.hash(); }
+	};
+}
+
 #endif // ECS_HANDLE_H
\ No newline at end of file
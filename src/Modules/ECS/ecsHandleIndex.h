@@ -0,0 +1,133 @@
+#pragma once
+#ifndef ECS_HANDLE_INDEX_H
+#define ECS_HANDLE_INDEX_H
+
+#include "Modules/ECS/ecsHandle.h"
+#include <algorithm>
+#include <vector>
+
+
+/** A flat, open-addressing hash table mapping ECS handles to values of type T.\n
+Slots key on the handle's 128-bit binary form, keeping them small and their comparisons to 2 words.\n
+Uses linear probing with backward-shift deletion, so lookups never have to step over tombstones.
+@tparam	T		any type to store. */
+template <typename T>
+class ecsHandleIndex {
+public:
+	// Public Methods
+	/** Find the value associated with the given handle.
+	@param	handle	the handle to search for.
+	@return			pointer to the value on success, nullptr otherwise. */
+	inline T* find(const ecsHandle& handle) noexcept {
+		const auto& key = handle.m_uuid;
+		if (m_count != 0ULL)
+			for (auto i = key.hash() & m_mask; m_slots[i].m_occupied; i = (i + 1ULL) & m_mask)
+				if (m_slots[i].m_key == key)
+					return &m_slots[i].m_value;
+		return nullptr;
+	}
+	/** Find the value associated with the given handle.
+	@param	handle	the handle to search for.
+	@return			pointer to the value on success, nullptr otherwise. */
+	inline const T* find(const ecsHandle& handle) const noexcept {
+		return const_cast<ecsHandleIndex*>(this)->find(handle);
+	}
+	/** Insert or overwrite the value associated with the given handle.
+	@param	handle	the handle to use as the key.
+	@param	value	the value to newly insert or overwrite. */
+	inline void insertOrAssign(const ecsHandle& handle, const T& value) {
+		insertOrAssign(handle.m_uuid, value);
+	}
+	/** Remove the value associated with the given handle.
+	@param	handle	the handle to remove.
+	@return			true on successful removal, false otherwise. */
+	inline bool erase(const ecsHandle& handle) noexcept {
+		if (m_count == 0ULL)
+			return false;
+		const auto& key = handle.m_uuid;
+		auto i = key.hash() & m_mask;
+		for (; m_slots[i].m_occupied; i = (i + 1ULL) & m_mask) {
+			if (m_slots[i].m_key == key) {
+				// Shift any following displaced entries back into the gap
+				auto gap = i;
+				for (auto j = (i + 1ULL) & m_mask; m_slots[j].m_occupied; j = (j + 1ULL) & m_mask) {
+					const auto home = m_slots[j].m_key.hash() & m_mask;
+					if (((j - home) & m_mask) >= ((j - gap) & m_mask)) {
+						m_slots[gap] = std::move(m_slots[j]);
+						gap = j;
+					}
+				}
+				m_slots[gap] = Slot();
+				--m_count;
+				return true;
+			}
+		}
+		return false;
+	}
+	/** Grow the table ahead of time, so that it can hold a number of entries without rehashing.
+	@param	count	the number of entries to make room for. */
+	inline void reserve(const size_t& count) {
+		size_t capacity(16ULL);
+		while (capacity < count * 2ULL)
+			capacity *= 2ULL;
+		if (capacity > m_slots.size())
+			rehash(capacity);
+	}
+	/** Clears the table of all entries. */
+	inline void clear() noexcept {
+		m_slots.clear();
+		m_mask = 0ULL;
+		m_count = 0ULL;
+	}
+	/** Retrieve the number of entries in the table.
+	@return			the number of entries. */
+	inline size_t size() const noexcept {
+		return m_count;
+	}
+
+
+private:
+	// Private Methods
+	/** Insert or overwrite the value associated with the given binary handle.
+	@param	key		the binary handle to use as the key.
+	@param	value	the value to newly insert or overwrite. */
+	inline void insertOrAssign(const ecsBinaryHandle& key, const T& value) {
+		if ((m_count + 1ULL) * 2ULL > m_slots.size())
+			rehash(std::max<size_t>(16ULL, m_slots.size() * 2ULL));
+		auto i = key.hash() & m_mask;
+		for (; m_slots[i].m_occupied; i = (i + 1ULL) & m_mask)
+			if (m_slots[i].m_key == key) {
+				m_slots[i].m_value = value;
+				return;
+			}
+		m_slots[i].m_key = key;
+		m_slots[i].m_value = value;
+		m_slots[i].m_occupied = true;
+		++m_count;
+	}
+	/** Resize the table, re-inserting every entry.
+	@param	capacity	the new capacity, must be a power of 2. */
+	inline void rehash(const size_t& capacity) {
+		auto oldSlots = std::move(m_slots);
+		m_slots = std::vector<Slot>(capacity);
+		m_mask = capacity - 1ULL;
+		m_count = 0ULL;
+		for (auto& slot : oldSlots)
+			if (slot.m_occupied)
+				insertOrAssign(slot.m_key, slot.m_value);
+	}
+
+
+	// Private Attributes
+	/** A single key-value entry. */
+	struct Slot {
+		ecsBinaryHandle m_key;
+		T m_value = T();
+		bool m_occupied = false;
+	};
+	std::vector<Slot> m_slots;
+	size_t m_mask = 0ULL;
+	size_t m_count = 0ULL;
+};
+
+#endif // ECS_HANDLE_INDEX_H
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "Modules/ECS/ecsQuery.h"
+#include <algorithm>
+
+
+ecsQuery::ecsQuery(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes)
+	: m_componentTypes(componentTypes)
+{
+}
+
+bool ecsQuery::tryAddArchetype(const size_t& archetypeIndex, const ecsArchetype& archetype)
+{
+	const auto componentTypesCount = m_componentTypes.size();
+	std::vector<int> columns(componentTypesCount);
+	for (size_t i = 0; i < componentTypesCount; ++i) {
+		const auto& [componentID, componentFlag] = m_componentTypes[i];
+		columns[i] = archetype.findColumn(componentID);
+		if (columns[i] < 0 && (static_cast<unsigned int>(componentFlag) & static_cast<unsigned int>(ecsBaseSystem::RequirementsFlag::FLAG_OPTIONAL)) == 0)
+			return false;
+	}
+	// New archetypes start dirty, so the next refresh writes their rows
+	Tracked_Archetype tracked;
+	tracked.m_index = archetypeIndex;
+	tracked.m_columns = std::move(columns);
+	tracked.m_version = archetype.m_version;
+	m_archetypes.push_back(std::move(tracked));
+	return true;
+}
+
+bool ecsQuery::refresh(const std::vector<ecsArchetype>& archetypes)
+{
+	// Check if any of the archetypes changed since last time
+	m_rewrittenRows = 0ULL;
+	bool changed(false);
+	for (auto& tracked : m_archetypes) {
+		if (archetypes[tracked.m_index].m_version != tracked.m_version)
+			tracked.m_dirty = true;
+		changed = changed || tracked.m_dirty;
+	}
+	if (!changed)
+		return false;
+
+	// Move the spans of changed archetypes to the end, so archetypes that change often stop shifting the others
+	const auto firstChanged = std::stable_partition(m_archetypes.begin(), m_archetypes.end(), [](const Tracked_Archetype& tracked) noexcept {
+		return !tracked.m_dirty;
+		});
+
+	// Shift unchanged spans down into the gaps left behind, swapping rows to keep their allocations
+	size_t total(0ULL);
+	for (auto tracked = m_archetypes.begin(); tracked != firstChanged; ++tracked) {
+		if (tracked->m_offset != total) {
+			for (size_t row = 0; row < tracked->m_count; ++row)
+				std::swap(m_components[total + row], m_components[tracked->m_offset + row]);
+			tracked->m_offset = total;
+		}
+		total += tracked->m_count;
+	}
+	for (auto tracked = firstChanged; tracked != m_archetypes.end(); ++tracked) {
+		tracked->m_offset = total;
+		tracked->m_count = archetypes[tracked->m_index].size();
+		total += tracked->m_count;
+	}
+	m_components.resize(total);
+
+	// Rewrite the spans of changed archetypes, reusing previously allocated rows
+	const auto componentTypesCount = m_componentTypes.size();
+	for (auto tracked = firstChanged; tracked != m_archetypes.end(); ++tracked) {
+		const auto& archetype = archetypes[tracked->m_index];
+		for (size_t row = 0; row < tracked->m_count; ++row) {
+			auto& componentParam = m_components[tracked->m_offset + row];
+			componentParam.resize(componentTypesCount);
+			for (size_t i = 0; i < componentTypesCount; ++i)
+				componentParam[i] = tracked->m_columns[i] >= 0 ? archetype.getComponent(tracked->m_columns[i], row) : nullptr;
+		}
+		tracked->m_version = archetype.m_version;
+		tracked->m_dirty = false;
+		m_rewrittenRows += tracked->m_count;
+	}
+	return true;
+}
\ No newline at end of file
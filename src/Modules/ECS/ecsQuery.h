@@ -0,0 +1,59 @@
+#pragma once
+#ifndef ECS_QUERY_H
+#define ECS_QUERY_H
+
+#include "Modules/ECS/ecsArchetype.h"
+#include "Modules/ECS/ecsSystem.h"
+#include <vector>
+
+
+/** A persistent view of all the components matching a specific list of component types.\n
+Tracks which archetypes match, each owning a span of rows in the cached component list, and only rewrites the spans of archetypes that changed.
+Changed spans are moved to the end of the list, and unchanged spans shift down into their place by swapping rows, without re-reading their components. */
+struct ecsQuery {
+	// Public (De)Constructors
+	/** Construct a query for a specific list of component types.
+	@param	componentTypes	list of component types and their requirement flags. */
+	explicit ecsQuery(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes);
+
+
+	// Public Methods
+	/** Start tracking an archetype if it holds all the required component types of this query.
+	@param	archetypeIndex	the index of the archetype in the world.
+	@param	archetype		the archetype to test.
+	@return					true if the archetype matched, false otherwise. */
+	bool tryAddArchetype(const size_t& archetypeIndex, const ecsArchetype& archetype);
+	/** Rewrite the rows of any tracked archetypes that changed since the last refresh.
+	@param	archetypes		the world's archetypes, indexed the same as when added.
+	@return					true if the cached list had to be updated, false if it was already up to date. */
+	bool refresh(const std::vector<ecsArchetype>& archetypes);
+
+
+	// Public Structures
+	/** An archetype matching this query, and the span of rows it owns in the cached component list. */
+	struct Tracked_Archetype {
+		/** The index of the archetype in the world. */
+		size_t m_index = 0ULL;
+		/** The column of each component type, -1 if optional and missing. */
+		std::vector<int> m_columns;
+		/** The archetype version the span was last written at. */
+		size_t m_version = 0ULL;
+		/** The first row and number of rows of the span. */
+		size_t m_offset = 0ULL, m_count = 0ULL;
+		/** Set when the span must be rewritten by the next refresh. */
+		bool m_dirty = true;
+	};
+
+
+	// Public Attributes
+	/** The component types requested by this query. */
+	std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>> m_componentTypes;
+	/** Matching archetypes, in the order their spans appear in the cached list. */
+	std::vector<Tracked_Archetype> m_archetypes;
+	/** The cached list of components, one entry per matching entity. */
+	std::vector<std::vector<ecsBaseComponent*>> m_components;
+	/** The number of rows the last refresh had to rewrite. */
+	size_t m_rewrittenRows = 0ULL;
+};
+
+#endif // ECS_QUERY_H
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "Modules/ECS/ecsScheduler.h"
+#include "Modules/ECS/ecsWorld.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
+
+
+ecsScheduler::~ecsScheduler()
+{
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_alive = false;
+	}
+	m_taskCondition.notify_all();
+	for (auto& thread : m_threads)
+		if (thread.joinable())
+			thread.join();
+}
+
+ecsScheduler::ecsScheduler(const size_t& threadCount)
+{
+	m_threads.reserve(threadCount);
+	for (size_t x = 0; x < threadCount; ++x)
+		m_threads.emplace_back(&ecsScheduler::workerLoop, this);
+}
+
+void ecsScheduler::updateSystems(ecsWorld& world, ecsSystemList& systems, const float& deltaTime)
+{
+	const auto systemCount = systems.size();
+	for (size_t begin = 0ULL; begin < systemCount;) {
+		// Non-concurrent systems are barriers, run them on this thread
+		if (!systems[begin]->isConcurrent()) {
+			world.updateSystem(systems[begin].get(), deltaTime);
+			++begin;
+			continue;
+		}
+
+		// Batch together all the consecutive concurrent systems
+		auto end = begin + 1ULL;
+		while (end < systemCount && systems[end]->isConcurrent())
+			++end;
+		updateBatch(world, systems, begin, end, deltaTime);
+		begin = end;
+	}
+}
+
+size_t ecsScheduler::getThreadCount() const noexcept
+{
+	return m_threads.size();
+}
+
+void ecsScheduler::updateBatch(ecsWorld& world, ecsSystemList& systems, const size_t& begin, const size_t& end, const float& deltaTime)
+{
+	// Fetch components up front, as the world's queries aren't thread safe
+	// Each system runs in the wave after the latest earlier system it conflicts with
+	const auto batchSize = end - begin;
+	m_batchComponents.resize(batchSize);
+	m_batchWaves.assign(batchSize, 0ULL);
+	size_t waveCount(0ULL);
+	for (size_t x = 0; x < batchSize; ++x) {
+		const auto& system = *systems[begin + x];
+		m_batchComponents[x] = &world.getRelevantComponents(system.getComponentTypes());
+		for (size_t y = 0; y < x; ++y)
+			if (m_batchWaves[y] >= m_batchWaves[x] && system.conflictsWith(*systems[begin + y]))
+				m_batchWaves[x] = m_batchWaves[y] + 1ULL;
+		waveCount = std::max<size_t>(waveCount, m_batchWaves[x] + 1ULL);
+	}
+
+	// Queue each wave's systems, splitting them into chunks if they support it
+	for (size_t wave = 0; wave < waveCount; ++wave) {
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_tasks.clear();
+			m_nextTask = 0ULL;
+			m_deltaTime = deltaTime;
+			for (size_t x = 0; x < batchSize; ++x) {
+				const auto& components = *m_batchComponents[x];
+				if (m_batchWaves[x] != wave || components.empty())
+					continue;
+				auto* system = systems[begin + x].get();
+				const auto componentCount = components.size();
+				const auto chunkSize = system->getChunkSize() > 0ULL ? system->getChunkSize() : componentCount;
+				for (size_t chunkBegin = 0ULL; chunkBegin < componentCount; chunkBegin += chunkSize)
+					m_tasks.push_back({ system, &components, chunkBegin, std::min<size_t>(chunkBegin + chunkSize, componentCount) });
+			}
+			m_pendingTasks = m_tasks.size();
+		}
+		m_taskCondition.notify_all();
+		runTasks();
+	}
+}
+
+void ecsScheduler::runTasks()
+{
+	// Help the workers out until every task in the wave has finished
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (m_pendingTasks > 0ULL) {
+		if (m_nextTask < m_tasks.size())
+			runTask(lock);
+		else
+			m_doneCondition.wait(lock);
+	}
+}
+
+void ecsScheduler::runTask(std::unique_lock<std::mutex>& lock)
+{
+	const auto task = m_tasks[m_nextTask++];
+	const auto deltaTime = m_deltaTime;
+	lock.unlock();
+	{
+		PROFILE_ZONE("ecsSystem", task.m_system->getName());
+		if (task.m_begin == 0ULL && task.m_end == task.m_components->size())
+			task.m_system->updateComponents(deltaTime, *task.m_components);
+		else
+			task.m_system->updateComponentRange(deltaTime, *task.m_components, task.m_begin, task.m_end);
+	}
+	lock.lock();
+	if (--m_pendingTasks == 0ULL)
+		m_doneCondition.notify_all();
+}
+
+void ecsScheduler::workerLoop()
+{
+	Profiler::Set_Thread_Name("ECS Worker");
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true) {
+		m_taskCondition.wait(lock, [&] { return !m_alive || m_nextTask < m_tasks.size(); });
+		if (!m_alive)
+			return;
+		runTask(lock);
+	}
+}
\ No newline at end of file
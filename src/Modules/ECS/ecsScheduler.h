@@ -0,0 +1,87 @@
+#pragma once
+#ifndef ECS_SCHEDULER_H
+#define ECS_SCHEDULER_H
+
+#include "Modules/ECS/ecsSystem.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Forward Declarations
+class ecsWorld;
+
+/** Updates a list of systems across a pool of worker threads.\n
+Consecutive concurrent systems are grouped into batches, and each system in a batch waits on any earlier system it conflicts with.
+Non-concurrent systems act as barriers and are updated on the calling thread, so the list order is always respected.
+@note	results match a serial update as long as each system only touches the components it declares. */
+class ecsScheduler {
+public:
+	// Public (De)Constructors
+	/** Destroy this scheduler, joining all worker threads. */
+	~ecsScheduler();
+	/** Construct a scheduler.
+	@param	threadCount		the number of worker threads to spawn, besides the calling thread. */
+	explicit ecsScheduler(const size_t& threadCount = std::thread::hardware_concurrency() > 1U ? std::thread::hardware_concurrency() - 1U : 0U);
+
+
+	// Public Methods
+	/** Update the components of all systems provided.
+	@param	world			the ecsWorld to source data from.
+	@param	systems			the systems to update.
+	@param	deltaTime		the delta time. */
+	void updateSystems(ecsWorld& world, ecsSystemList& systems, const float& deltaTime);
+	/** Retrieve the number of worker threads in this scheduler.
+	@return					the number of worker threads. */
+	size_t getThreadCount() const noexcept;
+
+
+private:
+	// Private Methods
+	/** Disallow scheduler move constructor. */
+	inline ecsScheduler(ecsScheduler&&) noexcept = delete;
+	/** Disallow scheduler copy constructor. */
+	inline ecsScheduler(const ecsScheduler&) noexcept = delete;
+	/** Disallow scheduler move assignment. */
+	inline ecsScheduler& operator =(ecsScheduler&&) noexcept = delete;
+	/** Disallow scheduler copy assignment. */
+	inline ecsScheduler& operator =(const ecsScheduler&) noexcept = delete;
+	/** Update a batch of concurrent systems, in waves of systems whose dependencies have all finished.
+	@param	world			the ecsWorld to source data from.
+	@param	systems			the systems to update.
+	@param	begin			the first system in the batch.
+	@param	end				one past the last system in the batch.
+	@param	deltaTime		the delta time. */
+	void updateBatch(ecsWorld& world, ecsSystemList& systems, const size_t& begin, const size_t& end, const float& deltaTime);
+	/** Run all queued tasks to completion, with help from the worker threads. */
+	void runTasks();
+	/** Pop and run a single queued task.
+	@param	lock			lock on the task mutex, released while the task runs. */
+	void runTask(std::unique_lock<std::mutex>& lock);
+	/** Loop run by each worker thread. */
+	void workerLoop();
+
+
+	// Private Attributes
+	/** A single unit of work, updating a range of a system's components. */
+	struct Task {
+		ecsBaseSystem* m_system = nullptr;
+		const std::vector<std::vector<ecsBaseComponent*>>* m_components = nullptr;
+		size_t m_begin = 0ULL, m_end = 0ULL;
+	};
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_taskCondition;
+	std::condition_variable m_doneCondition;
+	std::vector<Task> m_tasks;
+	size_t m_nextTask = 0ULL;
+	size_t m_pendingTasks = 0ULL;
+	float m_deltaTime = 0.0F;
+	bool m_alive = true;
+	// Per-batch scratch space, kept to avoid reallocating every frame
+	std::vector<const std::vector<std::vector<ecsBaseComponent*>>*> m_batchComponents;
+	std::vector<size_t> m_batchWaves;
+};
+
+#endif // ECS_SCHEDULER_H
\ No newline at end of file
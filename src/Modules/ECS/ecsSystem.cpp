@@ -1,11 +1,38 @@
 #include "Modules/ECS/ecsSystem.h"
 
 
-std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>> ecsBaseSystem::getComponentTypes() const
+const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& ecsBaseSystem::getComponentTypes() const noexcept
 {
 	return m_componentTypes;
 }
 
+const std::vector<ecsBaseSystem::AccessFlag>& ecsBaseSystem::getComponentAccess() const noexcept
+{
+	return m_componentAccess;
+}
+
+bool ecsBaseSystem::isConcurrent() const noexcept
+{
+	return m_concurrent;
+}
+
+size_t ecsBaseSystem::getChunkSize() const noexcept
+{
+	return m_chunkSize;
+}
+
+bool ecsBaseSystem::conflictsWith(const ecsBaseSystem& other) const noexcept
+{
+	const auto typeCount = m_componentTypes.size();
+	const auto otherTypeCount = other.m_componentTypes.size();
+	for (size_t x = 0; x < typeCount; ++x)
+		for (size_t y = 0; y < otherTypeCount; ++y)
+			if (m_componentTypes[x].first == other.m_componentTypes[y].first &&
+				(m_componentAccess[x] == AccessFlag::ACCESS_READ_WRITE || other.m_componentAccess[y] == AccessFlag::ACCESS_READ_WRITE))
+				return true;
+	return false;
+}
+
 bool ecsBaseSystem::isValid() const noexcept
 {
 	for (const auto& [componentID, componentFlag] : m_componentTypes)
@@ -14,9 +41,20 @@ bool ecsBaseSystem::isValid() const noexcept
 	return false;
 }
 
-void ecsBaseSystem::addComponentType(const ComponentID& componentType, const RequirementsFlag& componentFlag)
+void ecsBaseSystem::updateComponentRange(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& /*components*/, const size_t& /*begin*/, const size_t& /*end*/)
+{
+}
+
+void ecsBaseSystem::addComponentType(const ComponentID& componentType, const RequirementsFlag& componentFlag, const AccessFlag& accessFlag)
 {
 	m_componentTypes.push_back({ componentType, componentFlag });
+	m_componentAccess.push_back(accessFlag);
+}
+
+void ecsBaseSystem::setConcurrent(const bool& concurrent, const size_t& chunkSize) noexcept
+{
+	m_concurrent = concurrent;
+	m_chunkSize = chunkSize;
 }
 
 bool ecsSystemList::addSystem(const std::shared_ptr<ecsBaseSystem>& system)
@@ -15,6 +15,11 @@ public:
 		FLAG_REQUIRED = 0,
 		FLAG_OPTIONAL = 1
 	};
+	/** Component access types, used to find which systems can run at the same time. */
+	enum class AccessFlag : unsigned int {
+		ACCESS_READ_WRITE = 0,
+		ACCESS_READ_ONLY = 1
+	};
 
 
 	// Public (De)Constructors
@@ -35,30 +40,62 @@ public:
 	// Public Methods
 	/** Retrieves the component types supported by this system.
 	@return		the component types supported by this system. */
-	std::vector<std::pair<ComponentID, RequirementsFlag>> getComponentTypes() const;
+	const std::vector<std::pair<ComponentID, RequirementsFlag>>& getComponentTypes() const noexcept;
+	/** Retrieves how this system accesses each of its component types, in the same order as getComponentTypes().
+	@return		the access flag for each component type. */
+	const std::vector<AccessFlag>& getComponentAccess() const noexcept;
+	/** Retrieves whether this system only touches its own components, and may be updated on a worker thread.
+	@return		true if the system can run concurrently, false otherwise. */
+	bool isConcurrent() const noexcept;
+	/** Retrieves the number of components per chunk when splitting this system's update across threads.
+	@return		the chunk size, or 0 if this system can't be split. */
+	size_t getChunkSize() const noexcept;
+	/** Check if this system and another touch the same component type, where at least one of them writes to it.
+	@param	other	the other system to compare against.
+	@return		true if both systems must run one after the other, false otherwise. */
+	bool conflictsWith(const ecsBaseSystem& other) const noexcept;
 	/** Retrieves whether or not this system is valid (has at least 1 non-optional component type).
 	@return		true if the system is valid, false otherwise. */
 	bool isValid() const noexcept;
 
 
 	// Public Interface
+	/** Retrieve a readable name for this system, labeling it when profiling.
+	@return		the system's name. */
+	virtual const char* getName() const noexcept = 0;
 	/** Tick this system by deltaTime, passing in all the components matching this system's requirements.
 	@param	deltaTime		the amount of time which passed since last update
 	@param	components		the components to update. */
 	virtual void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) = 0;
+	/** Tick a sub-range of this system's components by deltaTime, called from worker threads when this system is split into chunks.
+	@note	must be implemented by any system given a non-zero chunk size.
+	@param	deltaTime		the amount of time which passed since last update
+	@param	components		all of the components matching this system's requirements.
+	@param	begin			the first component entry to update.
+	@param	end				one past the last component entry to update. */
+	virtual void updateComponentRange(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components, const size_t& begin, const size_t& end);
 
 
 protected:
 	// Protected Methods
 	/** Add a component type to be used by this system.
 	@param	componentType	the type of component to use
-	@param	componentFlag	flag indicating required/optional */
-	void addComponentType(const ComponentID& componentType, const RequirementsFlag& componentFlag = RequirementsFlag::FLAG_REQUIRED);
+	@param	componentFlag	flag indicating required/optional
+	@param	accessFlag		flag indicating read-only/read-write */
+	void addComponentType(const ComponentID& componentType, const RequirementsFlag& componentFlag = RequirementsFlag::FLAG_REQUIRED, const AccessFlag& accessFlag = AccessFlag::ACCESS_READ_WRITE);
+	/** Allow this system to be updated on a worker thread, alongside any other systems it doesn't conflict with.
+	@note	only valid for systems which touch nothing but their declared components, or shared state nothing else writes to during the update.
+	@param	concurrent		true to allow concurrent updates, false otherwise.
+	@param	chunkSize		if non-zero, also splits this system's components into chunks of this size, see updateComponentRange(). */
+	void setConcurrent(const bool& concurrent, const size_t& chunkSize = 0ULL) noexcept;
 
 
 private:
 	// Private attributes
 	std::vector<std::pair<ComponentID, RequirementsFlag>> m_componentTypes;
+	std::vector<AccessFlag> m_componentAccess;
+	bool m_concurrent = false;
+	size_t m_chunkSize = 0ULL;
 };
 
 /** An ordered list of systems to be updated. */
@@ -1,9 +1,11 @@
 #include "Modules/ECS/ecsWorld.h"
 #include "Modules/ECS/ecsComponent.h"
+#include "Modules/ECS/ecsScheduler.h"
 #include "Modules/ECS/ECS_M.h"
 #include "Modules/ECS/component_types.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
 #include <random>
-#include <sstream>
 
 
 ecsWorld::~ecsWorld()
@@ -28,7 +30,8 @@ ecsWorld::ecsWorld(const std::vector<char>& data)
 }
 
 ecsWorld::ecsWorld(ecsWorld&& other) noexcept
-	: m_components(std::move(other.m_components)), m_entities(std::move(other.m_entities))
+	: m_archetypes(std::move(other.m_archetypes)), m_archetypeMap(std::move(other.m_archetypeMap)), m_queries(std::move(other.m_queries)), m_queryStatistics(other.m_queryStatistics), m_entities(std::move(other.m_entities)),
+	m_entityIndex(std::move(other.m_entityIndex)), m_componentIndex(std::move(other.m_componentIndex))
 {
 }
 
@@ -48,10 +51,40 @@ void ecsWorld::makeEntity(const ecsBaseComponent* const* const components, const
 	newEntity->m_entityIndex = static_cast<int>(root.size());
 	newEntity->m_parent = parentUUID;
 	root.insert_or_assign(UUID, newEntity);
+	m_entityIndex.insertOrAssign(UUID, newEntity);
 
+	// Collect the valid component types, skipping duplicates the same way makeComponent() does
+	ComponentSignature signature;
+	std::vector<const ecsBaseComponent*> sources;
+	signature.reserve(numComponents);
+	sources.reserve(numComponents);
 	for (size_t i = 0; i < numComponents; ++i) {
-		ComponentHandle componentHandle;
-		makeComponent(UUID, components[i], componentHandle);
+		const auto* component = components[i];
+		if (component == nullptr || !isComponentIDValid(component->m_runtimeID))
+			continue;
+		const auto& componentID = component->m_runtimeID;
+		const auto spot = std::lower_bound(signature.begin(), signature.end(), componentID);
+		if (spot != signature.end() && *spot == componentID)
+			continue;
+		signature.insert(spot, componentID);
+		sources.push_back(component);
+		newEntity->m_components.emplace_back(componentID, -1, ComponentHandle(generateUUID()));
+	}
+
+	// Construct every component directly in its final archetype, rather than migrating once per component
+	if (!signature.empty()) {
+		const auto archetypeIndex = findOrMakeArchetype(signature);
+		auto& archetype = m_archetypes[archetypeIndex];
+		newEntity->m_archetypeIndex = static_cast<int>(archetypeIndex);
+		newEntity->m_archetypeRow = static_cast<int>(archetype.pushRow(UUID));
+		const auto componentCount = sources.size();
+		for (size_t i = 0; i < componentCount; ++i) {
+			auto& [componentID, column, componentHandle] = newEntity->m_components[i];
+			column = archetype.findColumn(componentID);
+			const auto& createFn = std::get<0>(ecsBaseComponent::m_componentRegistry[componentID]);
+			createFn(archetype.m_columns[column], componentHandle, UUID, sources[i]);
+			m_componentIndex.insertOrAssign(componentHandle, { newEntity.get(), componentID });
+		}
 	}
 }
 
@@ -74,8 +107,13 @@ void ecsWorld::makeComponent(const EntityHandle& entityHandle, const ComponentID
 				}
 			if (!UUID.isValid())
 				UUID = ComponentHandle(generateUUID());
-			const auto& createfn = std::get<0>(ecsBaseComponent::m_componentRegistry[componentID]);
-			entity->m_components.emplace_back(componentID, createfn(m_components[componentID], UUID, entityHandle, component), UUID);
+
+			// Move the entity into the archetype matching its new signature, creating the component there
+			auto signature = entity->m_archetypeIndex >= 0 ? m_archetypes[entity->m_archetypeIndex].m_signature : ComponentSignature();
+			signature.insert(std::upper_bound(signature.begin(), signature.end(), componentID), componentID);
+			migrateEntity(entityHandle, *entity, signature, component, UUID);
+			entity->m_components.emplace_back(componentID, m_archetypes[entity->m_archetypeIndex].findColumn(componentID), UUID);
+			m_componentIndex.insertOrAssign(UUID, { entity.get(), componentID });
 		}
 	}
 }
@@ -89,8 +127,13 @@ bool ecsWorld::removeEntity(const EntityHandle& entityHandle)
 {
 	// Delete this entity's components
 	if (const auto entity = getEntity(entityHandle)) {
-		for (auto& [id, createFn, componentHandle] : entity->m_components)
-			deleteComponent(id, createFn);
+		if (entity->m_archetypeIndex >= 0)
+			removeArchetypeRow(entity->m_archetypeIndex, entity->m_archetypeRow, true);
+		entity->m_archetypeIndex = -1;
+		entity->m_archetypeRow = -1;
+		for (const auto& [compID, column, compHandle] : entity->m_components)
+			m_componentIndex.erase(compHandle);
+		entity->m_components.clear();
 
 		// Delete children entities
 		for (const auto& childHandle : getEntityHandles(entityHandle))
@@ -99,6 +142,7 @@ bool ecsWorld::removeEntity(const EntityHandle& entityHandle)
 		// Delete this entity
 		auto& root = entity->m_parent.isValid() ? (getEntity(entity->m_parent)->m_children) : m_entities;
 		root.erase(entityHandle);
+		m_entityIndex.erase(entityHandle);
 		return true;
 	}
 	return false;
@@ -121,11 +165,16 @@ bool ecsWorld::removeEntityComponent(const EntityHandle& entityHandle, const Com
 		for (size_t i = 0ULL; i < entityComponentCount; ++i) {
 			const auto& [compId, fn, compHandle] = entityComponents[i];
 			if (componentID == compId) {
-				deleteComponent(compId, fn);
+				m_componentIndex.erase(compHandle);
 				const auto srcIndex = entityComponents.size() - 1ULL;
 				const auto destIndex = i;
 				entityComponents[destIndex] = entityComponents[srcIndex];
 				entityComponents.pop_back();
+
+				// Move the entity into the archetype lacking this component, freeing it
+				auto signature = m_archetypes[entity->m_archetypeIndex].m_signature;
+				signature.erase(std::lower_bound(signature.begin(), signature.end(), componentID));
+				migrateEntity(entityHandle, *entity, signature, nullptr, ComponentHandle());
 				return true;
 			}
 		}
@@ -140,19 +189,9 @@ bool ecsWorld::removeEntityComponent(const EntityHandle& entityHandle, const Com
 
 std::shared_ptr<ecsEntity> ecsWorld::getEntity(const EntityHandle& UUID) const
 {
-	std::function<std::shared_ptr<ecsEntity>(const EntityHandle&, const EntityMap&)> find_entity = [&](const EntityHandle& UUID, const EntityMap& entities) -> std::shared_ptr<ecsEntity> {
-		// First try to find in main map using built-in algorithm
-		const auto pos = entities.find(UUID);
-		if (pos != entities.end())
-			return pos->second;
-
-		// Next start searching children
-		for (auto& [handle, entity] : entities)
-			if (const auto& childEntity = find_entity(UUID, entity->m_children))
-				return childEntity;
-		return {};
-	};
-	return find_entity(UUID, m_entities);
+	if (const auto* entity = m_entityIndex.find(UUID))
+		return *entity;
+	return {};
 }
 
 std::vector<std::shared_ptr<ecsEntity>> ecsWorld::getEntities(const std::vector<EntityHandle>& uuids) const
@@ -178,39 +217,35 @@ std::vector<EntityHandle> ecsWorld::getEntityHandles(const EntityHandle& rootHan
 	return entityHandles;
 }
 
+EntityHandle ecsWorld::getNextEntityHandle(const EntityHandle& rootHandle, const EntityHandle& entityHandle) const
+{
+	const EntityMap* root = &m_entities;
+	if (rootHandle != EntityHandle())
+		if (const auto entity = getEntity(rootHandle))
+			root = &entity->m_children;
+	const auto next = entityHandle == EntityHandle() ? root->cbegin() : root->upper_bound(entityHandle);
+	return next == root->cend() ? EntityHandle() : next->first;
+}
+
 ecsBaseComponent* ecsWorld::getComponent(const EntityHandle& entityHandle, const ComponentID& componentID) const
 {
 	if (const auto entity = getEntity(entityHandle))
-		return getComponent(entity->m_components, m_components.at(componentID), componentID);
+		return getComponent(*entity, componentID);
 	return nullptr;
 }
 
 ecsBaseComponent* ecsWorld::getComponent(const ComponentHandle& componentHandle) const
 {
-	std::function<ecsBaseComponent * (const EntityMap&, const ComponentHandle&)> find_component = [&](const EntityMap& entities, const ComponentHandle& componentHandle) -> ecsBaseComponent* {
-		// Search all entities in the list supplied
-		for (const auto& [entityHandle, entity] : entities) {
-			// Check if this entity contains the component handle
-			for (const auto& [compID, fn, compHandle] : entity->m_components)
-				if (compHandle == componentHandle)
-					return (ecsBaseComponent*)(&(m_components.at(compID)[fn]));
-			// Check if this entity's children contain the component handle
-			if (auto* component = find_component(entity->m_children, componentHandle))
-				return component;
-		}
-		return nullptr;
-	};
-
-	return find_component(m_entities, componentHandle);
+	if (const auto* entry = m_componentIndex.find(componentHandle))
+		return getComponent(*entry->first, entry->second);
+	return nullptr;
 }
 
-ecsBaseComponent* ecsWorld::getComponent(const std::vector<std::tuple<ComponentID, int, ComponentHandle>>& entityComponents, const ComponentDataSpace& mem_array, const ComponentID& componentID) noexcept
+ecsBaseComponent* ecsWorld::getComponent(const ecsEntity& entity, const ComponentID& componentID) const noexcept
 {
-	for (const auto& entityComponent : entityComponents) {
-		const auto& [compId, fn, compHandle] = entityComponent;
+	for (const auto& [compId, column, compHandle] : entity.m_components)
 		if (componentID == compId)
-			return (ecsBaseComponent*)(&mem_array[fn]);
-	}
+			return m_archetypes[entity.m_archetypeIndex].getComponent(column, entity.m_archetypeRow);
 	return nullptr;
 }
 
@@ -222,8 +257,13 @@ ecsBaseComponent* ecsWorld::getComponent(const std::vector<std::tuple<ComponentI
 ecsWorld& ecsWorld::operator=(ecsWorld&& other) noexcept
 {
 	if (this != &other) {
-		m_components = std::move(other.m_components);
+		m_archetypes = std::move(other.m_archetypes);
+		m_archetypeMap = std::move(other.m_archetypeMap);
+		m_queries = std::move(other.m_queries);
+		m_queryStatistics = other.m_queryStatistics;
 		m_entities = std::move(other.m_entities);
+		m_entityIndex = std::move(other.m_entityIndex);
+		m_componentIndex = std::move(other.m_componentIndex);
 	}
 	return *this;
 }
@@ -231,36 +271,35 @@ ecsWorld& ecsWorld::operator=(ecsWorld&& other) noexcept
 void ecsWorld::clear()
 {
 	// Remove all components
-	for (auto& m_component : m_components) {
-		const auto& [createFn, freeFn, newFn, typeSize] = ecsBaseComponent::m_componentRegistry[m_component.first];
-		const auto componentContainerSize = m_component.second.size();
-		for (size_t i = 0; i < componentContainerSize; i += typeSize)
-			freeFn(reinterpret_cast<ecsBaseComponent*>(&m_component.second[i]));
-		m_component.second.clear();
-	}
-	m_components.clear();
+	for (auto& archetype : m_archetypes)
+		archetype.clear();
+	m_archetypes.clear();
+	m_archetypeMap.clear();
+	m_queries.clear();
 
 	// Remove all entities
 	m_entities.clear();
+	m_entityIndex.clear();
+	m_componentIndex.clear();
+}
+
+void ecsWorld::reserve(const size_t& entityCount, const size_t& componentCount)
+{
+	m_entityIndex.reserve(entityCount);
+	m_componentIndex.reserve(componentCount);
 }
 
 ecsHandle ecsWorld::generateUUID()
 {
-	std::stringstream ss;
-	for (auto i = 0; i < 16; i++) {
+	// Seed one engine per thread, instead of querying the OS entropy source for every handle
+	thread_local std::mt19937_64 generator = [] {
 		std::random_device rd;
-		std::mt19937 gen(rd());
-		const std::uniform_int_distribution<> dis(0, 255);
-		const auto rc = dis(gen);
-		std::stringstream hexstream;
-		hexstream << std::hex << rc;
-		const auto hex = hexstream.str();
-		ss << (hex.length() < 2 ? '0' + hex : hex);
-	}
-	const auto& string = ss.str();
-	ecsHandle handle;
-	std::copy(&string[0], &string[32], &handle.m_uuid[0]);
-	return handle;
+		std::seed_seq seed{ rd(), rd(), rd(), rd(), rd(), rd(), rd(), rd() };
+		return std::mt19937_64(seed);
+	}();
+	const auto high = generator();
+	const auto low = generator();
+	return ecsHandle(ecsBinaryHandle{ high, low });
 }
 
 void ecsWorld::parentEntity(const EntityHandle& parentHandle, const EntityHandle& childHandle)
@@ -332,33 +371,73 @@ bool ecsWorld::isComponentIDValid(const ComponentID& componentID) noexcept
 	return (componentID < ecsBaseComponent::m_componentRegistry.size());
 }
 
-void ecsWorld::deleteComponent(const ComponentID& componentID, const ComponentID& index)
+size_t ecsWorld::findOrMakeArchetype(const ComponentSignature& signature)
 {
-	if (isComponentIDValid(componentID)) {
-		auto& mem_array = m_components[componentID];
-		const auto& [createFn, freeFn, newFn, typeSize] = ecsBaseComponent::m_componentRegistry[componentID];
-		const auto srcIndex = mem_array.size() - typeSize;
+	if (const auto spot = m_archetypeMap.find(signature); spot != m_archetypeMap.end())
+		return spot->second;
+
+	const auto archetypeIndex = m_archetypes.size();
+	m_archetypes.emplace_back(signature);
+	m_archetypeMap.insert_or_assign(signature, archetypeIndex);
+
+	// Let existing queries start tracking the new archetype
+	for (auto& [componentTypes, query] : m_queries)
+		query.tryAddArchetype(archetypeIndex, m_archetypes[archetypeIndex]);
+	return archetypeIndex;
+}
 
-		const auto* srcComponent = reinterpret_cast<ecsBaseComponent*>(&mem_array[srcIndex]);
-		auto* destComponent = reinterpret_cast<ecsBaseComponent*>(&mem_array[index]);
-		freeFn(destComponent);
+void ecsWorld::migrateEntity(const EntityHandle& entityHandle, ecsEntity& entity, const ComponentSignature& signature, const ecsBaseComponent* const component, const ComponentHandle& componentHandle)
+{
+	const auto srcIndex = entity.m_archetypeIndex;
+	const auto srcRow = entity.m_archetypeRow;
+	auto destIndex = -1;
+	auto destRow = -1;
 
-		if (static_cast<size_t>(index) == srcIndex) {
-			mem_array.resize(srcIndex);
-			return;
+	// Move or create each component in the destination archetype
+	if (!signature.empty()) {
+		destIndex = static_cast<int>(findOrMakeArchetype(signature));
+		auto& destination = m_archetypes[destIndex];
+		destRow = static_cast<int>(destination.pushRow(entityHandle));
+		const auto columnCount = destination.m_signature.size();
+		for (size_t column = 0; column < columnCount; ++column) {
+			const auto& componentID = destination.m_signature[column];
+			const auto srcColumn = srcIndex >= 0 ? m_archetypes[srcIndex].findColumn(componentID) : -1;
+			if (srcColumn >= 0)
+				m_archetypes[srcIndex].relocateComponent(srcColumn, srcRow, destination, column);
+			else {
+				const auto& createFn = std::get<0>(ecsBaseComponent::m_componentRegistry[componentID]);
+				createFn(destination.m_columns[column], componentHandle, entityHandle, component);
+			}
 		}
-		*destComponent = *srcComponent;
-
-		// Update references
-		for (auto& component : getEntity(srcComponent->m_entity)->m_components) {
-			auto& [compID, fn, compHandle] = component;
-			if (componentID == compID && static_cast<ComponentID>(srcIndex) == fn) {
-				fn = index;
-				break;
+	}
+
+	// Remove the entity from its old archetype, freeing any components that weren't carried over
+	if (srcIndex >= 0) {
+		auto& source = m_archetypes[srcIndex];
+		const auto columnCount = source.m_signature.size();
+		for (size_t column = 0; column < columnCount; ++column) {
+			const auto& componentID = source.m_signature[column];
+			if (destIndex < 0 || m_archetypes[destIndex].findColumn(componentID) < 0) {
+				const auto& freeFn = std::get<1>(ecsBaseComponent::m_componentRegistry[componentID]);
+				freeFn(source.getComponent(column, srcRow));
 			}
 		}
-		mem_array.resize(srcIndex);
+		removeArchetypeRow(srcIndex, srcRow, false);
 	}
+
+	// Update the entity's references
+	entity.m_archetypeIndex = destIndex;
+	entity.m_archetypeRow = destRow;
+	for (auto& [compID, column, compHandle] : entity.m_components)
+		column = destIndex >= 0 ? m_archetypes[destIndex].findColumn(compID) : -1;
+}
+
+void ecsWorld::removeArchetypeRow(const int& archetypeIndex, const int& row, const bool& freeComponents)
+{
+	// Update the row of whichever entity got swapped into the removed spot
+	if (const auto movedHandle = m_archetypes[archetypeIndex].removeRow(row, freeComponents); movedHandle.isValid())
+		if (const auto movedEntity = getEntity(movedHandle))
+			movedEntity->m_archetypeRow = row;
 }
 
 std::vector<char> ecsWorld::serializeEntities(const std::vector<EntityHandle>& entityHandles) const
@@ -417,8 +496,8 @@ std::vector<char> ecsWorld::serializeEntity(const ecsEntity& entity) const
 	// dataIndex += sizeof(unsigned int); // dataIndex unused, so this can be omitted
 
 	// Accumulate entity component data count
-	for (const auto& [componentID, createFunc, componentHandle] : entity.m_components) {
-		if (const auto& component = getComponent(entity.m_components, m_components.at(componentID), componentID)) {
+	for (const auto& [componentID, column, componentHandle] : entity.m_components) {
+		if (const auto& component = getComponent(entity, componentID)) {
 			const auto componentData = component->to_buffer();
 			data.insert(data.end(), componentData.begin(), componentData.end());
 			entityDataCount += componentData.size();
@@ -487,6 +566,50 @@ void ecsWorld::deserializeEntity(const std::vector<char>& data, const size_t& da
 	}
 }
 
+std::vector<char> ecsWorld::serializeComponent(const ComponentHandle& componentHandle) const
+{
+	if (auto* component = getComponent(componentHandle))
+		return component->to_buffer();
+	return {};
+}
+
+bool ecsWorld::deserializeComponent(const ComponentHandle& componentHandle, const std::vector<char>& data)
+{
+	/* COMPONENT DATA STRUCTURE {
+		name char count
+		name chars
+		class data count
+		class data
+	} */
+	auto* component = getComponent(componentHandle);
+	int charCount(0);
+	if (component == nullptr || data.size() < sizeof(int))
+		return false;
+	std::memcpy(&charCount, &data[0], sizeof(int));
+	size_t dataRead = sizeof(int) + static_cast<size_t>(std::max(0, charCount));
+	size_t classDataSize(0ULL);
+	if (data.size() < dataRead + sizeof(size_t))
+		return false;
+	std::memcpy(&classDataSize, &data[dataRead], sizeof(size_t));
+	dataRead += sizeof(size_t);
+	if (data.size() < dataRead + classDataSize)
+		return false;
+
+	// Only recover data into a component of the same class
+	const auto componentTypeName = std::string(&data[sizeof(int)], static_cast<size_t>(std::max(0, charCount)));
+	const auto componentID = nameToComponentID(componentTypeName.c_str());
+	if (!componentID || *componentID != component->m_runtimeID)
+		return false;
+
+	// Recovering clears the handles, so restore them afterwards
+	const auto handle = component->m_handle;
+	const auto entity = component->m_entity;
+	component->recover_data(Serial_Data{ data.data() + dataRead, classDataSize });
+	component->m_handle = handle;
+	component->m_entity = entity;
+	return true;
+}
+
 std::optional<ComponentID> ecsWorld::nameToComponentID(const char* name)
 {
 	return ecsBaseComponent::m_nameRegistry.search(name);
@@ -507,9 +630,15 @@ void ecsWorld::updateSystems(ecsSystemList& systems, const float& deltaTime)
 		updateSystem(system.get(), deltaTime);
 }
 
+void ecsWorld::updateSystems(ecsSystemList& systems, const float& deltaTime, ecsScheduler& scheduler)
+{
+	scheduler.updateSystems(*this, systems, deltaTime);
+}
+
 void ecsWorld::updateSystem(ecsBaseSystem* system, const float& deltaTime)
 {
-	if (auto components = getRelevantComponents(system->getComponentTypes()); !components.empty())
+	PROFILE_ZONE("ecsSystem", system->getName());
+	if (const auto& components = getRelevantComponents(system->getComponentTypes()); !components.empty())
 		system->updateComponents(deltaTime, components);
 }
 
@@ -520,79 +649,39 @@ void ecsWorld::updateSystem(const std::shared_ptr<ecsBaseSystem>& system, const
 
 void ecsWorld::updateSystem(const float& deltaTime, const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes, const std::function<void(const float&, const std::vector<std::vector<ecsBaseComponent*>>&)>& func)
 {
-	if (auto components = getRelevantComponents(componentTypes); !components.empty())
+	if (const auto& components = getRelevantComponents(componentTypes); !components.empty())
 		func(deltaTime, components);
 }
 
-std::vector<std::vector<ecsBaseComponent*>> ecsWorld::getRelevantComponents(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes)
-{
-	std::vector<std::vector<ecsBaseComponent*>> components;
-	if (!componentTypes.empty()) {
-		const auto componentTypesCount = componentTypes.size();
-		if (componentTypesCount == 1U) {
-			// Super simple procedure for system with 1 component type
-			const auto& [componentID, componentFlag] = componentTypes[0];
-			const auto& [createFn, freeFn, newFn, typeSize] = ecsBaseComponent::m_componentRegistry[componentID];
-			const auto& mem_array = m_components[componentID];
-			const auto mem_arraySize = mem_array.size();
-			components.resize(mem_arraySize / typeSize);
-			for (size_t j = 0, k = 0; j < mem_arraySize; j += typeSize, ++k)
-				components[k].push_back((ecsBaseComponent*)(&mem_array[j]));
-		}
-		else {
-			// More complex procedure for system with > 1 component type
-			std::vector<ecsBaseComponent*> componentParam(componentTypesCount);
-			std::vector<ComponentDataSpace*> componentArrays(componentTypesCount);
-			for (size_t i = 0; i < componentTypesCount; ++i)
-				componentArrays[i] = &m_components[std::get<0>(componentTypes[i])];
-
-			const auto minSizeIndex = findLeastCommonComponent(componentTypes);
-			const auto minComponentID = std::get<0>(componentTypes[minSizeIndex]);
-			const auto& [createFn, freeFn, newFn, typeSize] = ecsBaseComponent::m_componentRegistry[minComponentID];
-			const auto& mem_array = *componentArrays[minSizeIndex];
-			const auto mem_arraySize = mem_array.size();
-			components.reserve(mem_arraySize / typeSize); // reserve, not resize, as the component at [i] may be invalid
-			for (size_t i = 0; i < mem_arraySize; i += typeSize) {
-				componentParam[minSizeIndex] = (ecsBaseComponent*)(&mem_array[i]);
-				if (const auto entity = getEntity(componentParam[minSizeIndex]->m_entity)) {
-					const auto& entityComponents = entity->m_components;
-
-					bool isValid = true;
-					for (size_t j = 0; j < componentTypesCount; ++j) {
-						const auto& [componentID, componentFlag] = componentTypes[j];
-						if (j == minSizeIndex)
-							continue;
-						componentParam[j] = getComponent(entityComponents, *componentArrays[j], componentID);
-						if ((componentParam[j] == nullptr) && (static_cast<unsigned int>(componentFlag) & static_cast<unsigned int>(ecsBaseSystem::RequirementsFlag::FLAG_OPTIONAL)) == 0) {
-							isValid = false;
-							break;
-						}
-					}
-					if (isValid)
-						components.push_back(componentParam);
-				}
-			}
-		}
-	}
-	return components;
+const ecsWorld::QueryStatistics& ecsWorld::getQueryStatistics() const noexcept
+{
+	return m_queryStatistics;
 }
 
-size_t ecsWorld::findLeastCommonComponent(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes)
+void ecsWorld::resetQueryStatistics() noexcept
 {
-	auto minSize = std::numeric_limits<size_t>::max();
-	auto minIndex = std::numeric_limits<size_t>::max();
-	const auto componentTypesCount = componentTypes.size();
-	for (size_t i = 0; i < componentTypesCount; ++i) {
-		const auto& [componentID, componentFlag] = componentTypes[i];
-		if ((static_cast<unsigned int>(componentFlag) & static_cast<unsigned int>(ecsBaseSystem::RequirementsFlag::FLAG_OPTIONAL)) != 0)
-			continue;
+	m_queryStatistics = QueryStatistics();
+}
 
-		const auto& [createFn, freeFn, newFn, typeSize] = ecsBaseComponent::m_componentRegistry[componentID];
-		const auto size = m_components[componentID].size() / typeSize;
-		if (size <= minSize) {
-			minSize = size;
-			minIndex = i;
-		}
+const std::vector<std::vector<ecsBaseComponent*>>& ecsWorld::getRelevantComponents(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes)
+{
+	// Find the persistent query for these component types, making it if it doesn't exist yet
+	auto spot = m_queries.find(componentTypes);
+	if (spot == m_queries.end()) {
+		++m_queryStatistics.m_misses;
+		spot = m_queries.emplace(componentTypes, ecsQuery(componentTypes)).first;
+		const auto archetypeCount = m_archetypes.size();
+		for (size_t i = 0; i < archetypeCount; ++i)
+			spot->second.tryAddArchetype(i, m_archetypes[i]);
+	}
+
+	// Only rewrite the query's components if its archetypes changed
+	auto& query = spot->second;
+	if (query.refresh(m_archetypes)) {
+		++m_queryStatistics.m_rebuilds;
+		m_queryStatistics.m_rewrittenRows += query.m_rewrittenRows;
 	}
-	return minIndex;
+	else
+		++m_queryStatistics.m_hits;
+	return query.m_components;
 }
\ No newline at end of file
@@ -2,14 +2,34 @@
 #ifndef ECS_WORLD_H
 #define ECS_WORLD_H
 
+#include "Modules/ECS/ecsArchetype.h"
 #include "Modules/ECS/ecsComponent.h"
 #include "Modules/ECS/ecsEntity.h"
+#include "Modules/ECS/ecsHandleIndex.h"
+#include "Modules/ECS/ecsQuery.h"
 #include "Modules/ECS/ecsSystem.h"
 
 
+// Forward Declarations
+class ecsScheduler;
+
 /** A set of ECS entities and components forming a single level. */
 class ecsWorld {
 public:
+	// Public Structures
+	/** Counters describing how often the cached system queries could be reused. */
+	struct QueryStatistics {
+		/** Number of queries reused as-is, with no membership changes. */
+		size_t m_hits = 0ULL;
+		/** Number of queries requested for the first time. */
+		size_t m_misses = 0ULL;
+		/** Number of queries rewritten because their archetypes changed. */
+		size_t m_rebuilds = 0ULL;
+		/** Number of rows rewritten across those queries, only covering the archetypes that changed. */
+		size_t m_rewrittenRows = 0ULL;
+	};
+
+
 	// Public (De)Constructors
 	/** Destroy this ECS World. */
 	~ecsWorld();
@@ -79,6 +99,11 @@ public:
 	@param	rootHandle			an root element to start fetching at (empty == map root).
 	@return						a vector of all level entities. */
 	std::vector<EntityHandle> getEntityHandles(const EntityHandle& rootHandle) const;
+	/** Retrieve the handle of the entity following another under the same root, in the same order as getEntityHandles().
+	@param	rootHandle			a root element holding both entities (empty == map root).
+	@param	entityHandle		the entity to follow (empty == start from the first entity).
+	@return						the following entity's handle, empty if there are none left. */
+	EntityHandle getNextEntityHandle(const EntityHandle& rootHandle, const EntityHandle& entityHandle) const;
 	/** Try to retrieve a component of a specific type from an entity matching the handle supplied.
 	@tparam	T					the category of component being retrieved.
 	@param	entityHandle		handle to the entity to retrieve from.
@@ -109,11 +134,10 @@ public:
 	@return						pointer to the found component on success, nullptr on failure. */
 	ecsBaseComponent* getComponent(const ComponentHandle& componentHandle) const;
 	/** Retrieve the component from an entity matching the class specified.
-	@param	entityComponents	the array of entity component IDS.
-	@param	mem_array			the array of component data.
+	@param	entity				the entity to retrieve from.
 	@param	componentID			the class ID of the component.
 	@return						the component pointer matching the ID specified. */
-	static ecsBaseComponent* getComponent(const std::vector<std::tuple<ComponentID, int, ComponentHandle>>& entityComponents, const ComponentDataSpace& mem_array, const ComponentID& componentID) noexcept;
+	ecsBaseComponent* getComponent(const ecsEntity& entity, const ComponentID& componentID) const noexcept;
 
 
 	////////////////////////
@@ -127,6 +151,10 @@ public:
 	inline ecsWorld& operator =(const ecsWorld&) noexcept = delete;
 	/** Clear the data out of this ecsWorld. */
 	void clear();
+	/** Make room ahead of time for a number of entities and components, such as before loading a level.
+	@param	entityCount			the number of entities expected.
+	@param	componentCount		the number of components expected. */
+	void reserve(const size_t& entityCount, const size_t& componentCount);
 	/** Generate a universally unique identifier for entities or components.
 	@return						a new ID. */
 	static ecsHandle generateUUID();
@@ -160,6 +188,15 @@ public:
 	@param	desiredHandle		specific handle to use. If empty will be updated with serialized value instead.
 	@param	parentHandle		optional handle to parent entity, designed to be called recursively if entity has children. */
 	void deserializeEntity(const std::vector<char>& data, const size_t& dataSize, size_t& dataRead, EntityHandle& desiredHandle, const EntityHandle& parentHandle);
+	/** Serialize a specific component to a char vector.
+	@param	componentHandle		handle to the component to serialize.
+	@return						char vector containing serialized component data, empty if the component doesn't exist. */
+	[[nodiscard]] std::vector<char> serializeComponent(const ComponentHandle& componentHandle) const;
+	/** Overwrite an existing component with previously serialized data of the same component class, keeping its handles.
+	@param	componentHandle		handle to the component to overwrite.
+	@param	data				previously serialized component data.
+	@return						true on success, false if the component doesn't exist or the data belongs to another class. */
+	bool deserializeComponent(const ComponentHandle& componentHandle, const std::vector<char>& data);
 	/** Try to find a component ID based on the component ID.
 	@param	name				the component class name to search for.
 	@return						optional component ID on success, nullptr on failure. */
@@ -172,6 +209,11 @@ public:
 	@param	systems				the systems to update.
 	@param	deltaTime			the delta time. */
 	void updateSystems(ecsSystemList& systems, const float& deltaTime);
+	/** Update the components of all systems provided, running concurrent systems on the scheduler's worker threads.
+	@param	systems				the systems to update.
+	@param	deltaTime			the delta time.
+	@param	scheduler			the scheduler to distribute the work with. */
+	void updateSystems(ecsSystemList& systems, const float& deltaTime, ecsScheduler& scheduler);
 	/** Update the components of a single system.
 	@param	system				the system to update.
 	@param	deltaTime			the delta time. */
@@ -185,9 +227,18 @@ public:
 	@param	componentTypes		list of component types to retrieve.
 	@param	func				lambda function serving as a system. */
 	void updateSystem(const float& deltaTime, const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes, const std::function<void(const float&, const std::vector<std::vector<ecsBaseComponent*>>&)>& func);
+	/** Retrieve the counters tracking system query reuse.
+	@return						the query statistics accumulated since the last reset. */
+	const QueryStatistics& getQueryStatistics() const noexcept;
+	/** Reset the counters tracking system query reuse. */
+	void resetQueryStatistics() noexcept;
 
 
 private:
+	/** Allow the scheduler to fetch system components ahead of dispatching them. */
+	friend class ecsScheduler;
+
+
 	// Private Methods
 	/** Disallow copying an ECS world. */
 	inline ecsWorld(const ecsWorld&) noexcept = delete;
@@ -195,22 +246,37 @@ private:
 	@param	componentID			the component ID to verify.
 	@return						true if valid and registered, false otherwise. */
 	static bool isComponentIDValid(const ComponentID& componentID) noexcept;
-	/** Delete a component matching the category ID supplied, at the given index.
-	@param	componentID			the component class/category ID.
-	@param	index				the component index to delete. */
-	void deleteComponent(const ComponentID& componentID, const ComponentID& index);
-	/** Retrieve the components relevant to an ECS system.
-	@param	componentTypes		list of component types to retrieve. */
-	[[nodiscard]] std::vector<std::vector<ecsBaseComponent*>> getRelevantComponents(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes);
-	/** Find the least common component.
-	@param	componentTypes		the component types.
-	@return						the byte-size of the least common component. */
-	size_t findLeastCommonComponent(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes);
+	/** Retrieve the archetype matching the component signature supplied, creating it if it doesn't exist yet.
+	@param	signature			sorted list of component types.
+	@return						the index of the matching archetype. */
+	size_t findOrMakeArchetype(const ComponentSignature& signature);
+	/** Move an entity's components into the archetype matching a new signature.
+	@note						components missing from the new signature are freed, new ones are constructed from the component supplied.
+	@param	entityHandle		handle to the entity to move.
+	@param	entity				the entity to move.
+	@param	signature			sorted list of component types the entity should now hold.
+	@param	component			optional component to copy any new component types from.
+	@param	componentHandle		handle to use for any new component. */
+	void migrateEntity(const EntityHandle& entityHandle, ecsEntity& entity, const ComponentSignature& signature, const ecsBaseComponent* const component, const ComponentHandle& componentHandle);
+	/** Remove a row from an archetype, swapping the last row into its place.
+	@param	archetypeIndex		the archetype to remove from.
+	@param	row					the row to remove.
+	@param	freeComponents		if true, destructs the row's components, otherwise assumes they've been relocated. */
+	void removeArchetypeRow(const int& archetypeIndex, const int& row, const bool& freeComponents);
+	/** Retrieve the components relevant to an ECS system, from a persistent query that is only rebuilt when its archetypes change.
+	@param	componentTypes		list of component types to retrieve.
+	@return						the cached components, valid until the next structural change to the world. */
+	[[nodiscard]] const std::vector<std::vector<ecsBaseComponent*>>& getRelevantComponents(const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>& componentTypes);
 
 
 	// Private Attributes
-	ComponentMap m_components;
+	std::vector<ecsArchetype> m_archetypes;
+	std::map<ComponentSignature, size_t> m_archetypeMap;
+	std::map<std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>>, ecsQuery> m_queries;
+	QueryStatistics m_queryStatistics;
 	EntityMap m_entities;
+	ecsHandleIndex<std::shared_ptr<ecsEntity>> m_entityIndex;
+	ecsHandleIndex<std::pair<ecsEntity*, ComponentID>> m_componentIndex;
 };
 
 #endif // ECS_WORLD_H
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "Modules/Editor/Editor_History.h"
+#include <algorithm>
+#include <cstring>
+#include <typeinfo>
+
+
+Component_Edit_Command::Component_Edit_Command(ecsWorld& world, const char* name, const std::vector<ComponentHandle>& componentHandles, const std::function<void(ecsBaseComponent&)>& edit)
+	: m_world(world), m_name(name), m_edit(edit)
+{
+	for (const auto& componentHandle : componentHandles)
+		m_deltas.try_emplace(componentHandle);
+}
+
+void Component_Edit_Command::execute()
+{
+	// The first time through, perform the edit and keep only what it changed
+	if (m_edit) {
+		for (auto delta = m_deltas.begin(); delta != m_deltas.end();) {
+			auto* component = m_world.getComponent(delta->first);
+			if (component == nullptr) {
+				delta = m_deltas.erase(delta);
+				continue;
+			}
+			const auto before = component->to_buffer();
+			m_edit(*component);
+			delta->second = Binary_Delta::Diff(before, component->to_buffer());
+			++delta;
+		}
+		m_edit = nullptr;
+	}
+	else
+		switchData(true);
+}
+
+void Component_Edit_Command::undo()
+{
+	switchData(false);
+}
+
+bool Component_Edit_Command::join(Editor_Command* newerCommand)
+{
+	if (const auto* newCommand = dynamic_cast<Component_Edit_Command*>(newerCommand)) {
+		// Only continue the same edit of the same components
+		if (std::strcmp(m_name, newCommand->m_name) == 0 && m_deltas.size() == newCommand->m_deltas.size() &&
+			std::equal(m_deltas.cbegin(), m_deltas.cend(), newCommand->m_deltas.cbegin(), [](const auto& a, const auto& b) { return a.first == b.first; }))
+			return coalesce(newerCommand);
+	}
+	return false;
+}
+
+bool Component_Edit_Command::coalesce(Editor_Command* newerCommand)
+{
+	if (const auto* newCommand = dynamic_cast<Component_Edit_Command*>(newerCommand)) {
+		if (&m_world != &newCommand->m_world)
+			return false;
+
+		// Nothing happened in between, so each component's data picks up where our delta left off
+		for (const auto& [componentHandle, newDelta] : newCommand->m_deltas) {
+			const auto [delta, inserted] = m_deltas.try_emplace(componentHandle, newDelta);
+			if (!inserted) {
+				delta->second.merge(newDelta);
+				if (delta->second.empty())
+					m_deltas.erase(delta);
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
+size_t Component_Edit_Command::getMemoryUsage() const noexcept
+{
+	// Each delta also costs a map node, roughly its key and three pointers
+	size_t memoryUsage = sizeof(*this);
+	for (const auto& [componentHandle, delta] : m_deltas)
+		memoryUsage += sizeof(componentHandle) + (3ULL * sizeof(void*)) + delta.getMemoryUsage();
+	return memoryUsage;
+}
+
+void Component_Edit_Command::switchData(const bool& forward)
+{
+	for (const auto& [componentHandle, delta] : m_deltas) {
+		auto data = m_world.serializeComponent(componentHandle);
+		if (!data.empty()) {
+			if (forward)
+				delta.apply(data);
+			else
+				delta.revert(data);
+			m_world.deserializeComponent(componentHandle, data);
+		}
+	}
+}
+
+void Editor_History::perform(const std::shared_ptr<Editor_Command>& command)
+{
+	// Clear the redo stack
+	for (const auto& entry : m_redoStack)
+		m_memoryUsage -= entry.m_memoryUsage;
+	m_redoStack = {};
+
+	// Perform the desired action
+	command->execute();
+	++m_version;
+
+	// Try to join the new command into the previous one if the types match, it may grow in doing so
+	if (!m_undoStack.empty() && typeid(m_undoStack.front().m_command) == typeid(command) && m_undoStack.front().m_command->join(command.get())) {
+		auto& entry = m_undoStack.front();
+		m_memoryUsage -= entry.m_memoryUsage;
+		entry.m_memoryUsage = entry.m_command->getMemoryUsage();
+		m_memoryUsage += entry.m_memoryUsage;
+	}
+	// Otherwise add action to the undo stack
+	else {
+		m_undoStack.push_front({ command, command->getMemoryUsage() });
+		m_memoryUsage += m_undoStack.front().m_memoryUsage;
+	}
+
+	trim();
+}
+
+bool Editor_History::undo()
+{
+	if (canUndo()) {
+		// Undo the last action
+		if (const auto& command = m_undoStack.front().m_command)
+			command->undo();
+		++m_version;
+
+		// Move the action onto the redo stack
+		m_redoStack.push_front(m_undoStack.front());
+		m_undoStack.pop_front();
+		return true;
+	}
+	return false;
+}
+
+bool Editor_History::redo()
+{
+	if (canRedo()) {
+		// Redo the last action
+		if (const auto& command = m_redoStack.front().m_command)
+			command->execute();
+		++m_version;
+
+		// Push the action onto the undo stack
+		m_undoStack.push_front(m_redoStack.front());
+		m_redoStack.pop_front();
+		return true;
+	}
+	return false;
+}
+
+bool Editor_History::canUndo() const noexcept
+{
+	return !m_undoStack.empty();
+}
+
+bool Editor_History::canRedo() const noexcept
+{
+	return !m_redoStack.empty();
+}
+
+void Editor_History::clear() noexcept
+{
+	m_undoStack = {};
+	m_redoStack = {};
+	m_memoryUsage = 0ULL;
+	++m_version;
+}
+
+void Editor_History::setLimits(const size_t& maxActions, const size_t& maxMemory)
+{
+	m_maxActions = std::max<size_t>(1ULL, maxActions);
+	m_maxMemory = maxMemory;
+	trim();
+}
+
+size_t Editor_History::getUndoCount() const noexcept
+{
+	return m_undoStack.size();
+}
+
+size_t Editor_History::getMemoryUsage() const noexcept
+{
+	return m_memoryUsage;
+}
+
+size_t Editor_History::getVersion() const noexcept
+{
+	return m_version;
+}
+
+void Editor_History::trim()
+{
+	// Redo-able actions furthest from the present are the least likely to be needed
+	while (!m_redoStack.empty() && m_memoryUsage > m_maxMemory) {
+		m_memoryUsage -= m_redoStack.back().m_memoryUsage;
+		m_redoStack.pop_back();
+	}
+
+	// Fold the oldest actions together, or into the level, but always keep the latest one undo-able on its own
+	while (m_undoStack.size() > 1ULL && (m_undoStack.size() > m_maxActions || m_memoryUsage > m_maxMemory)) {
+		auto& oldest = m_undoStack.back();
+		const auto& nextOldest = m_undoStack[m_undoStack.size() - 2ULL];
+		const auto pairUsage = oldest.m_memoryUsage + nextOldest.m_memoryUsage;
+		const auto largestUsage = std::max(oldest.m_memoryUsage, nextOldest.m_memoryUsage);
+		if (m_undoStack.size() > 2ULL && oldest.m_command->coalesce(nextOldest.m_command.get())) {
+			m_memoryUsage -= pairUsage;
+			oldest.m_memoryUsage = oldest.m_command->getMemoryUsage();
+			m_memoryUsage += oldest.m_memoryUsage;
+			m_undoStack.erase(m_undoStack.end() - 2);
+
+			// Keep the merge if it absorbed at least half of the smaller command
+			// Unrelated edits don't overlap, so forget them rather than merging everything into one huge step
+			const auto mergedUsage = m_undoStack.back().m_memoryUsage;
+			if (m_memoryUsage <= m_maxMemory || (mergedUsage * 2ULL) <= pairUsage + largestUsage)
+				continue;
+		}
+		m_memoryUsage -= m_undoStack.back().m_memoryUsage;
+		m_undoStack.pop_back();
+	}
+}
+
+bool Editor_Command::join(Editor_Command* /*unused*/)
+{
+	return false;
+}
+
+bool Editor_Command::coalesce(Editor_Command* /*unused*/)
+{
+	return false;
+}
+
+size_t Editor_Command::getMemoryUsage() const noexcept
+{
+	return sizeof(*this);
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+#ifndef EDITOR_HISTORY_H
+#define EDITOR_HISTORY_H
+
+#include "Modules/ECS/ecsWorld.h"
+#include "Utilities/Binary_Delta.h"
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+
+
+/** A command used by the level editor. Follows the Command Design Pattern.
+To be sub-classed where needed, typically within the scope of a specialized function. */
+struct Editor_Command {
+	// Public Interface
+	inline virtual ~Editor_Command() = default;
+	/** Default constructor. */
+	inline Editor_Command() noexcept = default;
+	/** Move constructor. */
+	inline Editor_Command(Editor_Command&&) noexcept = default;
+	/** Copy constructor. */
+	inline Editor_Command(const Editor_Command&) noexcept = default;
+	/** Move assignment. */
+	inline Editor_Command& operator =(Editor_Command&&) noexcept = default;
+	/** Copy assignment. */
+	inline Editor_Command& operator =(const Editor_Command&) noexcept = default;
+	/** Perform the command. */
+	virtual void execute() = 0;
+	/** Perform the reverse, undo the command. */
+	virtual void undo() = 0;
+	/** Join into this command the data found in another newer command.
+	@param	newerCommand	the newer of the two commands, to take data from.
+	@return					true if this command supports & successfully joined with a newer command, false otherwise. */
+	virtual bool join(Editor_Command* newerCommand);
+	/** Fold into this command the command performed right after it, so both undo as a single step.
+	Used to shrink old history, so unlike join() it isn't limited to continuing the same edit.
+	@param	newerCommand	the newer of the two commands, to take data from.
+	@return					true if this command now also holds the newer command's changes, false otherwise. */
+	virtual bool coalesce(Editor_Command* newerCommand);
+	/** Retrieve roughly how much memory this command holds onto, for budgeting the undo history.
+	@return					the command's size in bytes. */
+	virtual size_t getMemoryUsage() const noexcept;
+};
+
+/** A command changing the data of existing components.
+Only the bytes of the serialized fields that changed are kept, everything else is left to the world. */
+struct Component_Edit_Command final : Editor_Command {
+	// Public (De)Constructors
+	/** Construct a component edit command.
+	@param	world				the world holding the components.
+	@param	name				name of the edit, newer edits of the same name and components join into this one.
+	@param	componentHandles	the components to edit.
+	@param	edit				function changing a single component, called once per component on first execution. */
+	Component_Edit_Command(ecsWorld& world, const char* name, const std::vector<ComponentHandle>& componentHandles, const std::function<void(ecsBaseComponent&)>& edit);
+
+
+	// Public Interface Implementation
+	void execute() final;
+	void undo() final;
+	bool join(Editor_Command* newerCommand) final;
+	bool coalesce(Editor_Command* newerCommand) final;
+	size_t getMemoryUsage() const noexcept final;
+
+
+private:
+	// Private Methods
+	/** Switch every edited component to its old or new data.
+	@param	forward			true to switch to the new data, false to switch back to the old. */
+	void switchData(const bool& forward);
+
+
+	// Private Attributes
+	ecsWorld& m_world;
+	const char* m_name;
+	std::function<void(ecsBaseComponent&)> m_edit;
+	/** Each edited component's delta between its serialized data before and after the edit. */
+	std::map<ComponentHandle, Binary_Delta> m_deltas;
+};
+
+/** Keeps the level editor's undo-able and redo-able commands within an action count and a memory budget.
+Once over either limit, the oldest adjacent commands are coalesced where they support it, and forgotten otherwise. */
+class Editor_History {
+public:
+	// Public Methods
+	/** Perform a command and make it undo-able, joining it into the latest command where possible.
+	@param	command			the command to perform. */
+	void perform(const std::shared_ptr<Editor_Command>& command);
+	/** Undo the latest command.
+	@return					true if a command was undone, false otherwise. */
+	bool undo();
+	/** Redo the latest undone command.
+	@return					true if a command was redone, false otherwise. */
+	bool redo();
+	/** Retrieve if we have any undo-able actions.
+	@return					true if able to undo, false otherwise. */
+	bool canUndo() const noexcept;
+	/** Retrieve if we have any redo-able actions.
+	@return					true if able to redo, false otherwise. */
+	bool canRedo() const noexcept;
+	/** Forget all undo-able and redo-able actions. */
+	void clear() noexcept;
+	/** Change how many actions and how much memory the history may hold, trimming it to fit.
+	@param	maxActions		the most undo-able actions to keep.
+	@param	maxMemory		the most bytes all kept actions may use. */
+	void setLimits(const size_t& maxActions, const size_t& maxMemory);
+	/** Retrieve how many undo-able actions are kept.
+	@return					the undo-able action count. */
+	size_t getUndoCount() const noexcept;
+	/** Retrieve roughly how much memory all kept actions use.
+	@return					the history's size in bytes. */
+	size_t getMemoryUsage() const noexcept;
+	/** Retrieve a number that changes whenever a command performs, undoes, or redoes, or the history is cleared for a new level.
+	@return					the level's current version. */
+	size_t getVersion() const noexcept;
+
+
+private:
+	// Private Methods
+	/** Forget redo-able actions furthest from the present, then coalesce or forget the oldest undo-able ones, until the history fits within its limits. */
+	void trim();
+
+
+	// Private Structures
+	/** A kept command, along with its memory usage when last measured. */
+	struct Entry {
+		std::shared_ptr<Editor_Command> m_command;
+		size_t m_memoryUsage = 0ULL;
+	};
+
+
+	// Private Attributes
+	std::deque<Entry> m_undoStack, m_redoStack;
+	size_t m_maxActions = 500ULL, m_maxMemory = 64ULL * 1024ULL * 1024ULL, m_memoryUsage = 0ULL, m_version = 0ULL;
+};
+
+#endif // EDITOR_HISTORY_H
\ No newline at end of file
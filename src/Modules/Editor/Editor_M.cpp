@@ -7,8 +7,10 @@
 #include "Modules/Editor/Systems/Outline_System.h"
 #include "Modules/ECS/component_types.h"
 #include "Utilities/IO/Level_IO.h"
+#include "Utilities/Profiler.h"
 #include "Engine.h"
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 
@@ -59,10 +61,19 @@ void LevelEditor_Module::initialize()
 		});
 	float undoStacksize = 500.0F;
 	preferences.getOrSetValue(PreferenceState::Preference::E_UNDO_STACKSIZE, undoStacksize);
-	m_maxUndo = int(undoStacksize);
-	preferences.addCallback(PreferenceState::Preference::E_UNDO_STACKSIZE, m_aliveIndicator, [&](const float& f) noexcept {
-		m_maxUndo = int(f);
+	m_maxUndo = static_cast<size_t>(std::max(1.0F, undoStacksize));
+	preferences.addCallback(PreferenceState::Preference::E_UNDO_STACKSIZE, m_aliveIndicator, [&](const float& f) {
+		m_maxUndo = static_cast<size_t>(std::max(1.0F, f));
+		m_history.setLimits(m_maxUndo, m_maxUndoMemory);
 		});
+	float undoMemory = 64.0F;
+	preferences.getOrSetValue(PreferenceState::Preference::E_UNDO_MEMORY, undoMemory);
+	m_maxUndoMemory = static_cast<size_t>(std::max(1.0F, undoMemory)) * 1024ULL * 1024ULL;
+	preferences.addCallback(PreferenceState::Preference::E_UNDO_MEMORY, m_aliveIndicator, [&](const float& f) {
+		m_maxUndoMemory = static_cast<size_t>(std::max(1.0F, f)) * 1024ULL * 1024ULL;
+		m_history.setLimits(m_maxUndo, m_maxUndoMemory);
+		});
+	m_history.setLimits(m_maxUndo, m_maxUndoMemory);
 
 	// GL structures
 	glCreateFramebuffers(1, &m_fboID);
@@ -89,6 +100,7 @@ void LevelEditor_Module::deinitialize()
 
 	// Update indicator
 	*m_aliveIndicator = false;
+	waitForAutosave();
 	m_systemSelClearer.reset();
 	m_systemOutline.reset();
 
@@ -99,6 +111,7 @@ void LevelEditor_Module::deinitialize()
 
 void LevelEditor_Module::frameTick(const float& deltaTime)
 {
+	PROFILE_ZONE("Module", "LevelEditor_Module::frameTick");
 	if (m_active) {
 		constexpr GLfloat clearColor[] = { 0.0F, 0.0F, 0.0F, 0.0F };
 		constexpr GLfloat clearDepth = 1.0F;
@@ -145,16 +158,23 @@ void LevelEditor_Module::frameTick(const float& deltaTime)
 		// Auto-save
 		if (hasUnsavedChanges()) {
 			m_autoSaveCounter += deltaTime;
-			if (m_autoSaveCounter > m_autosaveInterval) {
-				m_autoSaveCounter -= m_autosaveInterval;
-				m_engine.getManager_Messages().statement("Autosaving Map...");
-				std::filesystem::path currentPath(m_currentLevelName);
-				currentPath.replace_extension(".autosave");
-				saveLevel_Internal(currentPath.string());
+			// Postpone while the previous autosave is still being taken or written
+			const bool autosaveBusy = m_autosaveSnapshot.isActive() || (m_autosave.valid() && m_autosave.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+			if (m_autoSaveCounter > m_autosaveInterval && !autosaveBusy) {
+				m_autoSaveCounter = std::fmod(m_autoSaveCounter, m_autosaveInterval);
+				m_engine.getManager_Messages().statement("Autosaving Map...", Message_Category::EDITOR);
+				m_autosaveSnapshot.begin(m_history.getVersion());
 			}
+
+			// Serialize a slice of the level per frame, starting over whenever it changes, then write it once complete
+			constexpr auto autosaveBudget = std::chrono::microseconds(2000);
+			if (m_autosaveSnapshot.isActive() && m_autosaveSnapshot.step(m_world, m_history.getVersion(), autosaveBudget))
+				autosaveLevel();
 		}
-		else
+		else {
 			m_autoSaveCounter = 0.0F;
+			m_autosaveSnapshot.cancel();
+		}
 	}
 }
 
@@ -194,7 +214,7 @@ void LevelEditor_Module::toggleAddToSelection(const EntityHandle& entityHandle)
 
 bool LevelEditor_Module::hasCopy() const noexcept
 {
-	return !m_copiedData.empty();
+	return m_copiedData && !m_copiedData->empty();
 }
 
 void LevelEditor_Module::openSceneInspector() noexcept
@@ -212,6 +232,11 @@ void LevelEditor_Module::openPrefabs() noexcept
 	m_editorInterface.m_uiPrefabs->open();
 }
 
+void LevelEditor_Module::openProfiler() noexcept
+{
+	m_editorInterface.m_uiProfiler->open();
+}
+
 void LevelEditor_Module::showEditor()
 {
 	m_active = true;
@@ -236,8 +261,7 @@ void LevelEditor_Module::exit()
 		m_engine.goToMainMenu();
 		m_currentLevelName = "My Map.bmap";
 		m_unsavedChanges = false;
-		m_undoStack = {};
-		m_redoStack = {};
+		m_history.clear();
 		m_active = false;
 		});
 }
@@ -271,8 +295,7 @@ void LevelEditor_Module::newLevel()
 
 		// Starting new level, changes will be discarded
 		m_unsavedChanges = false;
-		m_undoStack = {};
-		m_redoStack = {};
+		m_history.clear();
 		});
 }
 
@@ -288,14 +311,13 @@ void LevelEditor_Module::openLevel(const std::string& name)
 	// Otherwise, try opening the level
 	else {
 		if (Level_IO::Import_BMap(name, m_world)) {
-			m_undoStack = {};
-			m_redoStack = {};
+			m_history.clear();
 			m_unsavedChanges = false;
 			m_currentLevelName = name;
 			addToRecentList(name);
 		}
 		else
-			m_engine.getManager_Messages().error("Cannot open the level: " + name);
+			m_engine.getManager_Messages().error("Cannot open the level: " + name, Message_Category::EDITOR);
 	}
 }
 
@@ -317,7 +339,8 @@ void LevelEditor_Module::saveLevel(const std::string& name)
 		saveLevel_Internal(m_currentLevelName);
 		addToRecentList(m_currentLevelName);
 
-		// Delete Autosaves
+		// Delete Autosaves, after any pending one lands
+		waitForAutosave();
 		std::filesystem::path currentPath(m_currentLevelName);
 		if (currentPath.has_extension() && currentPath.extension() != ".autosave") {
 			currentPath.replace_extension(".autosave");
@@ -333,9 +356,29 @@ void LevelEditor_Module::saveLevel(const std::string& name)
 void LevelEditor_Module::saveLevel_Internal(const std::string& name)
 {
 	if (Level_IO::Export_BMap(name, m_world))
-		m_engine.getManager_Messages().statement("Level saved successfully.");
+		m_engine.getManager_Messages().statement("Level saved successfully.", Message_Category::EDITOR);
 	else
-		m_engine.getManager_Messages().error("Cannot save the level: " + name);
+		m_engine.getManager_Messages().error("Cannot save the level: " + name, Message_Category::EDITOR);
+}
+
+void LevelEditor_Module::autosaveLevel()
+{
+	std::filesystem::path currentPath(m_currentLevelName);
+	currentPath.replace_extension(".autosave");
+
+	// The snapshot was serialized over previous frames, joining, converting, and writing to disk happens in the background
+	m_autosave = std::async(std::launch::async, [&messageManager = m_engine.getManager_Messages(), name = currentPath.string(), slices = m_autosaveSnapshot.take()] {
+		if (Level_IO::Export_Entity_Data(name, Level_Snapshot::Join(slices)))
+			messageManager.statement("Level saved successfully.", Message_Category::EDITOR);
+		else
+			messageManager.error("Cannot save the level: " + name, Message_Category::EDITOR);
+		});
+}
+
+void LevelEditor_Module::waitForAutosave()
+{
+	if (m_autosave.valid())
+		m_autosave.get();
 }
 
 void LevelEditor_Module::saveLevel()
@@ -355,64 +398,31 @@ void LevelEditor_Module::openSettingsDialogue() noexcept
 
 bool LevelEditor_Module::canUndo() const noexcept
 {
-	return !m_undoStack.empty();
+	return m_history.canUndo();
 }
 
 bool LevelEditor_Module::canRedo() const noexcept
 {
-	return !m_redoStack.empty();
+	return m_history.canRedo();
 }
 
 void LevelEditor_Module::undo()
 {
-	if (canUndo()) {
-		// Undo the last action
-		if (auto& element = m_undoStack.front()) {
-			element->undo();
-
-			// Move the action onto the redo stack
-			m_redoStack.push_front(element);
-			m_undoStack.pop_front();
-		}
-
-		// Set unsaved changes all the time
+	// Set unsaved changes all the time
+	if (m_history.undo())
 		m_unsavedChanges = true;
-	}
 }
 
 void LevelEditor_Module::redo()
 {
-	if (canRedo()) {
-		// Redo the last action
-		if (auto& element = m_redoStack.front()) {
-			element->execute();
-
-			// Push the action onto the undo stack
-			m_undoStack.push_front(element);
-			m_redoStack.pop_front();
-		}
-
-		// Set unsaved changes unless we have no more redo actions
+	// Set unsaved changes unless we have no more redo actions
+	if (m_history.redo())
 		m_unsavedChanges = canRedo();
-	}
 }
 
 void LevelEditor_Module::doReversableAction(const std::shared_ptr<Editor_Command>& command)
 {
-	// Clear the redo stack
-	m_redoStack = {};
-
-	// Perform the desired action
-	command->execute();
-
-	// Try to join the new command into the previous one if the types match
-	if (!m_undoStack.empty() && typeid(m_undoStack.front()) == typeid(command) && m_undoStack.front()->join(command.get())) {}
-	// Otherwise add action to the undo stack
-	else
-		m_undoStack.push_front(command);
-
-	while (m_undoStack.size() > m_maxUndo)
-		m_undoStack.pop_back();
+	m_history.perform(command);
 	m_unsavedChanges = true;
 }
 
@@ -427,7 +437,7 @@ void LevelEditor_Module::addToRecentList(const std::string& name)
 	// Dump recent-list data to disk
 	std::ofstream file(Engine::Get_Current_Dir() + "\\Maps\\recent.editor", std::ios::beg);
 	if (!file.is_open())
-		m_engine.getManager_Messages().error("Cannot write the recent level list to disk!");
+		m_engine.getManager_Messages().error("Cannot write the recent level list to disk!", Message_Category::EDITOR);
 	else
 		for (const auto& level : m_recentLevels)
 			file << level << "\n";
@@ -440,7 +450,7 @@ void LevelEditor_Module::populateRecentList()
 	m_recentLevels.clear();
 	std::ifstream file(Engine::Get_Current_Dir() + "\\Maps\\recent.editor", std::ios::beg);
 	if (!file.is_open())
-		m_engine.getManager_Messages().error("Cannot read the recent level list from disk!");
+		m_engine.getManager_Messages().error("Cannot read the recent level list from disk!", Message_Category::EDITOR);
 	else {
 		std::string level;
 		while (std::getline(file, level))
@@ -527,6 +537,9 @@ void LevelEditor_Module::clearSelection()
 		bool join(Editor_Command* other) noexcept final {
 			return dynamic_cast<Clear_Selection_Command*>(other) != nullptr;
 		}
+		size_t getMemoryUsage() const noexcept final {
+			return sizeof(*this) + (m_uuids_old.capacity() * sizeof(EntityHandle));
+		}
 	};
 
 	if (!getSelection().empty())
@@ -593,6 +606,9 @@ void LevelEditor_Module::setSelection(const std::vector<EntityHandle>& handles)
 			}
 			return false;
 		}
+		size_t getMemoryUsage() const noexcept final {
+			return sizeof(*this) + ((m_uuids_new.capacity() + m_uuids_old.capacity()) * sizeof(EntityHandle));
+		}
 	};
 
 	if (!handles.empty())
@@ -749,17 +765,19 @@ void LevelEditor_Module::cutSelection()
 
 void LevelEditor_Module::copySelection()
 {
-	m_copiedData.clear();
+	std::vector<char> copiedData;
 	const auto& ecsWorld = getWorld();
 	for (const auto& entityHandle : getSelection()) {
 		const auto entData = ecsWorld.serializeEntity(entityHandle);
-		m_copiedData.insert(m_copiedData.end(), entData.begin(), entData.end());
+		copiedData.insert(copiedData.end(), entData.begin(), entData.end());
 	}
+	// Shared with every paste command, rather than copied into each of them
+	m_copiedData = std::make_shared<const std::vector<char>>(std::move(copiedData));
 }
 
 void LevelEditor_Module::paste()
 {
-	if (!m_copiedData.empty())
+	if (hasCopy())
 		addEntity(m_copiedData);
 }
 
@@ -787,6 +805,9 @@ void LevelEditor_Module::deleteSelection()
 				ecsWorld.deserializeEntity(m_data, m_data.size(), dataRead, desiredHandle, parentHandle);
 			}
 		}
+		size_t getMemoryUsage() const noexcept final {
+			return sizeof(*this) + m_data.capacity() + (m_uuids.capacity() * sizeof(EntityHandle));
+		}
 	};
 
 	auto& selection = m_mouseGizmo.getSelection();
@@ -851,6 +872,9 @@ void LevelEditor_Module::deleteComponent(const EntityHandle& entityHandle, const
 				m_editor.getWorld().makeComponent(m_entityHandle, copy.get(), m_componentHandle);
 			}
 		}
+		size_t getMemoryUsage() const noexcept final {
+			return sizeof(*this) + m_componentData.capacity();
+		}
 	};
 
 	if (const auto* component = getWorld().getComponent(entityHandle, componentID))
@@ -858,15 +882,21 @@ void LevelEditor_Module::deleteComponent(const EntityHandle& entityHandle, const
 }
 
 void LevelEditor_Module::addEntity(const std::vector<char>& entityData, const EntityHandle& parentUUID)
+{
+	if (!entityData.empty())
+		addEntity(std::make_shared<const std::vector<char>>(entityData), parentUUID);
+}
+
+void LevelEditor_Module::addEntity(const std::shared_ptr<const std::vector<char>>& entityData, const EntityHandle& parentUUID)
 {
 	struct Spawn_Command final : Editor_Command {
 		Engine& m_engine;
 		LevelEditor_Module& m_editor;
-		const std::vector<char> m_data;
+		const std::shared_ptr<const std::vector<char>> m_data;
 		const EntityHandle m_parentUUID;
 		const Transform m_cursor;
 		std::vector<EntityHandle> m_uuids;
-		Spawn_Command(Engine& engine, LevelEditor_Module& editor, const std::vector<char>& data, const EntityHandle& pUUID)
+		Spawn_Command(Engine& engine, LevelEditor_Module& editor, const std::shared_ptr<const std::vector<char>>& data, const EntityHandle& pUUID)
 			: m_engine(engine), m_editor(editor), m_data(data), m_parentUUID(pUUID), m_cursor(m_editor.getSpawnTransform()) {}
 		void execute() final {
 			auto& ecsWorld = m_editor.getWorld();
@@ -874,11 +904,12 @@ void LevelEditor_Module::addEntity(const std::vector<char>& entityData, const En
 			size_t handleCount(0ULL);
 			glm::vec3 center(0.0F);
 			std::vector<Transform_Component*> transformComponents;
-			while (dataRead < m_data.size()) {
+			const auto& data = *m_data;
+			while (dataRead < data.size()) {
 				// Ensure we have a vector large enough to hold all UUIDs, but maintain previous data
 				m_uuids.resize(std::max<size_t>(m_uuids.size(), handleCount + 1ULL));
 				auto entityHandle = m_uuids[handleCount].isValid() ? m_uuids[handleCount] : EntityHandle(ecsWorld::generateUUID());
-				ecsWorld.deserializeEntity(m_data, m_data.size(), dataRead, entityHandle, m_parentUUID);
+				ecsWorld.deserializeEntity(data, data.size(), dataRead, entityHandle, m_parentUUID);
 				if (entityHandle.isValid() && ecsWorld.getEntity(entityHandle)) {
 					if (auto* transform = ecsWorld.getComponent<Transform_Component>(entityHandle)) {
 						transformComponents.push_back(transform);
@@ -901,9 +932,13 @@ void LevelEditor_Module::addEntity(const std::vector<char>& entityData, const En
 			for (const auto& entityHandle : m_uuids)
 				ecsWorld.removeEntity(entityHandle);
 		}
+		size_t getMemoryUsage() const noexcept final {
+			// The serialized data may be shared with the clipboard and other pastes, so only count our share of it
+			return sizeof(*this) + (m_uuids.capacity() * sizeof(EntityHandle)) + (m_data->capacity() / static_cast<size_t>(std::max(1L, m_data.use_count())));
+		}
 	};
 
-	if (!entityData.empty())
+	if (entityData && !entityData->empty())
 		doReversableAction(std::make_shared<Spawn_Command>(m_engine, *this, entityData, parentUUID));
 }
 
@@ -915,9 +950,4 @@ void LevelEditor_Module::bindFBO() noexcept
 void LevelEditor_Module::bindTexture(const GLuint& offset) noexcept
 {
 	glBindTextureUnit(offset, m_texID);
-}
-
-bool Editor_Command::join(Editor_Command* /*unused*/)
-{
-	return false;
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include "Modules/Engine_Module.h"
 #include "Modules/ECS/ecsWorld.h"
+#include "Modules/Editor/Editor_History.h"
+#include "Modules/Editor/Level_Snapshot.h"
 #include "Modules/Editor/Gizmos/Mouse.h"
 #include "Modules/Editor/UI/Editor_Interface.h"
 #include "Assets/Auto_Model.h"
@@ -11,11 +13,11 @@
 #include "Utilities/Transform.h"
 #include "Utilities/GL/IndirectDraw.h"
 #include <deque>
+#include <future>
 
 
 // Forward Declarations
 class Editor_Interface;
-struct Editor_Command;
 
 /** A level editor module. */
 class LevelEditor_Module final : public Engine_Module {
@@ -115,6 +117,10 @@ public:
 	@param	entityData		the serialized entity data.
 	@param	parentUUID		optional parent's handle. */
 	void addEntity(const std::vector<char>& entityData, const EntityHandle& parentUUID = EntityHandle());
+	/** Spawn a serialized entity into the level, sharing its data with the undo history rather than copying it.
+	@param	entityData		the serialized entity data.
+	@param	parentUUID		optional parent's handle. */
+	void addEntity(const std::shared_ptr<const std::vector<char>>& entityData, const EntityHandle& parentUUID = EntityHandle());
 	/** Bind the editor's FBO to the currently active GL context, for rendering. */
 	void bindFBO() noexcept;
 	/** Bind the editor's screen texture to the currently active GL context.
@@ -144,6 +150,8 @@ public:
 	void openEntityInspector() noexcept;
 	/** Make the prefabs window visible. */
 	void openPrefabs() noexcept;
+	/** Make the profiler window visible. */
+	void openProfiler() noexcept;
 	/** Perform an action following the Command design pattern, executing it and appending it to an undo list.
 	@param	command			the command to execute and store. */
 	void doReversableAction(const std::shared_ptr<Editor_Command>& command);
@@ -159,11 +167,17 @@ private:
 	/** Save the level with a specific name.
 	@param	name			the level name to save. */
 	void saveLevel_Internal(const std::string& name);
+	/** Write the finished autosave snapshot to the level's autosave file from a background thread. */
+	void autosaveLevel();
+	/** Block until any in-flight autosave finishes writing. */
+	void waitForAutosave();
 
 
 	// Private Attributes
 	bool m_active = false, m_unsavedChanges = false;
 	float m_autoSaveCounter = 0.0f, m_autosaveInterval = 60.0f;
+	std::future<void> m_autosave;
+	Level_Snapshot m_autosaveSnapshot;
 	Shared_Auto_Model m_shapeQuad;
 	Shared_Shader m_shader;
 	IndirectDraw<1> m_indirectQuad;
@@ -171,9 +185,9 @@ private:
 	ecsWorld m_world;
 	GLuint m_fboID = 0, m_texID = 0, m_depthID = 0;
 	glm::ivec2 m_renderSize = glm::ivec2(1);
-	std::vector<char> m_copiedData;
-	std::deque<std::shared_ptr<Editor_Command>> m_undoStack, m_redoStack;
-	int m_maxUndo = 500;
+	std::shared_ptr<const std::vector<char>> m_copiedData;
+	Editor_History m_history;
+	size_t m_maxUndo = 500ULL, m_maxUndoMemory = 64ULL * 1024ULL * 1024ULL;
 	std::deque<std::string> m_recentLevels;
 	Editor_Interface m_editorInterface;
 	Mouse_Gizmo m_mouseGizmo;
@@ -181,29 +195,4 @@ private:
 	std::shared_ptr<bool> m_aliveIndicator = std::make_shared<bool>(true);
 };
 
-/** A command used by the level editor. Follows the Command Design Pattern.
-To be sub-classed where needed, typically within the scope of a specialized function. */
-struct Editor_Command {
-	// Public Interface
-	inline virtual ~Editor_Command() = default;
-	/** Default constructor. */
-	inline Editor_Command() noexcept = default;
-	/** Move constructor. */
-	inline Editor_Command(Editor_Command&&) noexcept = default;
-	/** Copy constructor. */
-	inline Editor_Command(const Editor_Command&) noexcept = default;
-	/** Move assignment. */
-	inline Editor_Command& operator =(Editor_Command&&) noexcept = default;
-	/** Copy assignment. */
-	inline Editor_Command& operator =(const Editor_Command&) noexcept = default;
-	/** Perform the command. */
-	virtual void execute() = 0;
-	/** Perform the reverse, undo the command. */
-	virtual void undo() = 0;
-	/** Join into this command the data found in another newer command.
-	@param	newerCommand	the newer of the two commands, to take data from.
-	@return					true if this command supports & successfully joined with a newer command, false otherwise. */
-	virtual bool join(Editor_Command* newerCommand);
-};
-
 #endif // EDITOR_MODULE_H
\ No newline at end of file
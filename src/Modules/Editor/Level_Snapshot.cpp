@@ -0,0 +1,83 @@
+#include "Modules/Editor/Level_Snapshot.h"
+#include <utility>
+
+
+constexpr size_t LEVEL_SNAPSHOT_MAX_RESTARTS = 4ULL;
+
+void Level_Snapshot::begin(const size_t& version)
+{
+	m_active = true;
+	m_complete = false;
+	m_version = version;
+	m_restarts = 0ULL;
+	m_lastHandle = EntityHandle();
+	m_slices.clear();
+}
+
+bool Level_Snapshot::step(const ecsWorld& world, const size_t& version, const std::chrono::microseconds& budget)
+{
+	if (!m_active)
+		return false;
+
+	// Anything already serialized may be stale, so start over
+	if (version != m_version) {
+		m_version = version;
+		m_complete = false;
+		m_lastHandle = EntityHandle();
+		m_slices.clear();
+		++m_restarts;
+	}
+	if (m_complete)
+		return true;
+
+	// Walk the top-level entities one at a time, rather than gathering every handle up front
+	const auto start = std::chrono::steady_clock::now();
+	const bool unbounded = m_restarts >= LEVEL_SNAPSHOT_MAX_RESTARTS;
+	const EntityHandle rootHandle;
+	auto& slice = m_slices.emplace_back();
+	do {
+		const auto entityHandle = world.getNextEntityHandle(rootHandle, m_lastHandle);
+		if (entityHandle == EntityHandle()) {
+			m_complete = true;
+			break;
+		}
+		const auto entityData = world.serializeEntity(entityHandle);
+		slice.insert(slice.end(), entityData.begin(), entityData.end());
+		m_lastHandle = entityHandle;
+	} while (unbounded || std::chrono::steady_clock::now() - start < budget);
+	return m_complete;
+}
+
+bool Level_Snapshot::isActive() const noexcept
+{
+	return m_active;
+}
+
+size_t Level_Snapshot::getRestartCount() const noexcept
+{
+	return m_restarts;
+}
+
+void Level_Snapshot::cancel() noexcept
+{
+	m_active = false;
+	m_slices = {};
+}
+
+std::vector<std::vector<char>> Level_Snapshot::take()
+{
+	m_active = false;
+	return std::move(m_slices);
+}
+
+std::vector<char> Level_Snapshot::Join(const std::vector<std::vector<char>>& slices)
+{
+	size_t size(0ULL);
+	for (const auto& slice : slices)
+		size += slice.size();
+	std::vector<char> data;
+	data.reserve(size);
+	for (const auto& slice : slices)
+		data.insert(data.end(), slice.begin(), slice.end());
+	return data;
+}
\ No newline at end of file
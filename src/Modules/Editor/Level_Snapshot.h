@@ -0,0 +1,51 @@
+#pragma once
+#ifndef LEVEL_SNAPSHOT_H
+#define LEVEL_SNAPSHOT_H
+
+#include "Modules/ECS/ecsWorld.h"
+#include <chrono>
+
+
+/** Serializes a level a few top-level entities at a time, so taking a snapshot can be spread across frames.
+Every slice checks the level's version, starting over if it changed part-way through, so a finished snapshot always matches a single version of the level. */
+class Level_Snapshot {
+public:
+	// Public Methods
+	/** Start a new snapshot, discarding any unfinished one.
+	@param	version			the level's current version. */
+	void begin(const size_t& version);
+	/** Serialize more entities, until the time budget runs out.
+	@note					after too many restarts the remaining entities are serialized at once, so constant editing can't postpone a snapshot forever.
+	@param	world			the world being serialized.
+	@param	version			the level's current version, the snapshot starts over if it no longer matches.
+	@param	budget			the most time to spend, always serializing at least one entity.
+	@return					true if the snapshot is complete, false otherwise. */
+	bool step(const ecsWorld& world, const size_t& version, const std::chrono::microseconds& budget);
+	/** Retrieve whether a snapshot was started and not yet taken.
+	@return					true if a snapshot is in progress, false otherwise. */
+	bool isActive() const noexcept;
+	/** Retrieve how many times the current snapshot started over.
+	@return					the restart count. */
+	size_t getRestartCount() const noexcept;
+	/** End the snapshot, discarding anything serialized so far. */
+	void cancel() noexcept;
+	/** End the snapshot, taking its serialized entity data.
+	@note					each slice is kept apart, so a growing snapshot never reallocates everything serialized so far.
+	@return					the serialized entity data of every slice, in order. */
+	std::vector<std::vector<char>> take();
+	/** Join the slices of a snapshot together, best done away from the main thread.
+	@param	slices			the serialized entity data of every slice, in order.
+	@return					the serialized entity data, as produced by ecsWorld::serializeEntities(). */
+	static std::vector<char> Join(const std::vector<std::vector<char>>& slices);
+
+
+private:
+	// Private Attributes
+	bool m_active = false, m_complete = false;
+	size_t m_version = 0ULL, m_restarts = 0ULL;
+	/** The last top-level entity serialized, the next slice continues after it. */
+	EntityHandle m_lastHandle;
+	std::vector<std::vector<char>> m_slices;
+};
+
+#endif // LEVEL_SNAPSHOT_H
\ No newline at end of file
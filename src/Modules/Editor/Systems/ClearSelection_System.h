@@ -19,6 +19,7 @@ public:
 
 
 	// Public Interface Implementation
+	inline const char* getName() const noexcept final { return "ClearSelection_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
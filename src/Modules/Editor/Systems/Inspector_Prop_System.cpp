@@ -78,6 +78,7 @@ void Inspector_Prop_System::updateComponents(const float& /*deltaTime*/, const s
 								component->m_uploadMaterial = false;
 								component->m_offset = 0ULL;
 								component->m_count = 0ULL;
+								component->m_baseVertex = 0;
 								component->m_materialID = 0U;
 							}
 						}
@@ -20,6 +20,7 @@ public:
 
 
 	// Public Interface Implementation
+	inline const char* getName() const noexcept final { return "Inspector_Skeleton_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
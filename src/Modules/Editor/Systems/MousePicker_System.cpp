@@ -137,11 +137,13 @@ static bool RayProp(const Transform_Component& transformComponent, const Prop_Co
 	bool intersection = false;
 	if (prop.m_model->ready()) {
 		float distance = FLT_MAX;
-		const auto vertexCount = prop.m_model->m_data.m_vertices.size();
-		for (size_t x = 0; x < vertexCount; x += 3) {
-			auto v0 = transformComponent.m_worldTransform.m_modelMatrix * glm::vec4(prop.m_model->m_data.m_vertices[x].vertex, 1);
-			auto v1 = transformComponent.m_worldTransform.m_modelMatrix * glm::vec4(prop.m_model->m_data.m_vertices[x + 1].vertex, 1);
-			auto v2 = transformComponent.m_worldTransform.m_modelMatrix * glm::vec4(prop.m_model->m_data.m_vertices[x + 2].vertex, 1);
+		const auto& vertices = prop.m_model->m_data.m_vertices;
+		const auto& indices = prop.m_model->m_data.m_indices;
+		const auto indexCount = indices.size();
+		for (size_t x = 0; x + 2 < indexCount; x += 3) {
+			auto v0 = transformComponent.m_worldTransform.m_modelMatrix * glm::vec4(vertices[indices[x]].vertex, 1);
+			auto v1 = transformComponent.m_worldTransform.m_modelMatrix * glm::vec4(vertices[indices[x + 1]].vertex, 1);
+			auto v2 = transformComponent.m_worldTransform.m_modelMatrix * glm::vec4(vertices[indices[x + 2]].vertex, 1);
 			v0 /= v0.w;
 			v1 /= v1.w;
 			v2 /= v2.w;
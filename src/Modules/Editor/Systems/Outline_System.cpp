@@ -150,8 +150,26 @@ void Outline_System::updateComponents(const float& /*deltaTime*/, const std::vec
 void Outline_System::tryInsertModel(const Shared_Mesh& mesh)
 {
 	if (m_meshMap.find(mesh) == m_meshMap.end()) {
-		// Prop hasn't been uploaded yet
-		const size_t arraySize = mesh->m_geometry.vertices.size() * (sizeof(glm::vec3) * 2);
+		// Prop hasn't been uploaded yet, expand indexed meshes back into a flat triangle list
+		const auto& geometry = mesh->m_geometry;
+		std::vector<glm::vec3> mergedData;
+		const auto size = std::min(geometry.vertices.size(), geometry.normals.size());
+		if (geometry.indices.empty()) {
+			mergedData.reserve(size * 2);
+			for (size_t x = 0; x < size; ++x) {
+				mergedData.push_back(geometry.vertices[x]);
+				mergedData.push_back(geometry.normals[x]);
+			}
+		}
+		else {
+			mergedData.reserve(geometry.indices.size() * 2);
+			for (const auto& index : geometry.indices)
+				if (index < size) {
+					mergedData.push_back(geometry.vertices[index]);
+					mergedData.push_back(geometry.normals[index]);
+				}
+		}
+		const size_t arraySize = mergedData.size() * sizeof(glm::vec3);
 		// Check if we can fit the desired data
 		waitOnFence();
 		tryToExpand(arraySize);
@@ -159,13 +177,6 @@ void Outline_System::tryInsertModel(const Shared_Mesh& mesh)
 		auto count = static_cast<GLuint>(arraySize / (sizeof(glm::vec3) * 2));
 
 		// Upload vertex data
-		std::vector<glm::vec3> mergedData;
-		mergedData.reserve(mesh->m_geometry.vertices.size() * 2);
-		const auto size = std::min(mesh->m_geometry.vertices.size(), mesh->m_geometry.normals.size());
-		for (size_t x = 0; x < size; ++x) {
-			mergedData.push_back(mesh->m_geometry.vertices[x]);
-			mergedData.push_back(mesh->m_geometry.normals[x]);
-		}
 		glNamedBufferSubData(m_vboID, m_currentSize, arraySize, mergedData.data());
 		m_currentSize += arraySize;
 
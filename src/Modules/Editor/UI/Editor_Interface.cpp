@@ -12,6 +12,7 @@
 #include "Modules/Editor/UI/UnsavedChangesDialogue.h"
 #include "Modules/Editor/UI/MissingFileDialogue.h"
 #include "Modules/Editor/UI/Settings.h"
+#include "Modules/Editor/UI/FrameProfiler.h"
 #include "imgui.h"
 #include "imgui_internal.h"
 #include "examples/imgui_impl_glfw.h"
@@ -37,6 +38,7 @@ Editor_Interface::Editor_Interface(Engine& engine, LevelEditor_Module& editor) :
 	m_uiSceneInspector(std::make_shared<SceneInspector>(engine, editor)),
 	m_uiEntityInspector(std::make_shared<EntityInspector>(engine, editor)),
 	m_uiSettings(std::make_shared<Settings>(engine, editor)),
+	m_uiProfiler(std::make_shared<FrameProfiler>(engine)),
 	m_uiRecoverDialogue(std::make_shared<RecoverDialogue>(engine, editor)),
 	m_uiOpenDialogue(std::make_shared<OpenDialogue>(engine, editor)),
 	m_uiSaveDialogue(std::make_shared<SaveDialogue>(engine, editor)),
@@ -141,7 +143,7 @@ void Editor_Interface::tick(const float& deltaTime)
 
 	// Process all UI elements
 	const auto elements = {
-		m_uiHotkeys,m_uiCamController,m_uiRotIndicator,m_uiTitlebar,m_uiPrefabs,m_uiSceneInspector,m_uiEntityInspector,m_uiSettings,m_uiRecoverDialogue,m_uiOpenDialogue,m_uiSaveDialogue,m_uiUnsavedDialogue,m_uiMissingDialogue,
+		m_uiHotkeys,m_uiCamController,m_uiRotIndicator,m_uiTitlebar,m_uiPrefabs,m_uiSceneInspector,m_uiEntityInspector,m_uiSettings,m_uiProfiler,m_uiRecoverDialogue,m_uiOpenDialogue,m_uiSaveDialogue,m_uiUnsavedDialogue,m_uiMissingDialogue,
 	};
 	for (auto& element : elements)
 		element->tick(deltaTime);
@@ -39,6 +39,7 @@ public:
 		m_uiSceneInspector,
 		m_uiEntityInspector,
 		m_uiSettings,
+		m_uiProfiler,
 		m_uiRecoverDialogue,
 		m_uiOpenDialogue,
 		m_uiSaveDialogue,
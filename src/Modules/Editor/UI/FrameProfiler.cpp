@@ -0,0 +1,62 @@
+#include "Modules/Editor/UI/FrameProfiler.h"
+#include "Utilities/GL/GL_Fence.h"
+#include "Utilities/Profiler.h"
+#include "Engine.h"
+#include "imgui.h"
+
+
+FrameProfiler::FrameProfiler(Engine& engine) noexcept :
+	m_engine(engine)
+{
+	m_open = false;
+}
+
+void FrameProfiler::tick(const float& /*deltaTime*/)
+{
+	if (m_open) {
+		if (ImGui::Begin("Profiler", &m_open, ImGuiWindowFlags_AlwaysAutoResize)) {
+			// Trace capturing
+			if (!Profiler::Is_Capturing()) {
+				if (ImGui::Button("Begin Capture"))
+					Profiler::Begin_Capture();
+			}
+			else if (ImGui::Button("End Capture")) {
+				const auto path = Engine::Get_Current_Dir() + "\\profile.json";
+				if (Profiler::End_Capture(path))
+					m_engine.getManager_Messages().statement("Profiler capture saved to: " + path, Message_Category::EDITOR);
+				else
+					m_engine.getManager_Messages().error("Cannot save the profiler capture: " + path, Message_Category::EDITOR);
+			}
+			if (ImGui::IsItemHovered()) {
+				ImGui::BeginTooltip();
+				ImGui::Text("Record every zone into a Chrome trace file, viewable in chrome://tracing.");
+				ImGui::EndTooltip();
+			}
+			ImGui::Separator();
+
+			// Time spent waiting for the GPU to release buffers
+			const auto& frameSync = GL_Fence::Get_Frame_Sync();
+			const auto& frameWait = frameSync.getFrameWait();
+			const auto& bufferStalls = frameSync.getBufferStalls();
+			ImGui::Text("GPU frame wait: %.3f ms", static_cast<double>(frameWait.m_stallTime) / 1000000.0);
+			ImGui::Text("GPU buffer stalls: %zu (%.3f ms)", bufferStalls.m_stalls, static_cast<double>(bufferStalls.m_stallTime) / 1000000.0);
+			ImGui::Separator();
+
+			// Last frame's zones, slowest first
+			ImGui::Columns(4);
+			ImGui::Text("Category"); ImGui::NextColumn();
+			ImGui::Text("Zone"); ImGui::NextColumn();
+			ImGui::Text("Calls"); ImGui::NextColumn();
+			ImGui::Text("Time (ms)"); ImGui::NextColumn();
+			ImGui::Separator();
+			for (const auto& zone : Profiler::Get_Frame_Summary()) {
+				ImGui::TextUnformatted(zone.m_category); ImGui::NextColumn();
+				ImGui::TextUnformatted(zone.m_name); ImGui::NextColumn();
+				ImGui::Text("%zu", zone.m_calls); ImGui::NextColumn();
+				ImGui::Text("%.3f", zone.m_milliseconds); ImGui::NextColumn();
+			}
+			ImGui::Columns(1);
+		}
+		ImGui::End();
+	}
+}
\ No newline at end of file
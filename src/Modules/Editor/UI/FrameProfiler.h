@@ -0,0 +1,26 @@
+#pragma once
+#ifndef FRAMEPROFILER_H
+#define FRAMEPROFILER_H
+
+#include "Modules/Editor/UI/Editor_Interface.h"
+
+
+/** A level editor window summarizing the profiler's zones for the last frame, and recording traces. */
+class FrameProfiler final : public ImGUI_Element {
+public:
+	// Public (De)Constructors
+	/** Construct a frame profiler window.
+	@param	engine		reference to the engine to use. */
+	explicit FrameProfiler(Engine& engine) noexcept;
+
+
+	// Public Interface Implementation
+	void tick(const float& deltaTime) final;
+
+
+private:
+	// Private Attributes
+	Engine& m_engine;
+};
+
+#endif // FRAMEPROFILER_H
\ No newline at end of file
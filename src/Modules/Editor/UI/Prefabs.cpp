@@ -110,7 +110,7 @@ void Prefabs::addPrefab(const std::vector<char>& entityData)
 	// Save Prefab to disk
 	std::ofstream mapFile(Engine::Get_Current_Dir() + "\\Maps\\Prefabs\\" + m_prefabs[m_selectedIndex].path, std::ios::binary | std::ios::out);
 	if (!mapFile.is_open())
-		m_engine.getManager_Messages().error("Cannot write the binary map file to disk!");
+		m_engine.getManager_Messages().error("Cannot write the binary map file to disk!", Message_Category::EDITOR);
 	else
 		mapFile.write(entityData.data(), static_cast<std::streamsize>(entityData.size()));
 	mapFile.close();
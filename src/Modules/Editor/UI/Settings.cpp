@@ -54,6 +54,20 @@ void Settings::tickMainDialogue()
 					ImGui::EndTooltip();
 				}
 
+				static float floatStackMemory = 64.0F;
+				m_engine.getPreferenceState().getOrSetValue(PreferenceState::Preference::E_UNDO_MEMORY, floatStackMemory);
+				static int intStackMemory = int(floatStackMemory);
+				if (ImGui::DragInt("Max Undo/Redo Memory", &intStackMemory, 1.0F, 0, 4096, "%d MB")) {
+					intStackMemory = std::max(1, intStackMemory);
+					m_engine.getPreferenceState().setValue(PreferenceState::Preference::E_UNDO_MEMORY, float(intStackMemory));
+				}
+				if (ImGui::IsItemHovered()) {
+					ImGui::BeginTooltip();
+					const auto description = "Forget the oldest undo-able actions once they use more than " + std::to_string(intStackMemory) + " MB.";
+					ImGui::Text("%s", description.c_str());
+					ImGui::EndTooltip();
+				}
+
 				static float outlineScale = 0.05F;
 				m_engine.getPreferenceState().getOrSetValue(PreferenceState::Preference::E_OUTLINE_SCALE, outlineScale);
 				outlineScale *= 1000.0F;
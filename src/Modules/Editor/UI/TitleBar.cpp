@@ -97,6 +97,7 @@ void TitleBar::tick(const float& /*deltaTime*/)
 				if (ImGui::MenuItem("Scene Inspector")) { m_editor.openSceneInspector(); }
 				if (ImGui::MenuItem("Entity Inspector")) { m_editor.openEntityInspector(); }
 				if (ImGui::MenuItem("Prefabs")) { m_editor.openPrefabs(); }
+				if (ImGui::MenuItem("Profiler")) { m_editor.openProfiler(); }
 				ImGui::Separator();
 				if (BeginMenuWIcon("Settings", m_iconSettings)) { m_editor.openSettingsDialogue(); }
 				ImGui::EndMenu();
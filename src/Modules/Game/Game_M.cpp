@@ -4,6 +4,7 @@
 #include "Modules/UI/Macro Elements/StartMenu.h"
 #include "Modules/UI/Macro Elements/PauseMenu.h"
 #include "Utilities/IO/Level_IO.h"
+#include "Utilities/Profiler.h"
 #include "Engine.h"
 
 
@@ -42,6 +43,7 @@ void Game_Module::deinitialize()
 
 void Game_Module::frameTick(const float& deltaTime)
 {
+	PROFILE_ZONE("Module", "Game_Module::frameTick");
 	auto& actionState = m_engine.getActionState();
 	if (m_gameState == Game_State::in_pauseMenu || m_gameState == Game_State::in_game) {
 		// Check if we should show the overlay
@@ -54,6 +54,8 @@ public:
 
 	// Public Attributes
 	glm::vec3 m_frustumCenter = glm::vec3(0);
+	/** How many times more error this perspective tolerates when choosing levels of detail, set by whichever system gathers it. */
+	float m_lodBias = 1.0F;
 
 
 private:
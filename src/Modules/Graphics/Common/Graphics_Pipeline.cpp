@@ -1,4 +1,7 @@
 #include "Modules/Graphics/Common/Graphics_Pipeline.h"
+#include "Utilities/Profiler.h"
+#include "Engine.h"
+#include <algorithm>
 
 /* Rendering Techniques Used */
 #include "Modules/Graphics/Logical/Transform_System.h"
@@ -53,11 +56,18 @@ std::vector<std::pair<int, int>> Graphics_Pipeline::begin(const float& deltaTime
 
 	// Update world systems
 	std::dynamic_pointer_cast<Transform_System>(m_transHierachy)->m_world = &world;
-	world.updateSystems(m_worldSystems, deltaTime);
+	world.updateSystems(m_worldSystems, deltaTime, m_engine.getModule_ECS().getScheduler());
 
-	// Update rendering techniques
+	// Update rendering techniques, geometry last so it culls against this frame's light and reflector cameras
 	for (auto& tech : m_allTechniques)
+		if (std::find(std::cbegin(m_geometryTechniques), std::cend(m_geometryTechniques), tech) == std::cend(m_geometryTechniques)) {
+			PROFILE_ZONE("updateCache", tech->getName());
+			tech->updateCache(deltaTime, world);
+		}
+	for (auto& tech : m_geometryTechniques) {
+		PROFILE_ZONE("updateCache", tech->getName());
 		tech->updateCache(deltaTime, world);
+	}
 
 	// Write camera data to camera GPU buffer
 	m_cameraBuffer.beginWriting();
@@ -69,8 +79,10 @@ std::vector<std::pair<int, int>> Graphics_Pipeline::begin(const float& deltaTime
 
 	// Apply pre-rendering passes
 	m_cameraBuffer.bindBufferBase(GL_SHADER_STORAGE_BUFFER, 2);
-	for (auto& tech : m_allTechniques)
+	for (auto& tech : m_allTechniques) {
+		PROFILE_ZONE("updatePass", tech->getName());
 		tech->updatePass(deltaTime);
+	}
 
 	return perspectives;
 }
@@ -86,8 +98,10 @@ void Graphics_Pipeline::render(const float& deltaTime, Viewport& viewport, const
 {
 	m_cameraBuffer.bindBufferBase(GL_SHADER_STORAGE_BUFFER, 2);
 	for (auto& tech : m_allTechniques)
-		if ((categories & static_cast<unsigned int>(tech->getCategory())) != 0U)
+		if ((categories & static_cast<unsigned int>(tech->getCategory())) != 0U) {
+			PROFILE_ZONE("renderTechnique", tech->getName());
 			tech->renderTechnique(deltaTime, viewport, perspectives);
+		}
 }
 
 void Graphics_Pipeline::cullShadows(const float& deltaTime, const std::vector<std::pair<int, int>>& perspectives)
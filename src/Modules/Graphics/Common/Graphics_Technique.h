@@ -47,6 +47,9 @@ public:
 
 
 	// Public Interface
+	/** Retrieve a readable name for this technique, labeling it when profiling.
+	@return					the technique's name. */
+	virtual const char* getName() const noexcept = 0;
 	/** Prepare this technique for the next frame, swapping any of its buffers.
 	@param	deltaTime		the amount of time passed since last frame. */
 	virtual void clearCache(const float& deltaTime);
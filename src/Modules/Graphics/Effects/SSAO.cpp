@@ -66,7 +66,7 @@ SSAO::SSAO(Engine& engine) :
 	// Error Reporting
 	auto& msgMgr = m_engine.getManager_Messages();
 	if (!glIsTexture(m_noiseID))
-		msgMgr.error("SSAO Noise Texture is incomplete.");
+		msgMgr.error("SSAO Noise Texture is incomplete.", Message_Category::GRAPHICS);
 }
 
 void SSAO::clearCache(const float& /*deltaTime*/) noexcept
@@ -22,6 +22,7 @@ public:
 
 
 	// Public Interface Implementations.
+	inline const char* getName() const noexcept final { return "SSAO"; }
 	void clearCache(const float& deltaTime) noexcept final;
 	void renderTechnique(const float& deltaTime, Viewport& viewport, const std::vector<std::pair<int, int>>& perspectives) final;
 
@@ -38,7 +38,7 @@ SSR::SSR(Engine& engine) :
 	// Error Reporting
 	auto& msgMgr = engine.getManager_Messages();
 	if (!glIsTexture(m_bayerID))
-		msgMgr.error("SSR Bayer Matrix Texture is incomplete.");
+		msgMgr.error("SSR Bayer Matrix Texture is incomplete.", Message_Category::GRAPHICS);
 }
 
 void SSR::clearCache(const float& /*deltaTime*/) noexcept
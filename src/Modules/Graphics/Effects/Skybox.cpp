@@ -40,9 +40,9 @@ Skybox::Skybox(Engine& engine) :
 
 		// Error Reporting
 		if (glCheckNamedFramebufferStatus(m_cubeFBO, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
-			m_engine.getManager_Messages().error("Skybox Framebuffer has encountered an error.");
+			m_engine.getManager_Messages().error("Skybox Framebuffer has encountered an error.", Message_Category::GRAPHICS);
 		if (!glIsTexture(m_cubemapMipped))
-			m_engine.getManager_Messages().error("Skybox Texture is incomplete.");
+			m_engine.getManager_Messages().error("Skybox Texture is incomplete.", Message_Category::GRAPHICS);
 		});
 }
 
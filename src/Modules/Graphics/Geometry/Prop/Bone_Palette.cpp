@@ -0,0 +1,51 @@
+#include "Modules/Graphics/Geometry/Prop/Bone_Palette.h"
+#include <algorithm>
+
+
+Bone_Palette::Bone_Palette(const size_t& capacity) :
+	m_ranges(capacity)
+{
+}
+
+size_t Bone_Palette::allocate(const size_t& boneCount)
+{
+	size_t offset(0ULL);
+	if (!m_ranges.allocate(boneCount, offset)) {
+		m_ranges.grow(std::max<size_t>(m_ranges.capacity() * 2ULL, m_ranges.capacity() + boneCount));
+		m_ranges.allocate(boneCount, offset);
+	}
+	return offset;
+}
+
+void Bone_Palette::release(const size_t& offset)
+{
+	m_ranges.release(offset);
+}
+
+size_t Bone_Palette::capacity() const noexcept
+{
+	return m_ranges.capacity();
+}
+
+size_t Bone_Palette::used() const noexcept
+{
+	return m_ranges.used();
+}
+
+Bone_Palette::Packed_Bone Bone_Palette::Pack(const glm::mat4& transform) noexcept
+{
+	// GLM matrices are column-major, so gather each row across the columns
+	Packed_Bone bone;
+	for (int row = 0; row < 3; ++row)
+		bone.rows[row] = glm::vec4(transform[0][row], transform[1][row], transform[2][row], transform[3][row]);
+	return bone;
+}
+
+glm::mat4 Bone_Palette::Unpack(const Packed_Bone& bone) noexcept
+{
+	glm::mat4 transform(1.0F);
+	for (int row = 0; row < 3; ++row)
+		for (int column = 0; column < 4; ++column)
+			transform[column][row] = bone.rows[row][column];
+	return transform;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef BONE_PALETTE_H
+#define BONE_PALETTE_H
+
+#include "Utilities/Range_Allocator.h"
+#include "glm/glm.hpp"
+
+
+/** Starting number of bones the palette holds. */
+constexpr size_t BONEPALETTE_INITIAL_CAPACITY = 256ULL;
+
+/** Sub-allocates every skeleton exactly as many bones as it has, out of one shared pool, and packs bones for the GPU.
+Offsets and counts are in bones. */
+class Bone_Palette {
+public:
+	/** A bone's affine transform as the GPU reads it, the top 3 rows of its matrix. */
+	struct Packed_Bone {
+		glm::vec4 rows[3];
+	};
+
+
+	// Public (De)Constructors
+	/** Construct a bone palette.
+	@param	capacity		the starting number of bones. */
+	explicit Bone_Palette(const size_t& capacity = BONEPALETTE_INITIAL_CAPACITY);
+
+
+	// Public Methods
+	/** Find room for a skeleton's bones, growing the palette if there isn't any.
+	@param	boneCount		the number of bones, must be greater than 0.
+	@return					the offset of the first bone. */
+	size_t allocate(const size_t& boneCount);
+	/** Return a skeleton's bones to the palette.
+	@param	offset			the offset of the first bone. */
+	void release(const size_t& offset);
+	/** Retrieve the number of bones the palette can hold, which the GPU buffer must match.
+	@return					the palette capacity. */
+	size_t capacity() const noexcept;
+	/** Retrieve the number of bones allocated.
+	@return					the bones in use. */
+	size_t used() const noexcept;
+	/** Pack a bone transform, dropping the bottom row as bones are affine.
+	@param	transform		the bone transform.
+	@return					the packed bone. */
+	static Packed_Bone Pack(const glm::mat4& transform) noexcept;
+	/** Unpack a bone transform.
+	@param	bone			the packed bone.
+	@return					the bone transform. */
+	static glm::mat4 Unpack(const Packed_Bone& bone) noexcept;
+
+
+private:
+	// Private Attributes
+	Range_Allocator m_ranges;
+};
+
+#endif // BONE_PALETTE_H
\ No newline at end of file
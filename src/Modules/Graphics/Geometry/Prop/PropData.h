@@ -2,12 +2,11 @@
 #ifndef PROPDATA_H
 #define PROPDATA_H
 
+#include "Modules/Graphics/Geometry/Prop/Bone_Palette.h"
 #include "Utilities/GL/GL_Vector.h"
 #include "glm/glm.hpp"
 #include <vector>
 
-#define NUM_MAX_BONES 100
-
 
 /** Structure to contain data that changes frame-to-frame, for prop rendering. */
 struct PropData {
@@ -18,19 +17,32 @@ struct PropData {
 		glm::mat4 mMatrix;
 		glm::mat4 bBoxMatrix;
 	};
-	/** OpenGL buffer struct for skeletons. */
-	struct Skeleton_Buffer {
-		glm::mat4 bones[NUM_MAX_BONES];
+	/** OpenGL buffer struct for indexed indirect draws. */
+	struct Draw_Buffer {
+		GLuint count;
+		GLuint instanceCount;
+		GLuint firstIndex;
+		GLint baseVertex;
+		GLuint baseInstance;
 	};
-	/** Struct collating per-perspective data. */
+	/** Struct collating per-perspective data, one entry per visible prop. */
 	struct ViewInfo {
-		std::vector<glm::ivec4> cullingDrawData, renderingDrawData;
+		std::vector<glm::ivec4> cullingDrawData;
+		std::vector<Draw_Buffer> renderingDrawData;
 		std::vector<GLuint> visibleIndices;
 		std::vector<int> skeletonData;
 	};
+	/** Struct collating the draws of one multi-draw call, where each draw spans a range of instances. */
+	struct DrawList {
+		std::vector<glm::ivec2> camIndices;				// Per instance, the camera and layer
+		std::vector<GLuint> propIndices;				// Per instance, the prop's model buffer index
+		std::vector<int> skeletonIndices;				// Per instance, the prop's skeleton palette offset
+		std::vector<glm::ivec4> cullingDrawData;		// Per draw
+		std::vector<Draw_Buffer> renderingDrawData;		// Per draw
+	};
 
 	GL_Vector<Model_Buffer> modelBuffer;
-	GL_Vector<Skeleton_Buffer> skeletonBuffer;
+	GL_Vector<Bone_Palette::Packed_Bone> skeletonBuffer;
 	std::vector<ViewInfo> viewInfo;
 	GLuint m_geometryVAOID = 0u, m_materialArrayID = 0u;
 };
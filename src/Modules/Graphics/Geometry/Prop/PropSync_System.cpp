@@ -14,60 +14,134 @@ PropSync_System::PropSync_System(PropData& frameData) :
 
 void PropSync_System::updateComponents(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components)
 {
-	// Resize BOTH buffers to match number of entities this frame, even though not all models have skeletons
-	m_frameData.modelBuffer.resize(components.size());
-	m_frameData.skeletonBuffer.resize(components.size());
-	m_frameData.modelBuffer.beginWriting();
-	m_frameData.skeletonBuffer.beginWriting();
-	int index = 0;
+	// Return the bones of props that no longer exist
+	const auto count = components.size();
+	for (auto index = count; index < m_syncStates.size(); ++index)
+		assignPalette(m_syncStates[index], 0ULL);
+	m_frameData.modelBuffer.resize(count);
+	m_syncStates.resize(count);
+	m_modelRanges.resize(count);
+	m_skeletonRanges.resize(count);
+
+	// Find the props that changed since last frame, or that moved to a different index
+	size_t index(0ULL);
 	for (const auto& componentParam : components) {
 		const auto* propComponent = static_cast<Prop_Component*>(componentParam[0]);
 		auto* skeletonComponent = dynamic_cast<Skeleton_Component*>(componentParam[1]);
 		const auto* transformComponent = dynamic_cast<Transform_Component*>(componentParam[2]);
 		auto* bboxComponent = dynamic_cast<BoundingBox_Component*>(componentParam[3]);
 
-		// Synchronize the component if it is visible
+		Sync_State state;
+		size_t boneCount(0ULL);
+		state.m_handle = propComponent->m_handle;
 		if (propComponent->m_model->ready()) {
-			// Sync Transform Attributes
-			if (transformComponent != nullptr) {
-				const auto& position = transformComponent->m_worldTransform.m_position;
-				const auto& orientation = transformComponent->m_worldTransform.m_orientation;
-				const auto& scale = transformComponent->m_worldTransform.m_scale;
-				const auto matRot = glm::mat4_cast(orientation);
-				m_frameData.modelBuffer[index].mMatrix = transformComponent->m_worldTransform.m_modelMatrix;
-
-				// Update bounding sphere
-				const glm::vec3 bboxMax_World = (propComponent->m_model->m_bboxMax * scale) + position;
-				const glm::vec3 bboxMin_World = (propComponent->m_model->m_bboxMin * scale) + position;
-				const glm::vec3 bboxCenter = (bboxMax_World + bboxMin_World) / 2.0F;
-				const glm::vec3 bboxScale = (bboxMax_World - bboxMin_World) / 2.0F;
-				const glm::mat4 matTrans = glm::translate(glm::mat4(1.0F), bboxCenter);
-				const glm::mat4 matScale = glm::scale(glm::mat4(1.0F), bboxScale);
-				const glm::mat4 matFinal = (matTrans * matRot * matScale);
-				m_frameData.modelBuffer[index].bBoxMatrix = matFinal;
-			}
+			state.m_model = propComponent->m_model.get();
+			state.m_materialID = propComponent->m_materialID;
+			state.m_skin = propComponent->m_skin;
+			if (transformComponent != nullptr)
+				state.m_transformVersion = transformComponent->m_version;
 			if (bboxComponent != nullptr) {
 				bboxComponent->m_extent = propComponent->m_model->m_bboxScale;
 				bboxComponent->m_min = propComponent->m_model->m_bboxMin;
 				bboxComponent->m_max = propComponent->m_model->m_bboxMax;
 				bboxComponent->m_positionOffset = propComponent->m_model->m_bboxCenter;
 			}
-
-			// Sync Animation Attributes
 			if (skeletonComponent != nullptr) {
-				skeletonComponent->m_mesh = propComponent->m_model->m_mesh;
-				auto& bones = m_frameData.skeletonBuffer[index].bones;
-				const auto total = std::min(skeletonComponent->m_transforms.size(), static_cast<size_t>(NUM_MAX_BONES));
-				for (size_t i = 0; i < total; ++i)
-					bones[i] = skeletonComponent->m_transforms[i];
+				// A different mesh needs posing again, even if the animation is paused
+				if (skeletonComponent->m_mesh != propComponent->m_model->m_mesh) {
+					skeletonComponent->m_mesh = propComponent->m_model->m_mesh;
+					skeletonComponent->m_posedAnimation = -1;
+				}
+				state.m_skeletonVersion = skeletonComponent->m_version;
+				boneCount = skeletonComponent->m_transforms.size();
 			}
+		}
 
-			// Sync Prop Attributes
-			m_frameData.modelBuffer[index].materialID = propComponent->m_materialID;
-			m_frameData.modelBuffer[index].skinID = propComponent->m_skin;
+		auto& synced = m_syncStates[index];
+		const bool moved = !(synced.m_handle == state.m_handle) || synced.m_model != state.m_model;
+		if (moved || synced.m_transformVersion != state.m_transformVersion || synced.m_materialID != state.m_materialID || synced.m_skin != state.m_skin)
+			m_modelRanges.markDirty(index);
+		if (moved || synced.m_boneCount != boneCount) {
+			assignPalette(synced, boneCount);
+			m_skeletonRanges.markDirty(index);
 		}
-		index++;
+		else if (synced.m_skeletonVersion != state.m_skeletonVersion)
+			m_skeletonRanges.markDirty(index);
+		state.m_paletteOffset = synced.m_paletteOffset;
+		state.m_boneCount = synced.m_boneCount;
+		synced = state;
+		if (skeletonComponent != nullptr)
+			skeletonComponent->m_paletteOffset = synced.m_boneCount != 0ULL ? static_cast<int>(synced.m_paletteOffset) : -1;
+		++index;
 	}
+
+	// Match the skeleton buffer to the palette, which only grows
+	m_frameData.skeletonBuffer.resize(m_palette.capacity());
+
+	// Only write what the buffers about to be written are missing
+	m_frameData.modelBuffer.beginWriting();
+	m_modelRanges.collect(static_cast<size_t>(m_frameData.modelBuffer.getIndex()), m_ranges);
+	for (const auto& [first, rangeCount] : m_ranges)
+		for (auto x = first; x < first + rangeCount; ++x)
+			writeModel(x, components[x]);
 	m_frameData.modelBuffer.endWriting();
+
+	m_frameData.skeletonBuffer.beginWriting();
+	m_skeletonRanges.collect(static_cast<size_t>(m_frameData.skeletonBuffer.getIndex()), m_ranges);
+	for (const auto& [first, rangeCount] : m_ranges)
+		for (auto x = first; x < first + rangeCount; ++x)
+			writeSkeleton(m_syncStates[x], components[x]);
 	m_frameData.skeletonBuffer.endWriting();
+}
+
+void PropSync_System::writeModel(const size_t& index, const std::vector<ecsBaseComponent*>& componentParam)
+{
+	const auto* propComponent = static_cast<Prop_Component*>(componentParam[0]);
+	const auto* transformComponent = dynamic_cast<Transform_Component*>(componentParam[2]);
+	if (!propComponent->m_model->ready())
+		return;
+
+	// Sync Transform Attributes
+	auto& modelData = m_frameData.modelBuffer[index];
+	if (transformComponent != nullptr) {
+		const auto& position = transformComponent->m_worldTransform.m_position;
+		const auto& orientation = transformComponent->m_worldTransform.m_orientation;
+		const auto& scale = transformComponent->m_worldTransform.m_scale;
+		const auto matRot = glm::mat4_cast(orientation);
+		modelData.mMatrix = transformComponent->m_worldTransform.m_modelMatrix;
+
+		// Update bounding sphere
+		const glm::vec3 bboxMax_World = (propComponent->m_model->m_bboxMax * scale) + position;
+		const glm::vec3 bboxMin_World = (propComponent->m_model->m_bboxMin * scale) + position;
+		const glm::vec3 bboxCenter = (bboxMax_World + bboxMin_World) / 2.0F;
+		const glm::vec3 bboxScale = (bboxMax_World - bboxMin_World) / 2.0F;
+		const glm::mat4 matTrans = glm::translate(glm::mat4(1.0F), bboxCenter);
+		const glm::mat4 matScale = glm::scale(glm::mat4(1.0F), bboxScale);
+		const glm::mat4 matFinal = (matTrans * matRot * matScale);
+		modelData.bBoxMatrix = matFinal;
+	}
+
+	// Sync Prop Attributes
+	modelData.materialID = propComponent->m_materialID;
+	modelData.skinID = propComponent->m_skin;
+}
+
+void PropSync_System::assignPalette(Sync_State& synced, const size_t& boneCount)
+{
+	if (synced.m_boneCount != 0ULL)
+		m_palette.release(synced.m_paletteOffset);
+	synced.m_paletteOffset = boneCount != 0ULL ? m_palette.allocate(boneCount) : 0ULL;
+	synced.m_boneCount = boneCount;
+}
+
+void PropSync_System::writeSkeleton(const Sync_State& synced, const std::vector<ecsBaseComponent*>& componentParam)
+{
+	const auto* skeletonComponent = dynamic_cast<Skeleton_Component*>(componentParam[1]);
+	if (skeletonComponent == nullptr || synced.m_boneCount == 0ULL)
+		return;
+
+	// Sync Animation Attributes
+	const auto total = std::min(skeletonComponent->m_transforms.size(), synced.m_boneCount);
+	for (size_t i = 0; i < total; ++i)
+		m_frameData.skeletonBuffer[synced.m_paletteOffset + i] = Bone_Palette::Pack(skeletonComponent->m_transforms[i]);
 }
\ No newline at end of file
@@ -3,12 +3,17 @@
 #define PROPSYNC_SYSTEM_H
 
 #include "Modules/ECS/ecsSystem.h"
+#include "Modules/Graphics/Geometry/Prop/Bone_Palette.h"
+#include "Utilities/Dirty_Ranges.h"
+#include <glad/glad.h>
 
 
 // Forward Declarations
 struct PropData;
+class Model;
 
-/** An ECS system responsible for synchronizing prop components and sending data to the GPU. */
+/** An ECS system responsible for synchronizing prop components and sending data to the GPU.
+Only props whose data changed since a buffer was last written are uploaded into it. */
 class PropSync_System final : public ecsBaseSystem {
 public:
 	// Public (De)Constructors
@@ -18,12 +23,44 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "PropSync_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
 private:
+	// Private Structures
+	/** What was last synchronized for each buffer index, to detect changes. */
+	struct Sync_State {
+		ComponentHandle m_handle;
+		const Model* m_model = nullptr;
+		size_t m_transformVersion = 0ULL, m_skeletonVersion = 0ULL;
+		GLuint m_materialID = 0U;
+		unsigned int m_skin = 0U;
+		size_t m_paletteOffset = 0ULL, m_boneCount = 0ULL;
+	};
+
+
+	// Private Methods
+	/** Write a prop's material, skin, and matrices into the model buffer.
+	@param	index			the prop's index in the buffer.
+	@param	componentParam	the prop's components. */
+	void writeModel(const size_t& index, const std::vector<ecsBaseComponent*>& componentParam);
+	/** Give a prop's skeleton room in the bone palette, or return it if the prop no longer needs it.
+	@param	synced			the prop's sync state, updated with its palette range.
+	@param	boneCount		the number of bones the prop needs, or 0 for none. */
+	void assignPalette(Sync_State& synced, const size_t& boneCount);
+	/** Write a prop's bone transforms into its range of the skeleton buffer.
+	@param	synced			the prop's sync state.
+	@param	componentParam	the prop's components. */
+	void writeSkeleton(const Sync_State& synced, const std::vector<ecsBaseComponent*>& componentParam);
+
+
 	// Private Attributes
 	PropData& m_frameData;
+	std::vector<Sync_State> m_syncStates;
+	Bone_Palette m_palette;
+	Dirty_Ranges m_modelRanges, m_skeletonRanges;
+	std::vector<std::pair<size_t, size_t>> m_ranges;
 };
 
 #endif // PROPSYNC_SYSTEM_H
\ No newline at end of file
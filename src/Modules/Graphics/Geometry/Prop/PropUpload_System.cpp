@@ -3,10 +3,15 @@
 #include "Modules/ECS/component_types.h"
 #include "Engine.h"
 
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 
 PropUpload_System::~PropUpload_System()
 {
 	glDeleteBuffers(1, &m_vboID);
+	glDeleteBuffers(1, &m_iboID);
 	glDeleteVertexArrays(1, &m_vaoID);
 	for (const auto& [pboID, fence] : m_pixelBuffers)
 		glDeleteBuffers(1, &pboID);
@@ -20,7 +25,9 @@ PropUpload_System::PropUpload_System(Engine& engine, PropData& frameData) :
 
 	// Create VBO's
 	glCreateBuffers(1, &m_vboID);
-	glNamedBufferStorage(m_vboID, 1, nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glNamedBufferStorage(m_vboID, m_vertexRanges.capacity() * sizeof(SingleVertex), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glCreateBuffers(1, &m_iboID);
+	glNamedBufferStorage(m_iboID, m_indexRanges.capacity() * sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
 	// Create VAO
 	glCreateVertexArrays(1, &m_vaoID);
 	// Enable 7 attribute locations which all source data from binding point 0
@@ -37,18 +44,26 @@ PropUpload_System::PropUpload_System(Engine& engine, PropData& frameData) :
 	glVertexArrayAttribIFormat(m_vaoID, 5, 1, GL_INT, offsetof(SingleVertex, matID));
 	glVertexArrayAttribIFormat(m_vaoID, 6, 4, GL_INT, offsetof(SingleVertex, boneIDs));
 	glVertexArrayAttribFormat(m_vaoID, 7, 4, GL_FLOAT, GL_FALSE, offsetof(SingleVertex, weights));
-	// Specify data from the one vertex buffer to binding point 0
+	// Specify data from the one vertex buffer to binding point 0, indexed by the one index buffer
 	glVertexArrayVertexBuffer(m_vaoID, 0, m_vboID, 0, sizeof(SingleVertex));
+	glVertexArrayElementBuffer(m_vaoID, m_iboID);
 
 	// Share VAO for rendering purposes
 	frameData.m_geometryVAOID = m_vaoID;
 
 	// Preference Values
+	bool compressed = false;
 	engine.getPreferenceState().getOrSetValue(PreferenceState::Preference::C_MATERIAL_SIZE, m_materialSize);
+	engine.getPreferenceState().getOrSetValue(PreferenceState::Preference::C_MATERIAL_COMPRESSION, compressed);
+	m_materialFormat = compressed ? Texture_Format::BC3 : Texture_Format::RGBA8;
 
 	// Size-dependent variable set up
 	m_maxMips = GLsizei(floor(log2f(float(m_materialSize)) + 1.0F));
 	glGetIntegerv(GL_MAX_SPARSE_ARRAY_TEXTURE_LAYERS, &m_maxTextureLayers);
+	for (GLsizei m = 0; m < m_maxMips; ++m) {
+		const auto mipSize = std::max<GLsizei>(1, m_materialSize >> m);
+		m_pixelBufferSize = std::max(m_pixelBufferSize, Image_IO::Get_Image_Size(glm::ivec2(mipSize), m_materialFormat) * MAX_DIGITAL_IMAGES);
+	}
 
 	// Initialize the material array
 	glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_matID);
@@ -56,7 +71,7 @@ PropUpload_System::PropUpload_System(Engine& engine, PropData& frameData) :
 	glTextureParameteri(m_matID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	glTextureParameteri(m_matID, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
 	glTextureParameteri(m_matID, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
-	glTextureStorage3D(m_matID, m_maxMips, GL_RGBA16F, m_materialSize, m_materialSize, m_maxTextureLayers);
+	glTextureStorage3D(m_matID, m_maxMips, m_materialFormat == Texture_Format::BC3 ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_RGBA8, m_materialSize, m_materialSize, m_maxTextureLayers);
 
 	// Share material array for rendering purposes
 	frameData.m_materialArrayID = m_matID;
@@ -66,31 +81,40 @@ PropUpload_System::PropUpload_System(Engine& engine, PropData& frameData) :
 		pboID = 0ULL;
 		fence = nullptr;
 		glCreateBuffers(1, &pboID);
-		glNamedBufferStorage(pboID, size_t(m_materialSize) * size_t(m_materialSize) * MAX_DIGITAL_IMAGES * 4ULL, nullptr, GL_DYNAMIC_STORAGE_BIT);
+		glNamedBufferStorage(pboID, m_pixelBufferSize, nullptr, GL_DYNAMIC_STORAGE_BIT);
 	}
 }
 
 void PropUpload_System::updateComponents(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components)
 {
+	// Reclaim geometry from models no longer in use, then compact what remains before handing out offsets
+	releaseUnusedModels();
+	defragment();
+	for (auto& [model, range] : m_modelMap)
+		range.m_users = 0ULL;
+
 	for (const auto& componentParam : components) {
 		auto* propComponent = static_cast<Prop_Component*>(componentParam[0]);
 		auto& model = propComponent->m_model;
 
-		// Try to upload model data
+		// Try to upload model data, as props in the scene are needed before anything else
 		if (!model)
-			model = Shared_Model(m_engine, propComponent->m_modelName);
-		if (!propComponent->m_uploadModel && model->ready()) {
-			tryInsertModel(model);
-			propComponent->m_offset = m_modelMap[model].first;
-			propComponent->m_count = m_modelMap[model].second;
+			model = Shared_Model(m_engine, propComponent->m_modelName, true, Asset_Priority::HIGH);
+		// Offsets are refreshed every frame, as defragmenting may move the model's geometry
+		if (model->ready()) {
+			auto& range = tryInsertModel(model);
+			++range.m_users;
+			propComponent->m_offset = range.m_indexOffset;
+			propComponent->m_count = range.m_indexCount;
+			propComponent->m_baseVertex = static_cast<GLint>(range.m_vertexOffset);
 			propComponent->m_uploadModel = true;
 		}
 
 		// Try to upload material data
 		if (!propComponent->m_uploadMaterial && Asset::All_Ready(model, model->m_materialArray)) {
-			// Get spot in the material array
-			tryInsertMaterial(model->m_materialArray);
-			propComponent->m_materialID = m_materialMap[model->m_materialArray];
+			// Get spot in the material array, materials that can't be uploaded keep the first one
+			if (tryInsertMaterial(model->m_materialArray))
+				propComponent->m_materialID = m_materialMap.at(model->m_materialArray);
 
 			// Prepare fence
 			propComponent->m_uploadMaterial = true;
@@ -98,102 +122,150 @@ void PropUpload_System::updateComponents(const float& /*deltaTime*/, const std::
 	}
 }
 
-void PropUpload_System::tryInsertModel(const Shared_Model& model)
+PropUpload_System::Model_Range& PropUpload_System::tryInsertModel(const Shared_Model& model)
 {
-	if (m_modelMap.find(model) == m_modelMap.end()) {
+	const auto [spot, inserted] = m_modelMap.try_emplace(model);
+	auto& range = spot->second;
+	if (inserted) {
 		// Prop hasn't been uploaded yet
-		const size_t arraySize = model->m_data.m_vertices.size() * sizeof(SingleVertex);
-		// Check if we can fit the desired data
-		waitOnFence();
-		tryToExpand(arraySize);
-		const auto offset = static_cast<GLuint>(m_currentSize / sizeof(SingleVertex));
-		const auto count = static_cast<GLuint>(arraySize / sizeof(SingleVertex));
-
-		// Upload vertex data
-		glNamedBufferSubData(m_vboID, m_currentSize, arraySize, &model->m_data.m_vertices[0]);
-		m_currentSize += arraySize;
-
-		// Prepare fence
-		m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-		m_modelMap[model] = { offset, count };
+		const auto vertexCount = model->m_data.m_vertices.size();
+		const auto indexCount = model->m_data.m_indices.size();
+
+		// Upload vertex and index data, including every level of detail, the indices staying relative to the model's first vertex
+		if (vertexCount != 0ULL && indexCount != 0ULL) {
+			range.m_vertexOffset = allocateRange(m_vboID, m_vertexRanges, vertexCount, sizeof(SingleVertex));
+			range.m_indexOffset = allocateRange(m_iboID, m_indexRanges, indexCount, sizeof(GLuint));
+			range.m_vertexCount = vertexCount;
+			range.m_indexCount = indexCount;
+			glNamedBufferSubData(m_vboID, range.m_vertexOffset * sizeof(SingleVertex), vertexCount * sizeof(SingleVertex), model->m_data.m_vertices.data());
+			glNamedBufferSubData(m_iboID, range.m_indexOffset * sizeof(GLuint), indexCount * sizeof(GLuint), model->m_data.m_indices.data());
+		}
 	}
+	return range;
 }
 
-void PropUpload_System::waitOnFence() noexcept
+void PropUpload_System::releaseUnusedModels()
 {
-	if (m_fence != nullptr) {
-		// Wait for data fence to be passed
-		GLenum state = GL_UNSIGNALED;
-		while (state != GL_SIGNALED && state != GL_ALREADY_SIGNALED && state != GL_CONDITION_SATISFIED)
-			state = glClientWaitSync(m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1);
-		glDeleteSync(m_fence);
-		m_fence = nullptr;
+	// Draws already submitted finish before later uploads overwrite the freed space, as GL orders buffer updates after them
+	for (auto spot = m_modelMap.begin(); spot != m_modelMap.end();) {
+		const auto& range = spot->second;
+		if (range.m_users == 0ULL) {
+			if (range.m_vertexCount != 0ULL) {
+				m_vertexRanges.release(range.m_vertexOffset);
+				m_indexRanges.release(range.m_indexOffset);
+			}
+			spot = m_modelMap.erase(spot);
+		}
+		else
+			++spot;
 	}
 }
 
-void PropUpload_System::tryToExpand(const size_t& arraySize) noexcept
+void PropUpload_System::defragment()
 {
-	if (m_currentSize + arraySize > m_maxCapacity) {
-		// Create new set of VBO's large enough to fit old data + desired data
-		m_maxCapacity += arraySize * 2;
-
-		// Create the new VBO's
-		GLuint newVBOID = 0;
-		glCreateBuffers(1, &newVBOID);
-		glNamedBufferStorage(newVBOID, m_maxCapacity, nullptr, GL_DYNAMIC_STORAGE_BIT);
-
-		// Copy old VBO's
-		auto fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-		glCopyNamedBufferSubData(m_vboID, newVBOID, 0, 0, m_currentSize);
-
-		// Delete the old VBO's
-		GLenum state = GL_UNSIGNALED;
-		while (state != GL_SIGNALED && state != GL_ALREADY_SIGNALED && state != GL_CONDITION_SATISFIED)
-			state = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1);
-		glDeleteSync(fence);
-		glDeleteBuffers(1, &m_vboID);
+	// Move the last model's geometry into earlier gaps, a few at a time
+	size_t budget = PROPUPLOAD_DEFRAG_BUDGET;
+	const auto defragmentBuffer = [&](GLuint& bufferID, Range_Allocator& ranges, const size_t& stride, size_t Model_Range::* offset) {
+		size_t from(0ULL), to(0ULL), count(0ULL);
+		while (ranges.used() < ranges.end() && ranges.defragment(budget / stride, from, to, count)) {
+			glCopyNamedBufferSubData(bufferID, bufferID, from * stride, to * stride, count * stride);
+			budget -= count * stride;
+			for (auto& [model, range] : m_modelMap)
+				if (range.m_vertexCount != 0ULL && range.*offset == from) {
+					range.*offset = to;
+					break;
+				}
+		}
 
-		// Overwrite old VBO ID's
-		m_vboID = newVBOID;
+		// Give back memory once the buffer is mostly empty
+		const auto capacity = ranges.capacity();
+		if (capacity > PROPUPLOAD_INITIAL_CAPACITY && ranges.end() <= capacity / 4ULL && ranges.shrink(capacity / 2ULL))
+			resizeBuffer(bufferID, ranges.end() * stride, ranges.capacity() * stride);
+	};
+	defragmentBuffer(m_vboID, m_vertexRanges, sizeof(SingleVertex), &Model_Range::m_vertexOffset);
+	defragmentBuffer(m_iboID, m_indexRanges, sizeof(GLuint), &Model_Range::m_indexOffset);
+}
 
-		// Assign VAO to new VBO's
-		glVertexArrayVertexBuffer(m_vaoID, 0, m_vboID, 0, sizeof(SingleVertex));
+size_t PropUpload_System::allocateRange(GLuint& bufferID, Range_Allocator& ranges, const size_t& count, const size_t& stride)
+{
+	size_t offset(0ULL);
+	if (!ranges.allocate(count, offset)) {
+		// Grow the buffer to at least twice its size
+		const auto capacity = std::max<size_t>(ranges.capacity() * 2ULL, ranges.capacity() + count);
+		resizeBuffer(bufferID, ranges.end() * stride, capacity * stride);
+		ranges.grow(capacity);
+		ranges.allocate(count, offset);
 	}
+	return offset;
 }
 
-void PropUpload_System::tryInsertMaterial(const Shared_Material& material)
+void PropUpload_System::resizeBuffer(GLuint& bufferID, const size_t& usedSize, const size_t& newSize) noexcept
 {
-	if (m_materialMap.find(material) == m_materialMap.end()) {
-		// Get spot in the material array
-		const auto imageCount = static_cast<GLsizei>((material->m_textures.size() / MAX_PHYSICAL_IMAGES) * MAX_DIGITAL_IMAGES);
-		const auto materialID = static_cast<GLuint>(m_matCount);
-		m_materialMap[material] = materialID;
-		m_matCount += imageCount;
-		if (m_matCount >= m_maxTextureLayers)
-			m_engine.getManager_Messages().error("Out of room for more materials!");
-
-		// Try to upload the images piece-meal
-		size_t offset(0ULL);
-		const auto materialCount = int(material->m_textures.size() / MAX_PHYSICAL_IMAGES);
-		for (int x = 0; x < materialCount; ++x) {
+	// Copy on the GPU, the old buffer is only released by GL once pending commands are done with it
+	GLuint newBufferID = 0;
+	glCreateBuffers(1, &newBufferID);
+	glNamedBufferStorage(newBufferID, newSize, nullptr, GL_DYNAMIC_STORAGE_BIT);
+	if (usedSize != 0ULL)
+		glCopyNamedBufferSubData(bufferID, newBufferID, 0, 0, usedSize);
+	glDeleteBuffers(1, &bufferID);
+	bufferID = newBufferID;
+
+	// Assign VAO to new buffers
+	glVertexArrayVertexBuffer(m_vaoID, 0, m_vboID, 0, sizeof(SingleVertex));
+	glVertexArrayElementBuffer(m_vaoID, m_iboID);
+}
+
+bool PropUpload_System::tryInsertMaterial(const Shared_Material& material)
+{
+	if (m_materialMap.find(material) != m_materialMap.end())
+		return true;
+
+	// Materials must be packed at the array's size and format, as they are uploaded as-is
+	const auto& textureData = material->m_materialData;
+	if (textureData.format != m_materialFormat || textureData.dimensions != glm::ivec2(m_materialSize) || textureData.mipOffsets.size() != static_cast<size_t>(m_maxMips)) {
+		m_engine.getManager_Messages().error("The material \"" + material->getFileName() + "\" doesn't match the material array's size or format.", Message_Category::GRAPHICS);
+		return false;
+	}
+
+	// Get spot in the material array, never committing pages past its last layer
+	const auto imageCount = static_cast<GLsizei>((material->m_textures.size() / MAX_PHYSICAL_IMAGES) * MAX_DIGITAL_IMAGES);
+	if (m_matCount + static_cast<size_t>(imageCount) > static_cast<size_t>(m_maxTextureLayers)) {
+		m_engine.getManager_Messages().error("Out of room for more materials!", Message_Category::GRAPHICS);
+		return false;
+	}
+	const auto materialID = static_cast<GLuint>(m_matCount);
+	m_materialMap[material] = materialID;
+	m_matCount += imageCount;
+	for (int m = 0; m < m_maxMips; ++m) {
+		const GLsizei mipsize = std::max<GLsizei>(1, m_materialSize >> m);
+		glTexturePageCommitmentEXT(m_matID, m, 0, 0, materialID, mipsize, mipsize, imageCount, GL_TRUE);
+	}
+
+	// Try to upload the images piece-meal, one mip level of one material at a time
+	const auto materialCount = int(material->m_textures.size() / MAX_PHYSICAL_IMAGES);
+	for (int x = 0; x < materialCount; ++x) {
+		for (int m = 0; m < m_maxMips; ++m) {
+			const GLsizei mipsize = std::max<GLsizei>(1, m_materialSize >> m);
+			const auto levelSize = Image_IO::Get_Image_Size(glm::ivec2(mipsize), m_materialFormat) * MAX_DIGITAL_IMAGES;
+			const auto offset = textureData.mipOffsets[m] + levelSize * static_cast<size_t>(x);
+
 			// Find a free pixel buffer
 			const auto [pboID, fence] = getFreePBO();
 			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, *pboID);
-			glNamedBufferSubData(*pboID, 0, size_t(m_materialSize) * size_t(m_materialSize) * MAX_DIGITAL_IMAGES * 4ULL, &material->m_materialData[offset]);
+			glNamedBufferSubData(*pboID, 0, levelSize, &textureData.pixelData[offset]);
 
-			// Upload material data
-			for (int m = 0; m < m_maxMips; ++m) {
-				const GLsizei mipsize = static_cast<GLsizei>(std::max(1.0F, (floor(m_materialSize / pow(2.0F, static_cast<float>(m))))));
-				glTexturePageCommitmentEXT(m_matID, m, 0, 0, materialID, mipsize, mipsize, imageCount, GL_TRUE);
-			}
-			glTextureSubImage3D(m_matID, 0, 0, 0, materialID + (x * MAX_DIGITAL_IMAGES), m_materialSize, m_materialSize, MAX_DIGITAL_IMAGES, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-			offset += size_t(m_materialSize) * size_t(m_materialSize) * MAX_DIGITAL_IMAGES * 4ULL;
+			// Upload material data, its mips already generated
+			const auto layer = static_cast<GLint>(materialID + (x * MAX_DIGITAL_IMAGES));
+			if (m_materialFormat == Texture_Format::RGBA8)
+				glTextureSubImage3D(m_matID, m, 0, 0, layer, mipsize, mipsize, MAX_DIGITAL_IMAGES, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+			else
+				glCompressedTextureSubImage3D(m_matID, m, 0, 0, layer, mipsize, mipsize, MAX_DIGITAL_IMAGES, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, static_cast<GLsizei>(levelSize), nullptr);
 
 			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 			*fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 		}
-		glGenerateTextureMipmap(m_matID);
 	}
+	return true;
 }
 
 std::pair<GLuint*, GLsync*> PropUpload_System::getFreePBO() noexcept
@@ -218,19 +290,14 @@ std::pair<GLuint*, GLsync*> PropUpload_System::getFreePBO() noexcept
 
 void PropUpload_System::clear() noexcept
 {
-	// Reset size, and half the capacity
-	m_currentSize = 0ULL;
-	m_maxCapacity = std::max<size_t>(256ULL, m_maxCapacity / 2ULL);
+	// Free all geometry, and half the capacity
 	m_modelMap.clear();
+	m_vertexRanges = Range_Allocator(std::max<size_t>(PROPUPLOAD_INITIAL_CAPACITY, m_vertexRanges.capacity() / 2ULL));
+	m_indexRanges = Range_Allocator(std::max<size_t>(PROPUPLOAD_INITIAL_CAPACITY, m_indexRanges.capacity() / 2ULL));
 
-	// Replace old VBO
-	waitOnFence();
-	GLuint newVBOID = 0;
-	glCreateBuffers(1, &newVBOID);
-	glNamedBufferStorage(newVBOID, m_maxCapacity, nullptr, GL_DYNAMIC_STORAGE_BIT);
-	glDeleteBuffers(1, &m_vboID);
-	m_vboID = newVBOID;
-	glVertexArrayVertexBuffer(m_vaoID, 0, m_vboID, 0, sizeof(SingleVertex));
+	// Replace old VBO and IBO
+	resizeBuffer(m_vboID, 0ULL, m_vertexRanges.capacity() * sizeof(SingleVertex));
+	resizeBuffer(m_iboID, 0ULL, m_indexRanges.capacity() * sizeof(GLuint));
 
 	// Reset materials
 	m_matCount = 0;
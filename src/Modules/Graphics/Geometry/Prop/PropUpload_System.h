@@ -4,10 +4,16 @@
 
 #include "Modules/ECS/ecsSystem.h"
 #include "Assets/Model.h"
+#include "Utilities/Range_Allocator.h"
 #include <array>
 
 #define NUM_VERTEX_ATTRIBUTES 8
 
+/** Initial number of vertices and indices the geometry buffers hold. */
+constexpr size_t PROPUPLOAD_INITIAL_CAPACITY = 1024ULL;
+/** Number of bytes of geometry the geometry buffers may move per frame while defragmenting. */
+constexpr size_t PROPUPLOAD_DEFRAG_BUDGET = 2ULL * 1024ULL * 1024ULL;
+
 
 // Forward Declarations
 class Engine;
@@ -26,22 +32,45 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "PropUpload_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
 private:
+	// Private Structures
+	/** Where a model's geometry lives within the geometry buffers. */
+	struct Model_Range {
+		size_t m_vertexOffset = 0ULL, m_vertexCount = 0ULL, m_indexOffset = 0ULL, m_indexCount = 0ULL;
+		/** Number of props that used this model last frame. */
+		size_t m_users = 0ULL;
+	};
+
+
 	// Private Methods
-	/** Attempt to insert the model supplied into the model map, failing only if it is already present.
-	@param	model		the model to insert only 1 copy of. */
-	void tryInsertModel(const Shared_Model& model);
-	/** Wait on the prop fence if it still exists. */
-	void waitOnFence() noexcept;
-	/** Attempt to expand the props' vertex buffer if it isn't large enough.
-	@param	arraySize	the new size to use. */
-	void tryToExpand(const size_t& arraySize) noexcept;
-	/** Attempt to insert the material supplied into the material map, failing only if it is already present.
-	@param	material	the material to insert only 1 copy of. */
-	void tryInsertMaterial(const Shared_Material& material);
+	/** Attempt to insert the model supplied into the model map, uploading its geometry only if it isn't already present.
+	@param	model		the model to insert only 1 copy of.
+	@return				the model's place in the geometry buffers. */
+	Model_Range& tryInsertModel(const Shared_Model& model);
+	/** Free the geometry of every model no prop used last frame. */
+	void releaseUnusedModels();
+	/** Move some geometry towards the front of the geometry buffers, within a per-frame budget, shrinking them once mostly empty. */
+	void defragment();
+	/** Find room for a model's geometry in one of the geometry buffers, growing it if it isn't large enough.
+	@param	bufferID	reference to the buffer, updated if replaced.
+	@param	ranges		the buffer's allocator.
+	@param	count		the number of elements to fit.
+	@param	stride		the byte-size of each element.
+	@return				the offset of the first element. */
+	size_t allocateRange(GLuint& bufferID, Range_Allocator& ranges, const size_t& count, const size_t& stride);
+	/** Replace one of the geometry buffers with another of a different size, copying over its contents on the GPU.
+	@param	bufferID	reference to the buffer, updated with the replacement.
+	@param	usedSize	the number of bytes at the front of the buffer to keep.
+	@param	newSize		the byte-size of the replacement buffer. */
+	void resizeBuffer(GLuint& bufferID, const size_t& usedSize, const size_t& newSize) noexcept;
+	/** Attempt to insert the material supplied into the material map, uploading it if it isn't already present.
+	@param	material	the material to insert only 1 copy of.
+	@return				true if the material is in the map, false if it doesn't match the material array or there's no room left for it. */
+	bool tryInsertMaterial(const Shared_Material& material);
 	/** Find the first pixel buffer object that isn't in use.
 	@return				the first free PBO. */
 	std::pair<GLuint*, GLsync*> getFreePBO() noexcept;
@@ -65,12 +94,14 @@ private:
 	// Private Attributes
 	Engine& m_engine;
 	PropData& m_frameData;
-	GLuint m_vaoID = 0, m_vboID = 0, m_matID = 0;
-	size_t m_currentSize = 0ull, m_maxCapacity = 256ull, m_matCount = 0ull;
+	GLuint m_vaoID = 0, m_vboID = 0, m_iboID = 0, m_matID = 0;
+	Range_Allocator m_vertexRanges = Range_Allocator(PROPUPLOAD_INITIAL_CAPACITY), m_indexRanges = Range_Allocator(PROPUPLOAD_INITIAL_CAPACITY);
+	size_t m_matCount = 0ull;
 	GLsizei m_materialSize = 512u;
 	GLint m_maxTextureLayers = 6, m_maxMips = 1;
-	GLsync m_fence = nullptr;
-	std::map<Shared_Model, std::pair<GLuint, GLuint>> m_modelMap;
+	Texture_Format m_materialFormat = Texture_Format::RGBA8;
+	size_t m_pixelBufferSize = 0ull;
+	std::map<Shared_Model, Model_Range> m_modelMap;
 	std::map<Shared_Material, GLuint> m_materialMap;
 	std::array<std::pair<GLuint, GLsync>, 4> m_pixelBuffers;
 	std::shared_ptr<bool> m_aliveIndicator = std::make_shared<bool>(true);
@@ -1,49 +1,160 @@
 #include "Modules/Graphics/Geometry/Prop/PropVisibility_System.h"
 #include "Modules/Graphics/Geometry/Prop/PropData.h"
+#include "Modules/Graphics/Common/Camera.h"
 #include "Modules/ECS/component_types.h"
+#include <algorithm>
+#include <cmath>
 
 
-PropVisibility_System::PropVisibility_System(PropData& frameData) :
-	m_frameData(frameData)
+/** Retrieve if a prop has finished uploading and has geometry to draw.
+@param	propComponent	the prop to check.
+@return					true if the prop can be drawn, false otherwise. */
+static bool is_drawable(const Prop_Component& propComponent) noexcept
+{
+	return propComponent.m_count != 0 && propComponent.m_uploadModel && propComponent.m_uploadMaterial;
+}
+
+PropVisibility_System::PropVisibility_System(PropData& frameData, std::vector<Camera*>& sceneCameras) :
+	m_frameData(frameData),
+	m_sceneCameras(sceneCameras)
 {
 	addComponentType(Prop_Component::Runtime_ID, RequirementsFlag::FLAG_REQUIRED);
 	addComponentType(Skeleton_Component::Runtime_ID, RequirementsFlag::FLAG_OPTIONAL);
 	addComponentType(BoundingBox_Component::Runtime_ID, RequirementsFlag::FLAG_OPTIONAL);
+	addComponentType(Transform_Component::Runtime_ID, RequirementsFlag::FLAG_OPTIONAL);
 }
 
 void PropVisibility_System::updateComponents(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components)
 {
+	std::vector<size_t> unbounded;
+	updateHierarchy(components, unbounded);
+
 	// Compile results PER viewport
-	for (auto& viewInfo : m_frameData.viewInfo) {
+	std::vector<size_t> visible;
+	visible.reserve(components.size());
+	for (size_t camIndex = 0ULL; camIndex < m_frameData.viewInfo.size(); ++camIndex) {
+		auto& viewInfo = m_frameData.viewInfo[camIndex];
 		viewInfo.cullingDrawData.clear();
 		viewInfo.renderingDrawData.clear();
 		viewInfo.visibleIndices.clear();
 		viewInfo.skeletonData.clear();
-		int index = 0;
-		for (const auto& componentParam : components) {
+
+		// If FOV is 360, it can see everything
+		visible.clear();
+		const auto* camera = camIndex < m_sceneCameras.size() ? m_sceneCameras[camIndex] : nullptr;
+		if (camera != nullptr && camera->get()->FOV < 359.9F) {
+			m_hierarchy.query(Frustum(camera->get()->pvMatrix), [&visible](const size_t& index) { visible.push_back(index); });
+			visible.insert(visible.end(), unbounded.cbegin(), unbounded.cend());
+			// Keep the draw order stable regardless of the hierarchy's layout
+			std::sort(visible.begin(), visible.end());
+		}
+		else {
+			for (size_t index = 0ULL; index < components.size(); ++index)
+				if (is_drawable(*static_cast<Prop_Component*>(components[index][0])))
+					visible.push_back(index);
+		}
+
+		for (const auto& index : visible) {
+			const auto& componentParam = components[index];
 			const auto* propComponent = static_cast<Prop_Component*>(componentParam[0]);
 			const auto* skeletonComponent = dynamic_cast<Skeleton_Component*>(componentParam[1]);
 			const auto* bboxComponent = dynamic_cast<BoundingBox_Component*>(componentParam[2]);
-			const auto& offset = propComponent->m_offset;
-			const auto& count = propComponent->m_count;
-
-			if ((count != 0U) && propComponent->m_uploadModel && propComponent->m_uploadMaterial) {
-				viewInfo.visibleIndices.push_back(static_cast<GLuint>(index));
-				viewInfo.skeletonData.push_back(skeletonComponent != nullptr ? index : -1); // get skeleton ID if this entity has one
-
-				// Flag for occlusion culling if mesh complexity is high enough and if viewer is NOT within BSphere
-				if ((count >= 100) && (bboxComponent != nullptr) && bboxComponent->m_cameraCollision == BoundingBox_Component::CameraCollision::OUTSIDE) {
-					// Allow occlusion culling
-					viewInfo.cullingDrawData.push_back(glm::ivec4(36, 1, 0, 1));
-					viewInfo.renderingDrawData.push_back(glm::ivec4(count, 0, offset, 1));
-				}
-				else {
-					// Skip occlusion culling
-					viewInfo.cullingDrawData.push_back(glm::ivec4(36, 0, 0, 1));
-					viewInfo.renderingDrawData.push_back(glm::ivec4(count, 1, offset, 1));
-				}
+			auto offset = static_cast<GLuint>(propComponent->m_offset);
+			auto count = static_cast<GLuint>(propComponent->m_count);
+			const auto& baseVertex = propComponent->m_baseVertex;
+			if (const auto& lods = propComponent->m_model->m_data.m_lods; camera != nullptr && !lods.empty()) {
+				const auto& lod = lods[selectLOD(lods, index, *camera)];
+				offset += static_cast<GLuint>(lod.m_firstIndex);
+				count = static_cast<GLuint>(lod.m_indexCount);
+			}
+
+			viewInfo.visibleIndices.push_back(static_cast<GLuint>(index));
+			viewInfo.skeletonData.push_back(skeletonComponent != nullptr ? skeletonComponent->m_paletteOffset : -1); // get skeleton palette offset if this entity has one
+
+			// Flag for occlusion culling if mesh complexity is high enough and if viewer is NOT within BSphere
+			if ((count >= 100) && (bboxComponent != nullptr) && bboxComponent->m_cameraCollision == BoundingBox_Component::CameraCollision::OUTSIDE) {
+				// Allow occlusion culling
+				viewInfo.cullingDrawData.push_back(glm::ivec4(36, 1, 0, 1));
+				viewInfo.renderingDrawData.push_back({ count, 0U, offset, baseVertex, 1U });
 			}
-			index++;
+			else {
+				// Skip occlusion culling
+				viewInfo.cullingDrawData.push_back(glm::ivec4(36, 0, 0, 1));
+				viewInfo.renderingDrawData.push_back({ count, 1U, offset, baseVertex, 1U });
+			}
+		}
+	}
+}
+
+void PropVisibility_System::updateHierarchy(const std::vector<std::vector<ecsBaseComponent*>>& components, std::vector<size_t>& unbounded)
+{
+	++m_frame;
+	m_bounds.assign(components.size(), Prop_Bounds());
+	for (size_t index = 0ULL; index < components.size(); ++index) {
+		const auto& componentParam = components[index];
+		const auto* propComponent = static_cast<Prop_Component*>(componentParam[0]);
+		const auto* transformComponent = dynamic_cast<Transform_Component*>(componentParam[3]);
+		if (!is_drawable(*propComponent))
+			continue;
+		if (transformComponent == nullptr || !propComponent->m_model->ready()) {
+			unbounded.push_back(index);
+			continue;
+		}
+
+		// Transform the model's bounds into world space, enclosing the rotated box in an axis-aligned one
+		const auto& modelMatrix = transformComponent->m_worldTransform.m_modelMatrix;
+		const auto localCenter = (propComponent->m_model->m_bboxMax + propComponent->m_model->m_bboxMin) / 2.0F;
+		const auto localExtent = (propComponent->m_model->m_bboxMax - propComponent->m_model->m_bboxMin) / 2.0F;
+		const auto center = glm::vec3(modelMatrix * glm::vec4(localCenter, 1.0F));
+		const auto extent = glm::abs(glm::vec3(modelMatrix[0])) * localExtent.x
+			+ glm::abs(glm::vec3(modelMatrix[1])) * localExtent.y
+			+ glm::abs(glm::vec3(modelMatrix[2])) * localExtent.z;
+		m_bounds[index] = {
+			center,
+			glm::length(extent),
+			std::max({ glm::length(glm::vec3(modelMatrix[0])), glm::length(glm::vec3(modelMatrix[1])), glm::length(glm::vec3(modelMatrix[2])) })
+		};
+
+		// Only props that left their leaf's padded bounds restructure the hierarchy
+		auto& propLeaf = m_leaves[propComponent->m_entity];
+		if (propLeaf.leaf < 0)
+			propLeaf.leaf = m_hierarchy.insert(center - extent, center + extent, index);
+		else {
+			m_hierarchy.update(propLeaf.leaf, center - extent, center + extent);
+			m_hierarchy.setUserData(propLeaf.leaf, index);
+		}
+		propLeaf.frame = m_frame;
+	}
+
+	// Remove props that were deleted, or lost their transform or geometry
+	for (auto leaf = m_leaves.begin(); leaf != m_leaves.end();) {
+		if (leaf->second.frame != m_frame) {
+			m_hierarchy.remove(leaf->second.leaf);
+			leaf = m_leaves.erase(leaf);
 		}
+		else
+			++leaf;
 	}
+}
+
+size_t PropVisibility_System::selectLOD(const std::vector<Geometry_LOD>& lods, const size_t& index, const Camera& camera) const noexcept
+{
+	// Props without a transform have no bounds to measure, so always draw in full
+	const auto& bounds = m_bounds[index];
+	if (lods.size() < 2ULL || bounds.scale <= 0.0F)
+		return 0ULL;
+
+	// Find how many pixels a model-space unit covers at the prop's nearest point
+	// The projection's vertical scale is shared by both perspective and orthographic views, only perspective dividing by distance
+	const auto& camData = *camera.get();
+	auto pixelsPerUnit = std::abs(camData.pMatrix[1][1]) * camData.Dimensions.y * 0.5F * bounds.scale;
+	if (camData.pMatrix[2][3] != 0.0F)
+		pixelsPerUnit /= std::max(glm::distance(camData.EyePosition, bounds.center) - bounds.radius, Camera::ConstNearPlane);
+
+	// Errors grow along the chain, so stop at the first level that shows too much
+	const auto threshold = PROPVISIBILITY_LOD_PIXEL_ERROR * camera.m_lodBias;
+	size_t lod(0ULL);
+	while (lod + 1ULL < lods.size() && lods[lod + 1ULL].m_error * pixelsPerUnit <= threshold)
+		++lod;
+	return lod;
 }
\ No newline at end of file
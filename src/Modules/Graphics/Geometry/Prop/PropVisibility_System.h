@@ -3,27 +3,66 @@
 #define PROPVISIBILITY_SYSTEM_H
 
 #include "Modules/ECS/ecsSystem.h"
+#include "Utilities/BVH.h"
+#include <unordered_map>
 
 
+/** Largest error, in pixels, a prop's level of detail may show in a perspective before its lod bias. */
+constexpr float PROPVISIBILITY_LOD_PIXEL_ERROR = 1.0F;
+
 // Forward Declarations
+class Camera;
+struct Geometry_LOD;
 struct PropData;
 
-/** An ECS system responsible for populating render lists PER active perspective in a given frame, for all prop related entities. */
+/** An ECS system responsible for populating render lists PER active perspective in a given frame, for all prop related entities.
+Props are kept in a bounding volume hierarchy, which each perspective queries with its frustum.
+Each perspective draws the coarsest level of detail whose error projects within its pixel threshold. */
 class PropVisibility_System final : public ecsBaseSystem {
 public:
 	// Public (De)Constructors
 	/** Construct this system.
-	@param	frameData	reference to of common data that changes frame-to-frame. */
-	explicit PropVisibility_System(PropData& frameData);
+	@param	frameData		reference to of common data that changes frame-to-frame.
+	@param	sceneCameras	reference to the scene cameras to use. */
+	PropVisibility_System(PropData& frameData, std::vector<Camera*>& sceneCameras);
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "PropVisibility_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
 private:
+	// Private Methods
+	/** Synchronize the hierarchy with the world-space bounds of every prop this frame.
+	@param	components		the components to synchronize.
+	@param	unbounded		output list of drawable props lacking a transform, visible to every perspective. */
+	void updateHierarchy(const std::vector<std::vector<ecsBaseComponent*>>& components, std::vector<size_t>& unbounded);
+	/** Choose the level of detail to draw a prop with in a perspective.
+	@param	lods			the prop's levels of detail, finest first.
+	@param	index			the prop's component index.
+	@param	camera			the perspective to choose for.
+	@return					the index of the level of detail to draw. */
+	size_t selectLOD(const std::vector<Geometry_LOD>& lods, const size_t& index, const Camera& camera) const noexcept;
+
+
 	// Private Attributes
 	PropData& m_frameData;
+	std::vector<Camera*>& m_sceneCameras;
+	/** A prop's leaf in the hierarchy, and the last frame it was seen. */
+	struct Prop_Leaf {
+		int leaf = -1;
+		size_t frame = 0ULL;
+	};
+	/** A prop's world-space bounding sphere, and how much its transform scales model-space distances. */
+	struct Prop_Bounds {
+		glm::vec3 center = glm::vec3(0.0F);
+		float radius = 0.0F, scale = 0.0F;
+	};
+	BVH m_hierarchy;
+	std::unordered_map<EntityHandle, Prop_Leaf> m_leaves;
+	std::vector<Prop_Bounds> m_bounds;
+	size_t m_frame = 0ULL;
 };
 
 #endif // PROPVISIBILITY_SYSTEM_H
\ No newline at end of file
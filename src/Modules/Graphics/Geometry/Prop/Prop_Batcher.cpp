@@ -0,0 +1,72 @@
+#include "Modules/Graphics/Geometry/Prop/Prop_Batcher.h"
+#include <cstdint>
+
+
+void Prop_Batcher::build(const std::vector<PropData::ViewInfo>& viewInfo, const std::vector<std::pair<int, int>>& perspectives, PropData::DrawList& drawList)
+{
+	drawList.camIndices.clear();
+	drawList.propIndices.clear();
+	drawList.skeletonIndices.clear();
+	drawList.cullingDrawData.clear();
+	drawList.renderingDrawData.clear();
+	m_instances.clear();
+
+	// Occlusion culled props are drawn alone, everything else waits to be batched
+	for (const auto& [camIndex, layer] : perspectives) {
+		const auto& view = viewInfo[camIndex];
+		for (size_t x = 0ULL; x < view.visibleIndices.size(); ++x) {
+			const auto& draw = view.renderingDrawData[x];
+			if (view.cullingDrawData[x].y != 0) {
+				const auto baseInstance = static_cast<GLuint>(drawList.propIndices.size());
+				drawList.camIndices.emplace_back(camIndex, layer);
+				drawList.propIndices.push_back(view.visibleIndices[x]);
+				drawList.skeletonIndices.push_back(view.skeletonData[x]);
+				drawList.cullingDrawData.emplace_back(36, 1, 0, static_cast<int>(baseInstance));
+				drawList.renderingDrawData.push_back({ draw.count, draw.instanceCount, draw.firstIndex, draw.baseVertex, baseInstance });
+			}
+			else
+				m_instances.push_back({ draw.count, draw.firstIndex, draw.baseVertex, glm::ivec2(camIndex, layer), view.visibleIndices[x], view.skeletonData[x] });
+		}
+	}
+
+	// Group props sharing a geometry range in order of first appearance, keeping their original order within each group
+	// Models own disjoint ranges of the shared index buffer, so the first index and count identify the geometry
+	m_groups.clear();
+	m_groupSizes.clear();
+	m_instanceGroups.resize(m_instances.size());
+	for (size_t x = 0ULL; x < m_instances.size(); ++x) {
+		const auto key = (static_cast<std::uint64_t>(m_instances[x].firstIndex) << 32ULL) | static_cast<std::uint64_t>(m_instances[x].count);
+		const auto [group, inserted] = m_groups.try_emplace(key, m_groupSizes.size());
+		if (inserted)
+			m_groupSizes.push_back(0ULL);
+		m_instanceGroups[x] = group->second;
+		++m_groupSizes[group->second];
+	}
+
+	// Emit one draw per group, then place each instance within its group's range
+	const auto firstBatched = drawList.propIndices.size();
+	m_groupOffsets.resize(m_groupSizes.size());
+	auto baseInstance = static_cast<GLuint>(firstBatched);
+	for (size_t x = 0ULL; x < m_instances.size(); ++x) {
+		const auto& group = m_instanceGroups[x];
+		if (m_groupSizes[group] == 0ULL)
+			continue;
+		const auto& instance = m_instances[x];
+		const auto count = static_cast<GLuint>(m_groupSizes[group]);
+		m_groupOffsets[group] = baseInstance;
+		drawList.cullingDrawData.emplace_back(36, 0, 0, static_cast<int>(baseInstance));
+		drawList.renderingDrawData.push_back({ instance.count, count, instance.firstIndex, instance.baseVertex, baseInstance });
+		m_groupSizes[group] = 0ULL;
+		baseInstance += count;
+	}
+	drawList.camIndices.resize(baseInstance);
+	drawList.propIndices.resize(baseInstance);
+	drawList.skeletonIndices.resize(baseInstance);
+	for (size_t x = 0ULL; x < m_instances.size(); ++x) {
+		const auto& instance = m_instances[x];
+		const auto slot = m_groupOffsets[m_instanceGroups[x]]++;
+		drawList.camIndices[slot] = instance.camIndex;
+		drawList.propIndices[slot] = instance.propIndex;
+		drawList.skeletonIndices[slot] = instance.skeletonIndex;
+	}
+}
\ No newline at end of file
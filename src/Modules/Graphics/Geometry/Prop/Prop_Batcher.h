@@ -0,0 +1,44 @@
+#pragma once
+#ifndef PROP_BATCHER_H
+#define PROP_BATCHER_H
+
+#include "Modules/Graphics/Geometry/Prop/PropData.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+
+/** Merges the visible props of several perspectives into one draw list, batching props that share geometry into instanced draws.
+Props flagged for occlusion culling keep a draw each, as culling decides whether whole draws are rendered. */
+class Prop_Batcher {
+public:
+	// Public Methods
+	/** Build the draw list for a multi-draw call.
+	@param	viewInfo		the visible props of every perspective.
+	@param	perspectives	the camera index and layer of each perspective to draw.
+	@param	drawList		reference to the draw list to replace. */
+	void build(const std::vector<PropData::ViewInfo>& viewInfo, const std::vector<std::pair<int, int>>& perspectives, PropData::DrawList& drawList);
+
+
+private:
+	// Private Structures
+	/** A visible prop awaiting a batch. */
+	struct Prop_Instance {
+		GLuint count, firstIndex;
+		GLint baseVertex;
+		glm::ivec2 camIndex;
+		GLuint propIndex;
+		int skeletonIndex;
+	};
+
+
+	// Private Attributes
+	std::vector<Prop_Instance> m_instances;
+	/** Each geometry range's group, keyed by its first index in the upper 32 bits and its count in the lower. */
+	std::unordered_map<std::uint64_t, size_t> m_groups;
+	std::vector<size_t> m_groupSizes, m_instanceGroups;
+	std::vector<GLuint> m_groupOffsets;
+};
+
+#endif // PROP_BATCHER_H
\ No newline at end of file
@@ -16,8 +16,9 @@ Prop_Technique::Prop_Technique(Engine& engine, std::vector<Camera*>& sceneCamera
 {
 	// Auxiliary Systems
 	m_auxilliarySystems.makeSystem<PropUpload_System>(engine, m_frameData);
-	m_auxilliarySystems.makeSystem<PropVisibility_System>(m_frameData);
+	// Sync before visibility, which passes on the skeleton palette offsets sync assigns
 	m_auxilliarySystems.makeSystem<PropSync_System>(m_frameData);
+	m_auxilliarySystems.makeSystem<PropVisibility_System>(m_frameData, sceneCameras);
 }
 
 void Prop_Technique::clearCache(const float& /*deltaTime*/) noexcept
@@ -42,23 +43,17 @@ void Prop_Technique::renderTechnique(const float& /*deltaTime*/, Viewport& viewp
 		if (m_drawIndex >= m_drawData.size())
 			m_drawData.resize(size_t(m_drawIndex) + 1ULL);
 
-		// Accumulate all visibility info for the cameras passed in
-		std::vector<glm::ivec2> camIndices;
-		std::vector<glm::ivec4> cullingDrawData;
-		std::vector<glm::ivec4> renderingDrawData;
-		std::vector<GLuint> visibleIndices;
-		std::vector<int> skeletonData;
-		for (auto& [camIndex, layer] : perspectives) {
-			const std::vector<glm::ivec2> tempIndices(m_frameData.viewInfo[camIndex].visibleIndices.size(), { camIndex, layer });
-			camIndices.insert(camIndices.end(), tempIndices.begin(), tempIndices.end());
-			visibleIndices.insert(visibleIndices.end(), m_frameData.viewInfo[camIndex].visibleIndices.begin(), m_frameData.viewInfo[camIndex].visibleIndices.end());
-			cullingDrawData.insert(cullingDrawData.end(), m_frameData.viewInfo[camIndex].cullingDrawData.begin(), m_frameData.viewInfo[camIndex].cullingDrawData.end());
-			renderingDrawData.insert(renderingDrawData.end(), m_frameData.viewInfo[camIndex].renderingDrawData.begin(), m_frameData.viewInfo[camIndex].renderingDrawData.end());
-			skeletonData.insert(skeletonData.end(), m_frameData.viewInfo[camIndex].skeletonData.begin(), m_frameData.viewInfo[camIndex].skeletonData.end());
-		}
+		// Batch all visibility info for the cameras passed in, props sharing geometry becoming one instanced draw
+		m_batcher.build(m_frameData.viewInfo, perspectives, m_drawList);
+		const auto& camIndices = m_drawList.camIndices;
+		const auto& visibleIndices = m_drawList.propIndices;
+		const auto& skeletonData = m_drawList.skeletonIndices;
+		const auto& cullingDrawData = m_drawList.cullingDrawData;
+		const auto& renderingDrawData = m_drawList.renderingDrawData;
+		const auto drawCount = static_cast<GLsizei>(renderingDrawData.size());
 
 		// Write all visibility info to a set of buffers
-		if (!visibleIndices.empty()) {
+		if (drawCount != 0) {
 			auto& drawBuffer = m_drawData[m_drawIndex];
 			auto& camBufferIndex = drawBuffer.bufferCamIndex;
 			auto& propIndexBuffer = drawBuffer.bufferPropIndex;
@@ -77,7 +72,7 @@ void Prop_Technique::renderTechnique(const float& /*deltaTime*/, Viewport& viewp
 			camBufferIndex.write(0, sizeof(glm::ivec2) * camIndices.size(), camIndices.data());
 			propIndexBuffer.write(0, sizeof(GLuint) * visibleIndices.size(), visibleIndices.data());
 			propCullingBuffer.write(0, sizeof(glm::ivec4) * cullingDrawData.size(), cullingDrawData.data());
-			propRenderBuffer.write(0, sizeof(glm::ivec4) * renderingDrawData.size(), renderingDrawData.data());
+			propRenderBuffer.write(0, sizeof(PropData::Draw_Buffer) * renderingDrawData.size(), renderingDrawData.data());
 			propSkeletonBuffer.write(0, sizeof(int) * skeletonData.size(), skeletonData.data());
 
 			// End writing
@@ -106,7 +101,7 @@ void Prop_Technique::renderTechnique(const float& /*deltaTime*/, Viewport& viewp
 			glBindVertexArray(m_shapeCube->m_vaoID);
 			propCullingBuffer.bindBuffer(GL_DRAW_INDIRECT_BUFFER);
 			propRenderBuffer.bindBufferBase(GL_SHADER_STORAGE_BUFFER, 8);
-			glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, static_cast<GLsizei>(visibleIndices.size()), 0);
+			glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, drawCount, 0);
 			glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
 			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 8, 0);
 
@@ -120,7 +115,7 @@ void Prop_Technique::renderTechnique(const float& /*deltaTime*/, Viewport& viewp
 			glBindVertexArray(m_frameData.m_geometryVAOID);
 			glBindTextureUnit(0, m_frameData.m_materialArrayID);
 			propRenderBuffer.bindBuffer(GL_DRAW_INDIRECT_BUFFER);
-			glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, static_cast<GLsizei>(visibleIndices.size()), 0);
+			glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, drawCount, 0);
 
 			// Copy depth for next frame
 			viewport.m_gfxFBOS.bindForWriting("DEPTH-ONLY");
@@ -146,23 +141,17 @@ void Prop_Technique::cullShadows(const float& /*deltaTime*/, const std::vector<s
 		if (m_drawIndex >= m_drawData.size())
 			m_drawData.resize(size_t(m_drawIndex) + 1ULL);
 
-		// Accumulate all visibility info for the cameras passed in
-		std::vector<glm::ivec2> camIndices;
-		std::vector<glm::ivec4> cullingDrawData;
-		std::vector<glm::ivec4> renderingDrawData;
-		std::vector<GLuint> visibleIndices;
-		std::vector<int> skeletonData;
-		for (auto& [camIndex, layer] : perspectives) {
-			const std::vector<glm::ivec2> tempIndices(m_frameData.viewInfo[camIndex].visibleIndices.size(), { camIndex, layer });
-			camIndices.insert(camIndices.end(), tempIndices.begin(), tempIndices.end());
-			visibleIndices.insert(visibleIndices.end(), m_frameData.viewInfo[camIndex].visibleIndices.begin(), m_frameData.viewInfo[camIndex].visibleIndices.end());
-			cullingDrawData.insert(cullingDrawData.end(), m_frameData.viewInfo[camIndex].cullingDrawData.begin(), m_frameData.viewInfo[camIndex].cullingDrawData.end());
-			renderingDrawData.insert(renderingDrawData.end(), m_frameData.viewInfo[camIndex].renderingDrawData.begin(), m_frameData.viewInfo[camIndex].renderingDrawData.end());
-			skeletonData.insert(skeletonData.end(), m_frameData.viewInfo[camIndex].skeletonData.begin(), m_frameData.viewInfo[camIndex].skeletonData.end());
-		}
+		// Batch all visibility info for the cameras passed in, props sharing geometry becoming one instanced draw
+		m_batcher.build(m_frameData.viewInfo, perspectives, m_drawList);
+		const auto& camIndices = m_drawList.camIndices;
+		const auto& visibleIndices = m_drawList.propIndices;
+		const auto& skeletonData = m_drawList.skeletonIndices;
+		const auto& cullingDrawData = m_drawList.cullingDrawData;
+		const auto& renderingDrawData = m_drawList.renderingDrawData;
+		const auto drawCount = static_cast<GLsizei>(renderingDrawData.size());
 
 		// Write all visibility info to a set of buffers
-		if (!visibleIndices.empty()) {
+		if (drawCount != 0) {
 			auto& drawBuffer = m_drawData[m_drawIndex];
 			auto& camBufferIndex = drawBuffer.bufferCamIndex;
 			auto& propIndexBuffer = drawBuffer.bufferPropIndex;
@@ -181,7 +170,7 @@ void Prop_Technique::cullShadows(const float& /*deltaTime*/, const std::vector<s
 			camBufferIndex.write(0, sizeof(glm::ivec2) * camIndices.size(), camIndices.data());
 			propIndexBuffer.write(0, sizeof(GLuint) * visibleIndices.size(), visibleIndices.data());
 			propCullingBuffer.write(0, sizeof(glm::ivec4) * cullingDrawData.size(), cullingDrawData.data());
-			propRenderBuffer.write(0, sizeof(glm::ivec4) * renderingDrawData.size(), renderingDrawData.data());
+			propRenderBuffer.write(0, sizeof(PropData::Draw_Buffer) * renderingDrawData.size(), renderingDrawData.data());
 			propSkeletonBuffer.write(0, sizeof(int) * skeletonData.size(), skeletonData.data());
 
 			// End writing
@@ -209,10 +198,10 @@ void Prop_Technique::cullShadows(const float& /*deltaTime*/, const std::vector<s
 			glBindVertexArray(m_shapeCube->m_vaoID);
 			propCullingBuffer.bindBuffer(GL_DRAW_INDIRECT_BUFFER);
 			propRenderBuffer.bindBufferBase(GL_SHADER_STORAGE_BUFFER, 8);
-			glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, static_cast<GLsizei>(visibleIndices.size()), 0);
+			glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, drawCount, 0);
 			glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
 			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 8, 0);
-			m_count = visibleIndices.size();
+			m_count = renderingDrawData.size();
 
 			Shader::Release();
 		}
@@ -234,7 +223,7 @@ void Prop_Technique::renderShadows(const float& /*deltaTime*/) noexcept
 			glBindVertexArray(m_frameData.m_geometryVAOID);
 			glBindTextureUnit(0, m_frameData.m_materialArrayID);
 			m_drawData[m_drawIndex].bufferRender.bindBuffer(GL_DRAW_INDIRECT_BUFFER);
-			glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, static_cast<GLsizei>(m_count), 0);
+			glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(m_count), 0);
 			glFrontFace(GL_CCW);
 			glCullFace(GL_BACK);
 			auto& drawBuffer = m_drawData[m_drawIndex];
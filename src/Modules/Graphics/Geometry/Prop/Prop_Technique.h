@@ -4,6 +4,7 @@
 
 #include "Modules/Graphics/Geometry/Geometry_Technique.h"
 #include "Modules/Graphics/Geometry/Prop/PropData.h"
+#include "Modules/Graphics/Geometry/Prop/Prop_Batcher.h"
 #include "Modules/Graphics/Common/Camera.h"
 #include "Modules/ECS/ecsSystem.h"
 #include "Utilities/GL/DynamicBuffer.h"
@@ -22,6 +23,7 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "Prop_Technique"; }
 	void clearCache(const float& deltaTime) noexcept final;
 	void updateCache(const float& deltaTime, ecsWorld& world) final;
 	void renderTechnique(const float& deltaTime, Viewport& viewport, const std::vector<std::pair<int, int>>& perspectives) final;
@@ -45,6 +47,8 @@ private:
 	int m_drawIndex = 0;
 	size_t m_count = 0ull;
 	std::vector<DrawData> m_drawData;
+	Prop_Batcher m_batcher;
+	PropData::DrawList m_drawList;
 	ecsSystemList m_auxilliarySystems;
 
 
@@ -1,6 +1,7 @@
 #include "Modules/Graphics/Graphics_M.h"
 #include "Modules/Graphics/Common/Camera.h"
 #include "Modules/Graphics/Common/Viewport.h"
+#include "Utilities/Profiler.h"
 #include "Engine.h"
 
 
@@ -91,6 +92,7 @@ void Graphics_Module::renderWorld(ecsWorld& world, const float& deltaTime, const
 
 void Graphics_Module::renderWorld(ecsWorld& world, const float& deltaTime, Viewport& viewport, std::vector<Camera>& cameras)
 {
+	PROFILE_ZONE("Module", "Graphics_Module::renderWorld");
 	if (!cameras.empty()) {
 		// Prepare rendering pipeline for a new frame, wait for buffers to free
 		const auto perspectives = m_pipeline.begin(deltaTime, world, cameras);
@@ -25,6 +25,7 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "Direct_Technique"; }
 	void clearCache(const float& deltaTime) noexcept final;
 	void updateCache(const float& deltaTime, ecsWorld& world) final;
 	void renderTechnique(const float& deltaTime, Viewport& viewport, const std::vector<std::pair<int, int>>& perspectives) final;
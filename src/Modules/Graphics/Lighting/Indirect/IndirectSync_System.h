@@ -18,6 +18,7 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "IndirectSync_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
@@ -22,6 +22,7 @@ public:
 	Shadow_Technique(Engine& engine, std::vector<Camera*>& sceneCameras);
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "Shadow_Technique"; }
 	void clearCache(const float& deltaTime) noexcept final;
 	void updateCache(const float& deltaTime, ecsWorld& world) final;
 	void updatePass(const float& deltaTime) final;
@@ -5,14 +5,22 @@
 FrustumCull_System::FrustumCull_System(std::vector<Camera*>& sceneCameras) :
 	m_sceneCameras(sceneCameras)
 {
-	addComponentType(Transform_Component::Runtime_ID, RequirementsFlag::FLAG_REQUIRED);
+	addComponentType(Transform_Component::Runtime_ID, RequirementsFlag::FLAG_REQUIRED, AccessFlag::ACCESS_READ_ONLY);
 	addComponentType(BoundingBox_Component::Runtime_ID, RequirementsFlag::FLAG_OPTIONAL);
 	addComponentType(BoundingSphere_Component::Runtime_ID, RequirementsFlag::FLAG_OPTIONAL);
+	// Each entity is culled independently, and the scene cameras are only read from
+	setConcurrent(true, 256ULL);
 }
 
-void FrustumCull_System::updateComponents(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components)
+void FrustumCull_System::updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components)
 {
-	for (const auto& componentParam : components) {
+	updateComponentRange(deltaTime, components, 0ULL, components.size());
+}
+
+void FrustumCull_System::updateComponentRange(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components, const size_t& begin, const size_t& end)
+{
+	for (auto index = begin; index < end; ++index) {
+		const auto& componentParam = components[index];
 		const auto* transformComponent = static_cast<Transform_Component*>(componentParam[0]);
 		auto* bboxComponent = dynamic_cast<BoundingBox_Component*>(componentParam[1]);
 		auto* bsphereComponent = dynamic_cast<BoundingSphere_Component*>(componentParam[2]);
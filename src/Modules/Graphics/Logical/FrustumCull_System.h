@@ -18,7 +18,9 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "FrustumCull_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
+	void updateComponentRange(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components, const size_t& begin, const size_t& end) final;
 
 
 private:
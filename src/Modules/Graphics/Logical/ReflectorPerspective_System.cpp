@@ -12,7 +12,9 @@ void ReflectorPerspective_System::updateComponents(const float& /*deltaTime*/, c
 {
 	for (const auto& componentParam : components) {
 		auto* cameraComponent = static_cast<Reflector_Component*>(componentParam[0]);
-		for (auto& camera : cameraComponent->m_cameras)
+		for (auto& camera : cameraComponent->m_cameras) {
+			camera.m_lodBias = REFLECTORPERSPECTIVE_LOD_BIAS;
 			m_sceneCameras.push_back(&camera);
+		}
 	}
 }
\ No newline at end of file
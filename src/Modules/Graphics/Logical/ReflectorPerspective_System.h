@@ -5,6 +5,9 @@
 #include "Modules/ECS/ecsSystem.h"
 
 
+/** Reflections are blurred and seen indirectly, so they draw coarser levels of detail. */
+constexpr float REFLECTORPERSPECTIVE_LOD_BIAS = 2.0F;
+
 // Forward Declarations
 class Camera;
 
@@ -18,6 +21,7 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "ReflectorPerspective_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
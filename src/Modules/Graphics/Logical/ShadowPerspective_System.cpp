@@ -11,7 +11,9 @@ ShadowPerspective_System::ShadowPerspective_System(std::vector<Camera*>& sceneCa
 void ShadowPerspective_System::updateComponents(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components) {
 	for (const auto& componentParam : components) {
 		auto* shadow = static_cast<Shadow_Component*>(componentParam[0]);
-		for (auto& camera : shadow->m_cameras)
+		for (auto& camera : shadow->m_cameras) {
+			camera.m_lodBias = SHADOWPERSPECTIVE_LOD_BIAS;
 			m_sceneCameras.push_back(&camera);
+		}
 	}
 }
\ No newline at end of file
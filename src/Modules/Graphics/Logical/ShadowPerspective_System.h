@@ -5,6 +5,9 @@
 #include "Modules/ECS/ecsSystem.h"
 
 
+/** Shadow maps only capture silhouettes at a lower resolution than the screen, so they draw much coarser levels of detail. */
+constexpr float SHADOWPERSPECTIVE_LOD_BIAS = 4.0F;
+
 // Forward Declarations
 class Camera;
 
@@ -18,6 +21,7 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "ShadowPerspective_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
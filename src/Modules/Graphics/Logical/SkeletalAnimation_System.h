@@ -9,7 +9,6 @@
 
 // Forward Declarations
 class Engine;
-struct Node;
 
 /** A system responsible for animating props with skeleton components. */
 class Skeletal_Animation_System final : public ecsBaseSystem {
@@ -20,19 +19,9 @@ public:
 
 
 	// Public Interface Implementation
+	inline const char* getName() const noexcept final { return "Skeletal_Animation_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
-
-
-protected:
-	// Protected Methods
-	/** Process animation nodes from a scene, updating a series of transformation matrix representing the bones in the skeleton.
-	@param	transforms		matrix vector representing bones in the skeleton.
-	@param	AnimationTime	the current time in the animation.
-	@param	animation_ID	id for the current animation to process.
-	@param	parentNode		parent node in the node hierarchy.
-	@param	model			the model to process the animations from.
-	@param	ParentTransform	parent transform in the node hierarchy. */
-	static void ReadNodeHeirarchy(std::vector<glm::mat4>& transforms, const float& AnimationTime, const int& animation_ID, const Node& parentNode, const Shared_Mesh& model, const glm::mat4& ParentTransform);
+	void updateComponentRange(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components, const size_t& begin, const size_t& end) final;
 };
 
 #endif // SKELETALANIMATION_SYSTEM_H
\ No newline at end of file
@@ -7,13 +7,18 @@ Transform_System::Transform_System(Engine& engine) :
 	m_engine(engine)
 {
 	addComponentType(Transform_Component::Runtime_ID, RequirementsFlag::FLAG_REQUIRED);
+	// The hierarchy only reads the world's entities, and writes transforms
+	setConcurrent(true);
 }
 
 void Transform_System::updateComponents(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components)
 {
 	// Reset the world transform to be the local transform of all components
+	m_previousMatrices.resize(components.size());
+	size_t index(0ULL);
 	for (const auto& componentParam : components) {
 		auto* transformComponent = static_cast<Transform_Component*>(componentParam[0]);
+		m_previousMatrices[index++] = transformComponent->m_worldTransform.m_modelMatrix;
 		transformComponent->m_worldTransform = transformComponent->m_localTransform;
 	}
 
@@ -31,4 +36,13 @@ void Transform_System::updateComponents(const float& /*deltaTime*/, const std::v
 	EntityHandle rootHandle;
 	for (const auto& entity : m_world->getEntityHandles(rootHandle))
 		transformHierarchy(entity);
+
+	// Stamp components that moved, however they were moved, so only they need uploading
+	index = 0ULL;
+	for (const auto& componentParam : components) {
+		auto* transformComponent = static_cast<Transform_Component*>(componentParam[0]);
+		if (transformComponent->m_version == 0ULL || transformComponent->m_worldTransform.m_modelMatrix != m_previousMatrices[index])
+			transformComponent->m_version = Next_Component_Version();
+		++index;
+	}
 }
\ No newline at end of file
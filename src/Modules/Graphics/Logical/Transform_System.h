@@ -3,6 +3,7 @@
 #define TRANSFORM_SYSTEM_H
 
 #include "Modules/ECS/ecsSystem.h"
+#include "glm/glm.hpp"
 
 
 // Forward Declarations
@@ -19,12 +20,19 @@ public:
 
 
 	// Public Interface Implementations
+	inline const char* getName() const noexcept final { return "Transform_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
 	// Public Attributes
 	Engine& m_engine;
 	ecsWorld* m_world = nullptr;
+
+
+private:
+	// Private Attributes
+	/** Each component's world matrix before this frame's update, to detect changes. */
+	std::vector<glm::mat4> m_previousMatrices;
 };
 
 #endif // TRANSFORM_SYSTEM_H
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include "Modules/Physics/Body_Placement.h"
+#include "btBulletDynamicsCommon.h"
+
+
+void Body_Placement::Move(btDiscreteDynamicsWorld& world, btRigidBody& body, const btTransform& transform)
+{
+	body.setWorldTransform(transform);
+	body.setInterpolationWorldTransform(transform);
+	if (!body.isStaticOrKinematicObject()) {
+		// Match a newly built body, which starts at rest
+		body.setLinearVelocity(btVector3(0, 0, 0));
+		body.setAngularVelocity(btVector3(0, 0, 0));
+		body.setInterpolationLinearVelocity(btVector3(0, 0, 0));
+		body.setInterpolationAngularVelocity(btVector3(0, 0, 0));
+		body.activate();
+	}
+	world.updateSingleAabb(&body);
+}
\ No newline at end of file
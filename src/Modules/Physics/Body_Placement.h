@@ -0,0 +1,24 @@
+#pragma once
+#ifndef BODY_PLACEMENT_H
+#define BODY_PLACEMENT_H
+
+#include "LinearMath/btTransform.h"
+
+
+// Forward Declarations
+class btDiscreteDynamicsWorld;
+class btRigidBody;
+
+/** A static helper class used for placing rigid bodies that are already part of a physics world. */
+class Body_Placement {
+public:
+	// Public Methods
+	/** Move a body to a new transform in place, keeping its broadphase proxy and contact cache rather than rebuilding it.
+	@note				dynamic bodies are brought to rest and woken, matching a newly built body.
+	@param	world		the physics world holding the body.
+	@param	body		the body to move.
+	@param	transform	the transform to move the body to. */
+	static void Move(btDiscreteDynamicsWorld& world, btRigidBody& body, const btTransform& transform);
+};
+
+#endif // BODY_PLACEMENT_H
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Modules/Physics/ECS/PhysicsSync_System.h"
 #include "Modules/ECS/component_types.h"
+#include "Modules/Physics/Body_Placement.h"
+#include "Engine.h"
 #include "glm/glm.hpp"
 
 
@@ -15,6 +17,8 @@ PhysicsSync_System::PhysicsSync_System(Engine& engine, btDiscreteDynamicsWorld&
 
 void PhysicsSync_System::updateComponents(const float& /*deltaTime*/, const std::vector<std::vector<ecsBaseComponent*>>& components)
 {
+	// Render bodies part way between their last 2 simulation steps, matching the time left unsimulated
+	const auto interpolation = m_engine.getModule_Physics().getInterpolation();
 	for (const auto& componentParam : components) {
 		auto* transformComponent = static_cast<Transform_Component*>(componentParam[0]);
 		auto* colliderComponent = dynamic_cast<Collider_Component*>(componentParam[1]);
@@ -29,37 +33,52 @@ void PhysicsSync_System::updateComponents(const float& /*deltaTime*/, const std:
 			else if (colliderComponent->m_collider->ready()) {
 				// If the collider's transformation is out of date
 				if (colliderComponent->m_worldTransform != transformComponent->m_localTransform) {
-					// Remove from the physics simulation
-					if (colliderComponent->m_rigidBody) {
-						m_world.removeRigidBody(colliderComponent->m_rigidBody.get());
-						colliderComponent->m_rigidBody.reset();
-					}
+					// Place the collider without interpolating from its old transform
+					const btTransform transform(btQuaternion(orientation.x, orientation.y, orientation.z, orientation.w), btVector3(position.x, position.y, position.z));
+					if (!colliderComponent->m_motionState)
+						colliderComponent->m_motionState = std::make_shared<Interpolated_MotionState>(transform);
+					else
+						colliderComponent->m_motionState->reset(transform);
 
-					// Build the collider from the transform info
-					colliderComponent->m_motionState->setWorldTransform(btTransform(btTransform(btQuaternion(orientation.x, orientation.y, orientation.z, orientation.w), btVector3(position.x, position.y, position.z))));
+					// Only rebuild the body if its shape or mass changed
+					const btVector3 localScale(scale.x, scale.y, scale.z);
+					const auto inverseMass = colliderComponent->m_mass != static_cast<btScalar>(0) ? static_cast<btScalar>(1) / colliderComponent->m_mass : static_cast<btScalar>(0);
+					auto& rigidBody = colliderComponent->m_rigidBody;
+					if (!rigidBody || !colliderComponent->m_shape || colliderComponent->m_shape->getLocalScaling() != localScale || rigidBody->getInvMass() != inverseMass) {
+						// Remove from the physics simulation
+						if (rigidBody) {
+							m_world.removeRigidBody(rigidBody.get());
+							rigidBody.reset();
+						}
 
-					// Resize the collider shape to fit
-					if (colliderComponent->m_worldTransform.m_scale != transformComponent->m_worldTransform.m_scale || !colliderComponent->m_shape) {
-						colliderComponent->m_shape = std::make_shared<btConvexHullShape>(*dynamic_cast<btConvexHullShape*>(colliderComponent->m_collider->m_shape.get()));
-						colliderComponent->m_shape->setLocalScaling(btVector3(scale.x, scale.y, scale.z));
-					}
+						// Share the collider shape with every collider of the same asset and size
+						colliderComponent->m_shape = shareShape(*colliderComponent->m_collider, localScale);
 
-					// Add back to simulation
-					btVector3 Inertia(0, 0, 0);
-					colliderComponent->m_shape->calculateLocalInertia(colliderComponent->m_mass, Inertia);
-					auto bodyCI = btRigidBody::btRigidBodyConstructionInfo(colliderComponent->m_mass, colliderComponent->m_motionState.get(), colliderComponent->m_shape.get(), Inertia);
-					bodyCI.m_restitution = colliderComponent->m_restitution;
-					bodyCI.m_friction = colliderComponent->m_friction;
-					colliderComponent->m_rigidBody = std::make_shared<btRigidBody>(bodyCI);
-					m_world.addRigidBody(colliderComponent->m_rigidBody.get());
+						// Add back to simulation
+						btVector3 Inertia(0, 0, 0);
+						colliderComponent->m_shape->calculateLocalInertia(colliderComponent->m_mass, Inertia);
+						auto bodyCI = btRigidBody::btRigidBodyConstructionInfo(colliderComponent->m_mass, colliderComponent->m_motionState.get(), colliderComponent->m_shape.get(), Inertia);
+						bodyCI.m_restitution = colliderComponent->m_restitution;
+						bodyCI.m_friction = colliderComponent->m_friction;
+						rigidBody = std::make_shared<btRigidBody>(bodyCI);
+						m_world.addRigidBody(rigidBody.get());
+					}
+					// Otherwise move the body in place, keeping its broadphase proxy and contact cache
+					else {
+						rigidBody->setRestitution(colliderComponent->m_restitution);
+						rigidBody->setFriction(colliderComponent->m_friction);
+						Body_Placement::Move(m_world, *rigidBody, transform);
+					}
 
 					// Update the transform
 					colliderComponent->m_worldTransform = transformComponent->m_worldTransform;
 				}
 				// Otherwise update the transform with the collider info
-				else {
-					btTransform trans;
-					colliderComponent->m_motionState->getWorldTransform(trans);
+				else if (colliderComponent->m_rigidBody) {
+					// Resting bodies aren't stepped, so their last step is already where they lie
+					const auto trans = colliderComponent->m_motionState->getInterpolatedTransform(
+						colliderComponent->m_rigidBody->isActive() ? interpolation : static_cast<btScalar>(1)
+					);
 					const auto quat = trans.getRotation();
 					const auto pos = trans.getOrigin();
 					transformComponent->m_localTransform.m_position = glm::vec3(pos.x(), pos.y(), pos.z());
@@ -70,4 +89,24 @@ void PhysicsSync_System::updateComponents(const float& /*deltaTime*/, const std:
 			}
 		}
 	}
+}
+
+std::shared_ptr<btCollisionShape> PhysicsSync_System::shareShape(const Collider& collider, const btVector3& localScale)
+{
+	const auto key = std::make_tuple(collider.getFileName(), static_cast<float>(localScale.x()), static_cast<float>(localScale.y()), static_cast<float>(localScale.z()));
+	if (const auto existing = m_shapes.find(key); existing != m_shapes.end())
+		if (auto shape = existing->second.lock())
+			return shape;
+
+	// Forget shapes no collider uses anymore before making another
+	for (auto shape = m_shapes.begin(); shape != m_shapes.end();) {
+		if (shape->second.expired())
+			shape = m_shapes.erase(shape);
+		else
+			++shape;
+	}
+	auto shape = std::make_shared<btConvexHullShape>(*dynamic_cast<btConvexHullShape*>(collider.m_shape.get()));
+	shape->setLocalScaling(localScale);
+	m_shapes[key] = shape;
+	return shape;
 }
\ No newline at end of file
@@ -4,11 +4,18 @@
 #define GLM_ENABLE_EXPERIMENTAL
 
 #include "Modules/ECS/ecsSystem.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
 
 
 // Forward Declarations
 class Engine;
+class Collider;
+class btCollisionShape;
 class btDiscreteDynamicsWorld;
+class btVector3;
 
 /** A system responsible for updating physics components that share a common transformation. */
 class PhysicsSync_System final : public ecsBaseSystem {
@@ -21,13 +28,25 @@ public:
 
 
 	// Public Interface Implementation
+	inline const char* getName() const noexcept final { return "PhysicsSync_System"; }
 	void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final;
 
 
 private:
+	// Private Methods
+	/** Retrieve a collision shape for a collider asset at a given scale, shared with every other collider using it.
+	@param	collider	the collider asset to copy the shape of.
+	@param	localScale	the scale to apply to the shape.
+	@return				the shared collision shape. */
+	std::shared_ptr<btCollisionShape> shareShape(const Collider& collider, const btVector3& localScale);
+
+
 	// Private Attributes
 	Engine& m_engine;
 	btDiscreteDynamicsWorld& m_world;
+	/** Collision shapes in use, keyed by their collider asset's filename and scale.
+	Keyed by filename rather than address, as a released asset's address may be reused by another. */
+	std::map<std::tuple<std::string, float, float, float>, std::weak_ptr<btCollisionShape>> m_shapes;
 };
 
 #endif // PHYSICSSYNC_SYSTEM_H
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include "Modules/Physics/Interpolated_MotionState.h"
+
+
+Interpolated_MotionState::Interpolated_MotionState(const btTransform& transform) noexcept :
+	m_previous(transform),
+	m_current(transform)
+{
+}
+
+void Interpolated_MotionState::getWorldTransform(btTransform& worldTrans) const
+{
+	worldTrans = m_current;
+}
+
+void Interpolated_MotionState::setWorldTransform(const btTransform& worldTrans)
+{
+	// Called by the physics world once per simulation step
+	m_previous = m_current;
+	m_current = worldTrans;
+}
+
+void Interpolated_MotionState::reset(const btTransform& transform) noexcept
+{
+	m_previous = transform;
+	m_current = transform;
+}
+
+btTransform Interpolated_MotionState::getInterpolatedTransform(const btScalar& alpha) const
+{
+	return btTransform(
+		m_previous.getRotation().slerp(m_current.getRotation(), alpha),
+		m_previous.getOrigin().lerp(m_current.getOrigin(), alpha)
+	);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+#ifndef INTERPOLATED_MOTIONSTATE_H
+#define INTERPOLATED_MOTIONSTATE_H
+
+#include "LinearMath/btMotionState.h"
+
+
+/** A motion state remembering a rigid body's transform from before and after its latest simulation step, so it can be rendered in between. */
+ATTRIBUTE_ALIGNED16(class) Interpolated_MotionState final : public btMotionState {
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR();
+
+
+	// Public (De)Constructors
+	/** Construct a motion state resting at a given transform.
+	@param	transform	the transform to start at. */
+	explicit Interpolated_MotionState(const btTransform& transform = btTransform::getIdentity()) noexcept;
+
+
+	// Public Interface Implementations
+	void getWorldTransform(btTransform& worldTrans) const final;
+	void setWorldTransform(const btTransform& worldTrans) final;
+
+
+	// Public Methods
+	/** Move this motion state to a transform without interpolating towards it.
+	@param	transform	the transform to move to. */
+	void reset(const btTransform& transform) noexcept;
+	/** Retrieve a transform between the ones before and after the latest simulation step.
+	@param	alpha		how far between the 2 transforms to go, from 0 to 1.
+	@return				the interpolated transform. */
+	btTransform getInterpolatedTransform(const btScalar& alpha) const;
+
+
+private:
+	// Private Attributes
+	btTransform m_previous, m_current;
+};
+
+#endif // INTERPOLATED_MOTIONSTATE_H
\ No newline at end of file
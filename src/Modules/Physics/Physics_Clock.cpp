@@ -0,0 +1,42 @@
+#include "Modules/Physics/Physics_Clock.h"
+#include "btBulletDynamicsCommon.h"
+#include <algorithm>
+#include <cmath>
+
+
+int Physics_Clock::advance(btDynamicsWorld& world, const float& deltaTime)
+{
+	// Advance in whole steps of a fixed size, so the simulation doesn't depend on the frame rate
+	m_accumulator += deltaTime;
+	int steps = 0;
+	while (m_accumulator >= m_stepSize && steps < m_maxSteps) {
+		world.stepSimulation(m_stepSize, 0);
+		m_accumulator -= m_stepSize;
+		++steps;
+	}
+
+	// Drop any time past the step budget, so a long frame slows the simulation down rather than stalling the next frames
+	if (m_accumulator >= m_stepSize)
+		m_accumulator = std::fmod(m_accumulator, m_stepSize);
+	return steps;
+}
+
+btScalar Physics_Clock::getInterpolation() const noexcept
+{
+	return static_cast<btScalar>(m_accumulator / m_stepSize);
+}
+
+void Physics_Clock::setStepRate(const float& stepRate) noexcept
+{
+	m_stepSize = 1.0F / std::max(1.0F, stepRate);
+}
+
+void Physics_Clock::setMaxSteps(const int& maxSteps) noexcept
+{
+	m_maxSteps = std::max(1, maxSteps);
+}
+
+float Physics_Clock::getStepSize() const noexcept
+{
+	return m_stepSize;
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#ifndef PHYSICS_CLOCK_H
+#define PHYSICS_CLOCK_H
+
+#include "LinearMath/btScalar.h"
+
+
+// Forward Declarations
+class btDynamicsWorld;
+
+/** Advances a physics world in whole steps of a fixed size, carrying frame time that doesn't fill a step over to the next frame.
+Stepping this way keeps the simulation independent of the frame rate, so the same world ends up in the same state for any split of the same time into frames. */
+class Physics_Clock {
+public:
+	// Public Methods
+	/** Advance a physics world by a frame's worth of time.
+	@note				time past the step budget is dropped, so a long frame slows the simulation down rather than stalling the next frames.
+	@param	world		the physics world to step.
+	@param	deltaTime	the amount of time since last frame.
+	@return				the number of steps taken. */
+	int advance(btDynamicsWorld& world, const float& deltaTime);
+	/** Retrieve how far the simulation is between its latest step and the next one.
+	@return				the fraction of a step left over in the accumulator, from 0 to 1. */
+	btScalar getInterpolation() const noexcept;
+	/** Set how many steps to take per simulated second.
+	@param	stepRate	the new step rate, at least 1. */
+	void setStepRate(const float& stepRate) noexcept;
+	/** Set the most simulation steps to take in a single frame.
+	@param	maxSteps	the new step budget, at least 1. */
+	void setMaxSteps(const int& maxSteps) noexcept;
+	/** Retrieve the duration of a single simulation step.
+	@return				the step size in seconds. */
+	float getStepSize() const noexcept;
+
+
+private:
+	// Private Attributes
+	/** Duration of a single simulation step, in seconds. */
+	float m_stepSize = 1.0F / 60.0F;
+	/** Frame time not yet simulated, in seconds. */
+	float m_accumulator = 0.0F;
+	/** Most simulation steps to take in a single frame. */
+	int m_maxSteps = 4;
+};
+
+#endif // PHYSICS_CLOCK_H
\ No newline at end of file
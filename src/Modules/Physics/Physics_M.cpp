@@ -1,5 +1,6 @@
 #include "Modules/Physics/Physics_M.h"
 #include "Modules/Physics/ECS/PhysicsSync_System.h"
+#include "Utilities/Profiler.h"
 #include "Engine.h"
 
 
@@ -16,6 +17,21 @@ void Physics_Module::initialize()
 	m_engine.getManager_Messages().statement("Loading Module: Physics...");
 	m_world.setGravity(btVector3(0, static_cast<btScalar>(-9.8), 0));
 
+	// Preferences
+	auto& preferences = m_engine.getPreferenceState();
+	float stepRate = 60.0F;
+	preferences.getOrSetValue(PreferenceState::Preference::C_PHYSICS_STEP_RATE, stepRate);
+	preferences.addCallback(PreferenceState::Preference::C_PHYSICS_STEP_RATE, m_aliveIndicator, [&](const float& f) {
+		m_clock.setStepRate(f);
+		});
+	m_clock.setStepRate(stepRate);
+	float maxSteps = 4.0F;
+	preferences.getOrSetValue(PreferenceState::Preference::C_PHYSICS_MAX_STEPS, maxSteps);
+	preferences.addCallback(PreferenceState::Preference::C_PHYSICS_MAX_STEPS, m_aliveIndicator, [&](const float& f) {
+		m_clock.setMaxSteps(static_cast<int>(f));
+		});
+	m_clock.setMaxSteps(static_cast<int>(maxSteps));
+
 	// Physics Systems
 	m_physicsSystems.makeSystem<PhysicsSync_System>(m_engine, m_world);
 }
@@ -29,7 +45,8 @@ void Physics_Module::deinitialize()
 
 void Physics_Module::frameTick(ecsWorld& world, const float& deltaTime)
 {
-	m_world.stepSimulation(deltaTime);
+	PROFILE_ZONE("Module", "Physics_Module::frameTick");
+	m_clock.advance(m_world, deltaTime);
 	updateSystems(world, deltaTime);
 }
 
@@ -41,4 +58,9 @@ void Physics_Module::updateSystems(ecsWorld& world, const float& deltaTime)
 btDiscreteDynamicsWorld& Physics_Module::getWorld() noexcept
 {
 	return m_world;
+}
+
+btScalar Physics_Module::getInterpolation() const noexcept
+{
+	return m_clock.getInterpolation();
 }
\ No newline at end of file
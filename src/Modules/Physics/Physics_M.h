@@ -4,6 +4,7 @@
 
 #include "Modules/Engine_Module.h"
 #include "Modules/ECS/ecsSystem.h"
+#include "Modules/Physics/Physics_Clock.h"
 #include "btBulletCollisionCommon.h"
 #include "btBulletDynamicsCommon.h"
 
@@ -34,6 +35,9 @@ public:
 	/** Retrieves a pointer to the physics-world.
 	@return				reference to the physics world. */
 	btDiscreteDynamicsWorld& getWorld() noexcept;
+	/** Retrieve how far the simulation is between its latest step and the next one.
+	@return				the fraction of a step left over in the accumulator, from 0 to 1. */
+	btScalar getInterpolation() const noexcept;
 
 
 private:
@@ -44,6 +48,7 @@ private:
 	btSequentialImpulseConstraintSolver m_solver;
 	btDiscreteDynamicsWorld m_world;
 	ecsSystemList m_physicsSystems;
+	Physics_Clock m_clock;
 	std::shared_ptr<bool> m_aliveIndicator = std::make_shared<bool>(true);
 };
 
@@ -1,5 +1,6 @@
 #include "Modules/StartScreen/StartScreen_M.h"
 #include "Modules/UI/Macro Elements/StartMenu.h"
+#include "Utilities/Profiler.h"
 #include "Engine.h"
 
 
@@ -27,6 +28,7 @@ void StartScreen_Module::deinitialize()
 
 void StartScreen_Module::frameTick(const float& deltaTime)
 {
+	PROFILE_ZONE("Module", "StartScreen_Module::frameTick");
 	m_engine.getModule_Physics().frameTick(m_world, deltaTime);
 	m_engine.getModule_Graphics().renderWorld(m_world, deltaTime);
 }
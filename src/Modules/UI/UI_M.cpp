@@ -1,4 +1,5 @@
 #include "Modules/UI/UI_M.h"
+#include "Utilities/Profiler.h"
 #include "Engine.h"
 
 
@@ -50,6 +51,7 @@ void UI_Module::deinitialize()
 
 void UI_Module::frameTick(const float& deltaTime)
 {
+	PROFILE_ZONE("Module", "UI_Module::frameTick");
 	glViewport(0, 0, static_cast<GLsizei>(m_renderSize.x), static_cast<GLsizei>(m_renderSize.y));
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
@@ -0,0 +1,238 @@
+#include "Utilities/BVH.h"
+#include <algorithm>
+
+
+/** Fraction of a box's size to pad its leaf by, so that small movements stay within the leaf. */
+constexpr float BVH_LEAF_MARGIN = 0.1F;
+
+/** Retrieve half the surface area of a box, used as the cost of testing against it.
+@param	min			the minimum corner of the box.
+@param	max			the maximum corner of the box.
+@return				the box's half surface area. */
+static float surface_area(const glm::vec3& min, const glm::vec3& max) noexcept
+{
+	const auto size = max - min;
+	return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+int BVH::insert(const glm::vec3& min, const glm::vec3& max, const size_t& userData)
+{
+	const auto leaf = allocateNode();
+	auto& node = m_nodes[static_cast<size_t>(leaf)];
+	const auto margin = (max - min) * BVH_LEAF_MARGIN;
+	node.min = min - margin;
+	node.max = max + margin;
+	node.userData = userData;
+	insertLeaf(leaf);
+	++m_leafCount;
+	return leaf;
+}
+
+void BVH::remove(const int& leaf)
+{
+	removeLeaf(leaf);
+	freeNode(leaf);
+	--m_leafCount;
+}
+
+bool BVH::update(const int& leaf, const glm::vec3& min, const glm::vec3& max)
+{
+	// Nothing to do while the box stays within its fattened bounds
+	auto& node = m_nodes[static_cast<size_t>(leaf)];
+	if (glm::all(glm::lessThanEqual(node.min, min)) && glm::all(glm::greaterThanEqual(node.max, max)))
+		return false;
+
+	removeLeaf(leaf);
+	const auto margin = (max - min) * BVH_LEAF_MARGIN;
+	node.min = min - margin;
+	node.max = max + margin;
+	insertLeaf(leaf);
+	return true;
+}
+
+void BVH::setUserData(const int& leaf, const size_t& userData) noexcept
+{
+	m_nodes[static_cast<size_t>(leaf)].userData = userData;
+}
+
+void BVH::clear() noexcept
+{
+	m_nodes.clear();
+	m_freeNodes.clear();
+	m_root = -1;
+	m_leafCount = 0ULL;
+}
+
+size_t BVH::size() const noexcept
+{
+	return m_leafCount;
+}
+
+int BVH::getHeight() const noexcept
+{
+	return m_root < 0 ? 0 : m_nodes[static_cast<size_t>(m_root)].height;
+}
+
+int BVH::allocateNode()
+{
+	if (!m_freeNodes.empty()) {
+		const auto nodeIndex = m_freeNodes.back();
+		m_freeNodes.pop_back();
+		return nodeIndex;
+	}
+	m_nodes.emplace_back();
+	return static_cast<int>(m_nodes.size() - 1ULL);
+}
+
+void BVH::freeNode(const int& nodeIndex)
+{
+	m_nodes[static_cast<size_t>(nodeIndex)] = Node();
+	m_freeNodes.push_back(nodeIndex);
+}
+
+void BVH::insertLeaf(const int& leaf)
+{
+	if (m_root < 0) {
+		m_root = leaf;
+		m_nodes[static_cast<size_t>(leaf)].parent = -1;
+		return;
+	}
+
+	// Descend towards the sibling whose union with the leaf adds the least surface area to the tree
+	const auto leafMin = m_nodes[static_cast<size_t>(leaf)].min;
+	const auto leafMax = m_nodes[static_cast<size_t>(leaf)].max;
+	auto sibling = m_root;
+	while (m_nodes[static_cast<size_t>(sibling)].left >= 0) {
+		const auto& node = m_nodes[static_cast<size_t>(sibling)];
+		const auto combinedArea = surface_area(glm::min(node.min, leafMin), glm::max(node.max, leafMax));
+		// Cost of pairing the leaf with this node, and the cost every ancestor of a child pays for growing
+		const auto cost = 2.0F * combinedArea;
+		const auto inheritedCost = 2.0F * (combinedArea - surface_area(node.min, node.max));
+		const auto childCost = [&](const int& childIndex) noexcept {
+			const auto& child = m_nodes[static_cast<size_t>(childIndex)];
+			const auto area = surface_area(glm::min(child.min, leafMin), glm::max(child.max, leafMax));
+			return child.left < 0
+				? area + inheritedCost
+				: area - surface_area(child.min, child.max) + inheritedCost;
+		};
+		const auto leftCost = childCost(node.left);
+		const auto rightCost = childCost(node.right);
+		if (cost < leftCost && cost < rightCost)
+			break;
+		sibling = leftCost < rightCost ? node.left : node.right;
+	}
+
+	// Replace the sibling with a new branch holding both it and the leaf
+	const auto oldParent = m_nodes[static_cast<size_t>(sibling)].parent;
+	const auto newParent = allocateNode();
+	auto& branch = m_nodes[static_cast<size_t>(newParent)];
+	auto& siblingNode = m_nodes[static_cast<size_t>(sibling)];
+	branch.parent = oldParent;
+	branch.left = sibling;
+	branch.right = leaf;
+	branch.min = glm::min(siblingNode.min, leafMin);
+	branch.max = glm::max(siblingNode.max, leafMax);
+	branch.height = siblingNode.height + 1;
+	siblingNode.parent = newParent;
+	m_nodes[static_cast<size_t>(leaf)].parent = newParent;
+	if (oldParent < 0)
+		m_root = newParent;
+	else if (m_nodes[static_cast<size_t>(oldParent)].left == sibling)
+		m_nodes[static_cast<size_t>(oldParent)].left = newParent;
+	else
+		m_nodes[static_cast<size_t>(oldParent)].right = newParent;
+
+	refit(oldParent);
+}
+
+void BVH::removeLeaf(const int& leaf)
+{
+	if (leaf == m_root) {
+		m_root = -1;
+		return;
+	}
+
+	// Replace the leaf's parent with the leaf's sibling
+	const auto parent = m_nodes[static_cast<size_t>(leaf)].parent;
+	const auto grandParent = m_nodes[static_cast<size_t>(parent)].parent;
+	const auto sibling = m_nodes[static_cast<size_t>(parent)].left == leaf
+		? m_nodes[static_cast<size_t>(parent)].right
+		: m_nodes[static_cast<size_t>(parent)].left;
+	m_nodes[static_cast<size_t>(sibling)].parent = grandParent;
+	m_nodes[static_cast<size_t>(leaf)].parent = -1;
+	freeNode(parent);
+	if (grandParent < 0) {
+		m_root = sibling;
+		return;
+	}
+	if (m_nodes[static_cast<size_t>(grandParent)].left == parent)
+		m_nodes[static_cast<size_t>(grandParent)].left = sibling;
+	else
+		m_nodes[static_cast<size_t>(grandParent)].right = sibling;
+	refit(grandParent);
+}
+
+int BVH::balance(const int& nodeIndex)
+{
+	auto& a = m_nodes[static_cast<size_t>(nodeIndex)];
+	if (a.left < 0 || a.height < 2)
+		return nodeIndex;
+
+	// Promote the taller child in place of this node, demoting this node to take the child's shorter grandchild
+	const auto rotate = [&](const int& childIndex, const bool& childIsRight) {
+		auto& child = m_nodes[static_cast<size_t>(childIndex)];
+		const auto otherIndex = childIsRight ? a.left : a.right;
+		const auto& other = m_nodes[static_cast<size_t>(otherIndex)];
+		const auto tallIndex = m_nodes[static_cast<size_t>(child.left)].height > m_nodes[static_cast<size_t>(child.right)].height ? child.left : child.right;
+		const auto shortIndex = tallIndex == child.left ? child.right : child.left;
+		auto& tall = m_nodes[static_cast<size_t>(tallIndex)];
+		auto& shortest = m_nodes[static_cast<size_t>(shortIndex)];
+
+		// Swap the child with this node in the tree
+		child.left = nodeIndex;
+		child.right = tallIndex;
+		child.parent = a.parent;
+		a.parent = childIndex;
+		if (child.parent < 0)
+			m_root = childIndex;
+		else if (m_nodes[static_cast<size_t>(child.parent)].left == nodeIndex)
+			m_nodes[static_cast<size_t>(child.parent)].left = childIndex;
+		else
+			m_nodes[static_cast<size_t>(child.parent)].right = childIndex;
+
+		// This node keeps its other child, and adopts the shorter grandchild
+		if (childIsRight)
+			a.right = shortIndex;
+		else
+			a.left = shortIndex;
+		shortest.parent = nodeIndex;
+		a.min = glm::min(other.min, shortest.min);
+		a.max = glm::max(other.max, shortest.max);
+		a.height = 1 + std::max(other.height, shortest.height);
+		child.min = glm::min(a.min, tall.min);
+		child.max = glm::max(a.max, tall.max);
+		child.height = 1 + std::max(a.height, tall.height);
+		return childIndex;
+	};
+	const auto leftIndex = a.left, rightIndex = a.right;
+	const auto balanceFactor = m_nodes[static_cast<size_t>(rightIndex)].height - m_nodes[static_cast<size_t>(leftIndex)].height;
+	if (balanceFactor > 1)
+		return rotate(rightIndex, true);
+	if (balanceFactor < -1)
+		return rotate(leftIndex, false);
+	return nodeIndex;
+}
+
+void BVH::refit(int nodeIndex)
+{
+	while (nodeIndex >= 0) {
+		nodeIndex = balance(nodeIndex);
+		auto& node = m_nodes[static_cast<size_t>(nodeIndex)];
+		const auto& left = m_nodes[static_cast<size_t>(node.left)];
+		const auto& right = m_nodes[static_cast<size_t>(node.right)];
+		node.height = 1 + std::max(left.height, right.height);
+		node.min = glm::min(left.min, right.min);
+		node.max = glm::max(left.max, right.max);
+		nodeIndex = node.parent;
+	}
+}
\ No newline at end of file
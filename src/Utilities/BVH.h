@@ -0,0 +1,111 @@
+#pragma once
+#ifndef BVH_H
+#define BVH_H
+
+#include "Utilities/Frustum.h"
+#include "glm/glm.hpp"
+#include <vector>
+
+
+/** A dynamic bounding volume hierarchy of axis-aligned boxes, kept balanced as boxes are inserted, moved and removed.
+Leaves are fattened by a margin, so small movements don't restructure the tree. */
+class BVH {
+public:
+	// Public Methods
+	/** Insert a box into the tree.
+	@param	min			the minimum corner of the box.
+	@param	max			the maximum corner of the box.
+	@param	userData	the value to return when this box is found by a query.
+	@return				the id of the leaf holding this box. */
+	int insert(const glm::vec3& min, const glm::vec3& max, const size_t& userData);
+	/** Remove a leaf from the tree.
+	@param	leaf		the id of the leaf to remove. */
+	void remove(const int& leaf);
+	/** Move a leaf's box, restructuring the tree only if it left its fattened bounds.
+	@param	leaf		the id of the leaf to move.
+	@param	min			the new minimum corner of the box.
+	@param	max			the new maximum corner of the box.
+	@return				true if the tree was restructured, false otherwise. */
+	bool update(const int& leaf, const glm::vec3& min, const glm::vec3& max);
+	/** Change the value a leaf returns when found by a query.
+	@param	leaf		the id of the leaf to change.
+	@param	userData	the value to return when this box is found by a query. */
+	void setUserData(const int& leaf, const size_t& userData) noexcept;
+	/** Remove every leaf from the tree. */
+	void clear() noexcept;
+	/** Retrieve the number of leaves in the tree.
+	@return				the leaf count. */
+	size_t size() const noexcept;
+	/** Retrieve the number of branches between the root and the deepest leaf.
+	@return				the tree's height, 0 if it holds at most 1 leaf. */
+	int getHeight() const noexcept;
+	/** Visit the user data of every leaf intersecting a frustum.
+	@param	frustum		the frustum to test against.
+	@param	visitor		the function to call with each visible leaf's user data. */
+	template <typename Visitor>
+	void query(const Frustum& frustum, Visitor&& visitor) const {
+		if (m_root < 0)
+			return;
+
+		// Subtrees wholly within the frustum are collected without further plane tests
+		std::vector<std::pair<int, bool>> stack;
+		stack.reserve(64ULL);
+		stack.emplace_back(m_root, false);
+		while (!stack.empty()) {
+			const auto [nodeIndex, inside] = stack.back();
+			stack.pop_back();
+			const auto& node = m_nodes[static_cast<size_t>(nodeIndex)];
+			auto childrenInside = inside;
+			if (!inside) {
+				const auto containment = frustum.test(node.min, node.max);
+				if (containment == Frustum::Containment::OUTSIDE)
+					continue;
+				childrenInside = containment == Frustum::Containment::INSIDE;
+			}
+			if (node.left < 0)
+				visitor(node.userData);
+			else {
+				stack.emplace_back(node.right, childrenInside);
+				stack.emplace_back(node.left, childrenInside);
+			}
+		}
+	}
+
+
+private:
+	// Private Methods
+	/** Retrieve an unused node, growing the node pool if needed.
+	@return				the id of the new node. */
+	int allocateNode();
+	/** Return a node to the pool.
+	@param	nodeIndex	the id of the node to free. */
+	void freeNode(const int& nodeIndex);
+	/** Attach a leaf to the tree, beside the sibling that grows the tree's surface area the least.
+	@param	leaf		the id of the leaf to attach. */
+	void insertLeaf(const int& leaf);
+	/** Detach a leaf from the tree, freeing its parent.
+	@param	leaf		the id of the leaf to detach. */
+	void removeLeaf(const int& leaf);
+	/** Rotate a node's children if they are unbalanced.
+	@param	nodeIndex	the id of the node to balance.
+	@return				the id of the node now at this position in the tree. */
+	int balance(const int& nodeIndex);
+	/** Refit the bounds and heights of a node and all its ancestors.
+	@param	nodeIndex	the id of the first node to refit. */
+	void refit(int nodeIndex);
+
+
+	// Private Attributes
+	/** A single node in the tree, either a leaf holding user data or a branch holding 2 children. */
+	struct Node {
+		glm::vec3 min = glm::vec3(0.0F), max = glm::vec3(0.0F);
+		int parent = -1, left = -1, right = -1, height = 0;
+		size_t userData = 0ULL;
+	};
+	std::vector<Node> m_nodes;
+	std::vector<int> m_freeNodes;
+	int m_root = -1;
+	size_t m_leafCount = 0ULL;
+};
+
+#endif // BVH_H
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "Utilities/Binary_Delta.h"
+#include <algorithm>
+
+
+Binary_Delta Binary_Delta::Diff(const std::vector<char>& before, const std::vector<char>& after)
+{
+	const auto size = std::max(before.size(), after.size());
+	auto paddedBefore = before, paddedAfter = after;
+	paddedBefore.resize(size, 0);
+	paddedAfter.resize(size, 0);
+	return From_Bytes(paddedBefore, paddedAfter, std::vector<bool>(size, true), before.size(), after.size());
+}
+
+void Binary_Delta::apply(std::vector<char>& data) const
+{
+	write(data, true, m_sizeAfter);
+}
+
+void Binary_Delta::revert(std::vector<char>& data) const
+{
+	write(data, false, m_sizeBefore);
+}
+
+void Binary_Delta::merge(const Binary_Delta& newerDelta)
+{
+	// Only bytes either delta changed are known, their oldest value comes from this delta and their newest from the newer one
+	const auto size = std::max({ m_sizeBefore, m_sizeAfter, newerDelta.m_sizeAfter });
+	std::vector<char> before(size, 0), after(size, 0);
+	std::vector<bool> known(size, false);
+	forEachRun([&](const size_t& offset, const size_t& length, const char* oldBytes, const char* newBytes) {
+		for (size_t x = 0ULL; x < length; ++x) {
+			before[offset + x] = oldBytes[x];
+			after[offset + x] = newBytes[x];
+			known[offset + x] = true;
+		}
+		});
+	newerDelta.forEachRun([&](const size_t& offset, const size_t& length, const char* oldBytes, const char* newBytes) {
+		for (size_t x = 0ULL; x < length; ++x) {
+			if (!known[offset + x])
+				before[offset + x] = oldBytes[x];
+			after[offset + x] = newBytes[x];
+			known[offset + x] = true;
+		}
+		});
+
+	// Padding past both end sizes only ever holds zeros
+	const auto mergedSize = std::max(m_sizeBefore, newerDelta.m_sizeAfter);
+	before.resize(mergedSize);
+	after.resize(mergedSize);
+	known.resize(mergedSize);
+	*this = From_Bytes(before, after, known, m_sizeBefore, newerDelta.m_sizeAfter);
+}
+
+bool Binary_Delta::empty() const noexcept
+{
+	return m_data.empty() && m_sizeBefore == m_sizeAfter;
+}
+
+size_t Binary_Delta::getMemoryUsage() const noexcept
+{
+	return sizeof(*this) + m_data.capacity();
+}
+
+Binary_Delta Binary_Delta::From_Bytes(const std::vector<char>& before, const std::vector<char>& after, const std::vector<bool>& known, const size_t& sizeBefore, const size_t& sizeAfter)
+{
+	Binary_Delta delta;
+	delta.m_sizeBefore = sizeBefore;
+	delta.m_sizeAfter = sizeAfter;
+	const auto size = before.size();
+	for (size_t index = 0ULL; index < size;) {
+		if (!known[index] || before[index] == after[index]) {
+			++index;
+			continue;
+		}
+
+		// Extend the run over short gaps, as storing them costs less than starting a new run
+		const auto first = index;
+		auto last = index;
+		while (index < size && known[index] && (index - last) * 2ULL <= sizeof(Run)) {
+			if (before[index] != after[index])
+				last = index;
+			++index;
+		}
+		index = last + 1ULL;
+		const Run run{ static_cast<std::uint32_t>(first), static_cast<std::uint32_t>(index - first) };
+		const auto header = delta.m_data.size();
+		delta.m_data.resize(header + sizeof(Run));
+		std::memcpy(&delta.m_data[header], &run, sizeof(Run));
+		delta.m_data.insert(delta.m_data.end(), before.cbegin() + static_cast<std::ptrdiff_t>(first), before.cbegin() + static_cast<std::ptrdiff_t>(index));
+		delta.m_data.insert(delta.m_data.end(), after.cbegin() + static_cast<std::ptrdiff_t>(first), after.cbegin() + static_cast<std::ptrdiff_t>(index));
+	}
+	delta.m_data.shrink_to_fit();
+	return delta;
+}
+
+void Binary_Delta::write(std::vector<char>& data, const bool& newer, const size_t& targetSize) const
+{
+	data.resize(std::max(m_sizeBefore, m_sizeAfter), 0);
+	forEachRun([&](const size_t& offset, const size_t& length, const char* oldBytes, const char* newBytes) {
+		std::memcpy(&data[offset], newer ? newBytes : oldBytes, length);
+		});
+	data.resize(targetSize);
+}
\ No newline at end of file
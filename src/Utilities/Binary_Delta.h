@@ -0,0 +1,83 @@
+#pragma once
+#ifndef BINARY_DELTA_H
+#define BINARY_DELTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+/** The difference between two versions of a char buffer, holding only the bytes that changed.
+Changed bytes keep both their old and new values, so a buffer can be switched to either version regardless of its other bytes.
+Buffers of different sizes are compared as if the shorter one were padded with zeros. */
+class Binary_Delta {
+public:
+	// Public Methods
+	/** Record the bytes that differ between two versions of a buffer.
+	@param	before			the older version of the buffer.
+	@param	after			the newer version of the buffer.
+	@return					a delta switching between both versions. */
+	static Binary_Delta Diff(const std::vector<char>& before, const std::vector<char>& after);
+	/** Switch a buffer from the older version to the newer one.
+	@param	data			reference to a buffer of the older version's size, updated with the newer version. */
+	void apply(std::vector<char>& data) const;
+	/** Switch a buffer from the newer version back to the older one.
+	@param	data			reference to a buffer of the newer version's size, updated with the older version. */
+	void revert(std::vector<char>& data) const;
+	/** Fold into this delta a newer one that starts from the version this one ends at.
+	Bytes changed back to how they were before this delta are dropped.
+	@param	newerDelta		the newer of the two deltas. */
+	void merge(const Binary_Delta& newerDelta);
+	/** Retrieve whether both versions of the buffer are identical.
+	@return					true if this delta changes nothing, false otherwise. */
+	bool empty() const noexcept;
+	/** Retrieve roughly how much memory this delta holds onto.
+	@return					the delta's size in bytes. */
+	size_t getMemoryUsage() const noexcept;
+
+
+private:
+	// Private Methods
+	/** Split both versions of a buffer into runs of changed bytes.
+	Unchanged gaps shorter than a run are kept inside the surrounding run, as long as their bytes are known.
+	@param	before			the older version, padded to the longest version's size.
+	@param	after			the newer version, padded to the longest version's size.
+	@param	known			whether each byte's value is known, bytes that aren't are never stored.
+	@param	sizeBefore		the byte-size of the older version.
+	@param	sizeAfter		the byte-size of the newer version.
+	@return					a delta holding only the changed runs. */
+	static Binary_Delta From_Bytes(const std::vector<char>& before, const std::vector<char>& after, const std::vector<bool>& known, const size_t& sizeBefore, const size_t& sizeAfter);
+	/** Write one version of the changed runs into a buffer.
+	@param	data			reference to the buffer to write into.
+	@param	newer			true to write the newer version, false to write the older.
+	@param	targetSize		the byte-size of the version written. */
+	void write(std::vector<char>& data, const bool& newer, const size_t& targetSize) const;
+	/** Visit every changed run in order.
+	@param	visitor			function taking a run's offset, length, old bytes, and new bytes. */
+	template <typename Visitor>
+	inline void forEachRun(const Visitor& visitor) const {
+		for (size_t index = 0ULL; index < m_data.size();) {
+			Run run;
+			std::memcpy(&run, &m_data[index], sizeof(Run));
+			index += sizeof(Run);
+			visitor(static_cast<size_t>(run.m_offset), static_cast<size_t>(run.m_length), &m_data[index], &m_data[index + run.m_length]);
+			index += 2ULL * run.m_length;
+		}
+	}
+
+
+	// Private Structures
+	/** Header of a contiguous range of changed bytes. */
+	struct Run {
+		std::uint32_t m_offset = 0U, m_length = 0U;
+	};
+
+
+	// Private Attributes
+	/** Each changed run's header, followed by its old bytes, then its new bytes. */
+	std::vector<char> m_data;
+	size_t m_sizeBefore = 0ULL, m_sizeAfter = 0ULL;
+};
+
+#endif // BINARY_DELTA_H
\ No newline at end of file
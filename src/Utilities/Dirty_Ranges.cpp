@@ -0,0 +1,58 @@
+#include "Utilities/Dirty_Ranges.h"
+#include <algorithm>
+
+
+Dirty_Ranges::Dirty_Ranges(const size_t& bufferCount) :
+	m_written(std::max<size_t>(1ULL, bufferCount), 0ULL)
+{
+}
+
+void Dirty_Ranges::resize(const size_t& count)
+{
+	m_changed.resize(count, m_stamp);
+}
+
+void Dirty_Ranges::markDirty(const size_t& index) noexcept
+{
+	m_changed[index] = m_stamp;
+}
+
+void Dirty_Ranges::markDirty(const size_t& first, const size_t& count) noexcept
+{
+	std::fill_n(m_changed.begin() + static_cast<std::ptrdiff_t>(first), count, m_stamp);
+}
+
+void Dirty_Ranges::markAllDirty() noexcept
+{
+	std::fill(m_changed.begin(), m_changed.end(), m_stamp);
+}
+
+size_t Dirty_Ranges::collect(const size_t& bufferIndex, std::vector<std::pair<size_t, size_t>>& ranges)
+{
+	ranges.clear();
+	size_t total(0ULL);
+	auto& written = m_written[bufferIndex % m_written.size()];
+	const auto count = m_changed.size();
+	for (size_t index = 0ULL; index < count;) {
+		if (m_changed[index] <= written) {
+			++index;
+			continue;
+		}
+
+		// Coalesce neighbouring changes into one range
+		const auto first = index;
+		while (index < count && m_changed[index] > written)
+			++index;
+		ranges.emplace_back(first, index - first);
+		total += index - first;
+	}
+
+	// Changes made from now on are newer than this buffer
+	written = m_stamp++;
+	return total;
+}
+
+size_t Dirty_Ranges::size() const noexcept
+{
+	return m_changed.size();
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef DIRTY_RANGES_H
+#define DIRTY_RANGES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+/** Tracks which elements of a multi-buffered array changed, so each buffer only receives the elements it is missing.
+Every element remembers when it last changed, and every buffer when it was last brought up to date, so an element changed once is written once into each buffer. */
+class Dirty_Ranges {
+public:
+	// Public (De)Constructors
+	/** Construct a tracker.
+	@param	bufferCount		the number of buffers the array cycles through. */
+	explicit Dirty_Ranges(const size_t& bufferCount = 3ULL);
+
+
+	// Public Methods
+	/** Change the number of tracked elements, marking any new elements dirty.
+	@param	count			the new element count. */
+	void resize(const size_t& count);
+	/** Mark an element as changed.
+	@param	index			the element index. */
+	void markDirty(const size_t& index) noexcept;
+	/** Mark a range of elements as changed.
+	@param	first			the first element index.
+	@param	count			the number of elements. */
+	void markDirty(const size_t& first, const size_t& count) noexcept;
+	/** Mark every element as changed. */
+	void markAllDirty() noexcept;
+	/** Collect the elements a buffer is missing as contiguous ranges, then consider that buffer up to date.
+	@param	bufferIndex		the buffer about to be written.
+	@param	ranges			reference updated with the (first, count) ranges to write.
+	@return					the total number of elements to write. */
+	size_t collect(const size_t& bufferIndex, std::vector<std::pair<size_t, size_t>>& ranges);
+	/** Retrieve the number of tracked elements.
+	@return					the element count. */
+	size_t size() const noexcept;
+
+
+private:
+	// Private Attributes
+	/** When each element last changed. */
+	std::vector<std::uint64_t> m_changed;
+	/** When each buffer was last brought up to date. */
+	std::vector<std::uint64_t> m_written;
+	std::uint64_t m_stamp = 1ULL;
+};
+
+#endif // DIRTY_RANGES_H
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "Utilities/Frustum.h"
+#include <cmath>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FRUSTUM_SSE2
+#endif
+
+
+Frustum::Frustum() noexcept
+{
+	// Planes that every point lies in front of
+	for (int x = 0; x < 8; ++x) {
+		m_x[x] = 0.0F;
+		m_y[x] = 0.0F;
+		m_z[x] = 0.0F;
+		m_w[x] = 1.0F;
+	}
+}
+
+Frustum::Frustum(const glm::mat4& pvMatrix) noexcept
+{
+	// Gribb-Hartmann: each plane is the 4th row of the matrix plus or minus one of the others
+	const auto row = [&pvMatrix](const int& r) noexcept {
+		return glm::vec4(pvMatrix[0][r], pvMatrix[1][r], pvMatrix[2][r], pvMatrix[3][r]);
+	};
+	const glm::vec4 planes[5] = {
+		row(3) + row(0),	// Left
+		row(3) - row(0),	// Right
+		row(3) + row(1),	// Bottom
+		row(3) - row(1),	// Top
+		row(3) - row(2)		// Far
+	};
+	for (int x = 0; x < 8; ++x) {
+		const auto& plane = planes[x < 5 ? x : 0];
+		m_x[x] = plane.x;
+		m_y[x] = plane.y;
+		m_z[x] = plane.z;
+		m_w[x] = plane.w;
+	}
+}
+
+Frustum::Containment Frustum::test(const glm::vec3& min, const glm::vec3& max) const noexcept
+{
+	// Compare the distance of the box's center to each plane, against the box's extent projected onto that plane
+	const auto center = (max + min) * 0.5F;
+	const auto extent = (max - min) * 0.5F;
+#if defined(FRUSTUM_SSE2)
+	const auto cx = _mm_set1_ps(center.x), cy = _mm_set1_ps(center.y), cz = _mm_set1_ps(center.z);
+	const auto ex = _mm_set1_ps(extent.x), ey = _mm_set1_ps(extent.y), ez = _mm_set1_ps(extent.z);
+	const auto signMask = _mm_set1_ps(-0.0F);
+	auto outside = _mm_setzero_ps(), intersects = _mm_setzero_ps();
+	for (int group = 0; group < 8; group += 4) {
+		const auto px = _mm_load_ps(m_x + group), py = _mm_load_ps(m_y + group), pz = _mm_load_ps(m_z + group), pw = _mm_load_ps(m_w + group);
+		const auto distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, cx), _mm_mul_ps(py, cy)), _mm_add_ps(_mm_mul_ps(pz, cz), pw));
+		const auto radius = _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(_mm_andnot_ps(signMask, px), ex),
+			_mm_mul_ps(_mm_andnot_ps(signMask, py), ey)),
+			_mm_mul_ps(_mm_andnot_ps(signMask, pz), ez));
+		outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+		intersects = _mm_or_ps(intersects, _mm_cmplt_ps(_mm_sub_ps(distance, radius), _mm_setzero_ps()));
+	}
+	if (_mm_movemask_ps(outside) != 0)
+		return Containment::OUTSIDE;
+	return _mm_movemask_ps(intersects) != 0 ? Containment::INTERSECTS : Containment::INSIDE;
+#else
+	auto result = Containment::INSIDE;
+	for (int x = 0; x < 8; ++x) {
+		const auto distance = m_x[x] * center.x + m_y[x] * center.y + m_z[x] * center.z + m_w[x];
+		const auto radius = std::abs(m_x[x]) * extent.x + std::abs(m_y[x]) * extent.y + std::abs(m_z[x]) * extent.z;
+		if (distance + radius < 0.0F)
+			return Containment::OUTSIDE;
+		if (distance - radius < 0.0F)
+			result = Containment::INTERSECTS;
+	}
+	return result;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include "glm/glm.hpp"
+
+
+/** A view frustum's bounding planes, stored for testing a box against several planes at once. */
+class Frustum {
+public:
+	// Public (De)Constructors
+	/** Construct a frustum that contains everything. */
+	Frustum() noexcept;
+	/** Construct a frustum from a combined projection-view matrix.
+	@note				the near plane is skipped, as depth clamping keeps geometry in front of it visible.
+	@param	pvMatrix	the projection-view matrix to extract the planes from. */
+	explicit Frustum(const glm::mat4& pvMatrix) noexcept;
+
+
+	// Public Enumerations
+	/** How much of a volume lies within the frustum. */
+	enum class Containment {
+		OUTSIDE,
+		INTERSECTS,
+		INSIDE
+	};
+
+
+	// Public Methods
+	/** Test an axis-aligned bounding box against this frustum.
+	@param	min			the minimum corner of the box.
+	@param	max			the maximum corner of the box.
+	@return				whether the box lies outside, across or inside the frustum. */
+	Containment test(const glm::vec3& min, const glm::vec3& max) const noexcept;
+
+
+private:
+	// Private Attributes
+	/** Plane components, split into 2 groups of 4 planes. Unused slots repeat an earlier plane. */
+	alignas(16) float m_x[8], m_y[8], m_z[8], m_w[8];
+};
+
+#endif // FRUSTUM_H
\ No newline at end of file
@@ -3,6 +3,7 @@
 #define DYNAMICBUFFER_H
 
 #include "Utilities/GL/Buffer_Interface.h"
+#include "Utilities/GL/GL_Fence.h"
 #include <utility>
 
 
@@ -11,11 +12,9 @@ template <int BufferCount = 3>
 class DynamicBuffer final : public Buffer_Interface {
 public:
 	// Public (De)Constructors
-	/** Wait for all fences to complete, then destroy this buffer. */
+	/** Destroy this buffer, the driver deferring deletion until the GPU is done with it. */
 	inline ~DynamicBuffer() {
 		for (int x = 0; x < BufferCount; ++x) {
-			WaitForFence(m_writeFence[x]);
-			WaitForFence(m_readFence[x]);
 			if (m_bufferID[x]) {
 				glUnmapNamedBuffer(m_bufferID[x]);
 				glDeleteBuffers(1, &m_bufferID[x]);
@@ -32,8 +31,7 @@ public:
 		for (int x = 0; x < BufferCount; ++x) {
 			m_bufferID[x] = 0;
 			m_bufferPtr[x] = nullptr;
-			m_writeFence[x] = nullptr;
-			m_readFence[x] = nullptr;
+			m_slotEpoch[x] = 0ULL;
 		}
 
 		glCreateBuffers(BufferCount, m_bufferID);
@@ -57,13 +55,9 @@ public:
 
 	// Public Interface Implementations
 	inline void bindBuffer(const GLenum& target) const noexcept final {
-		// Ensure writing has finished before reading
-		//WaitForFence(m_writeFence[m_index]);
 		glBindBuffer(target, m_bufferID[m_index]);
 	}
 	inline void bindBufferBase(const GLenum& target, const GLuint& index) const noexcept final {
-		// Ensure writing has finished before reading
-		//WaitForFence(m_writeFence[m_index]);
 		glBindBufferBase(target, index, m_bufferID[m_index]);
 	}
 
@@ -102,11 +96,9 @@ public:
 			const GLsizeiptr oldSize = m_maxCapacity;
 			m_maxCapacity += offset + (size * 2);
 
-			// Wait for and transfer data from old buffers into new buffers of the new size
+			// Transfer data from old buffers into new buffers of the new size, on the GPU
+			auto& frameSync = GL_Fence::Get_Frame_Sync();
 			for (int x = 0; x < BufferCount; ++x) {
-				WaitForFence(m_writeFence[x]);
-				WaitForFence(m_readFence[x]);
-
 				// Create new buffer
 				GLuint newBuffer = 0;
 				glCreateBuffers(1, &newBuffer);
@@ -123,38 +115,41 @@ public:
 				// Migrate new buffer
 				m_bufferID[x] = newBuffer;
 				m_bufferPtr[x] = glMapNamedBufferRange(m_bufferID[x], 0, m_maxCapacity, m_mapFlags);
+				m_slotEpoch[x] = frameSync.epoch();
 			}
+
+			// Only the buffer being written now must wait for its copy, the rest wait when next written
+			frameSync.acquire(m_slotEpoch[m_index], m_syncStats);
 		}
 	}
 	/** Prepare this buffer for writing, waiting on any unfinished reads. */
 	inline void beginWriting() const noexcept {
-		// Ensure all reads and writes at this index have finished.
-		WaitForFence(m_writeFence[m_index]);
-		WaitForFence(m_readFence[m_index]);
-	}
-	/** Signal that this multi-buffer is finished being written to. */
-	inline void endWriting() const noexcept {
-		if (!m_writeFence[m_index])
-			m_writeFence[m_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		// Usually already passed, as each frame begins by waiting on older frames
+		GL_Fence::Get_Frame_Sync().acquire(m_slotEpoch[m_index], m_syncStats);
 	}
+	/** Signal that this multi-buffer is finished being written to.
+	@note					Mapped writes are coherent, so nothing needs fencing until the buffer is read. */
+	inline void endWriting() const noexcept {}
 	/** Signal that this multi-buffer is finished being read from. */
 	inline void endReading() noexcept {
-		if (!m_readFence[m_index])
-			m_readFence[m_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_slotEpoch[m_index] = GL_Fence::Get_Frame_Sync().epoch();
 		m_index = (m_index + 1) % BufferCount;
 	}
+	/** Retrieve how often, and for how long, this buffer has waited on the GPU.
+	@return					the stall statistics. */
+	inline const Sync_Stats& getSyncStats() const noexcept {
+		return m_syncStats;
+	}
 	/** Movement operator, for moving another buffer into this one.
 	@param	other			another buffer to move the data from, to here. */
 	inline DynamicBuffer& operator=(DynamicBuffer&& other) noexcept {
 		for (int x = 0; x < BufferCount; ++x) {
 			m_bufferID[x] = std::move(other.m_bufferID[x]);
 			m_bufferPtr[x] = std::move(other.m_bufferPtr[x]);
-			m_writeFence[x] = std::move(other.m_writeFence[x]);
-			m_readFence[x] = std::move(other.m_readFence[x]);
+			m_slotEpoch[x] = std::move(other.m_slotEpoch[x]);
 			other.m_bufferID[x] = 0;
 			other.m_bufferPtr[x] = nullptr;
-			other.m_writeFence[x] = nullptr;
-			other.m_readFence[x] = nullptr;
+			other.m_slotEpoch[x] = 0ULL;
 		}
 
 		m_mapFlags = (std::move(other.m_mapFlags));
@@ -177,26 +172,10 @@ public:
 
 
 private:
-	// Private Methods
-	/** Wait for the fence at the supplied index to pass.
-	@param	fence			the fence belonging to a particular internal buffer. */
-	static void WaitForFence(GLsync& fence) noexcept {
-		while (fence) {
-			GLbitfield waitFlags = 0;
-			if (const auto waitReturn = glClientWaitSync(fence, waitFlags, 1);
-				waitReturn == GL_SIGNALED || waitReturn == GL_ALREADY_SIGNALED || waitReturn == GL_CONDITION_SATISFIED) {
-				glDeleteSync(fence);
-				fence = nullptr;
-				return;
-			}
-			waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
-		}
-	}
-
-
 	// Private Attributes
 	GLbitfield m_mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
-	mutable GLsync m_writeFence[BufferCount]{}, m_readFence[BufferCount]{};
+	std::uint64_t m_slotEpoch[BufferCount]{};
+	mutable Sync_Stats m_syncStats;
 	GLuint m_bufferID[BufferCount]{};
 	void* m_bufferPtr[BufferCount]{};
 	int m_index = 0;
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef FENCE_INTERFACE_H
+#define FENCE_INTERFACE_H
+
+#include <cstdint>
+
+
+/** An interface for the GPU fences a Frame_Sync schedules, implemented with OpenGL or simulated. */
+class Fence_Interface {
+public:
+	// Public (De)Constructors
+	/** Virtual Destructor. */
+	inline virtual ~Fence_Interface() = default;
+	/** Default constructor. */
+	inline Fence_Interface() noexcept = default;
+
+
+	// Public Interface Declarations
+	/** Insert a fence after every GPU command issued so far.
+	@return					handle to the new fence. */
+	virtual void* insertFence() = 0;
+	/** Wait for a fence to be signaled, up to a timeout.
+	@param	fence			the fence to wait on.
+	@param	timeout			the longest time to wait, in nanoseconds, or 0 to only check.
+	@param	flush			true to flush pending GPU commands first, so the fence can be signaled at all.
+	@return					true if the fence was signaled, false if the timeout expired. */
+	virtual bool waitFence(void* fence, const std::int64_t& timeout, const bool& flush) = 0;
+	/** Destroy a fence.
+	@param	fence			the fence to destroy. */
+	virtual void deleteFence(void* fence) = 0;
+	/** Retrieve the current time, for measuring stalls.
+	@return					the time in nanoseconds. */
+	virtual std::int64_t getTime() = 0;
+};
+
+#endif // FENCE_INTERFACE_H
\ No newline at end of file
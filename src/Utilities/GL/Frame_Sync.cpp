@@ -0,0 +1,142 @@
+#include "Utilities/GL/Frame_Sync.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
+
+
+Frame_Sync::~Frame_Sync()
+{
+	reset();
+}
+
+Frame_Sync::Frame_Sync(std::unique_ptr<Fence_Interface>&& fences) noexcept :
+	m_fences(std::move(fences))
+{
+}
+
+void Frame_Sync::beginFrame()
+{
+	m_lastBufferStalls = m_bufferStalls;
+	m_bufferStalls = {};
+	m_frameWait = {};
+
+	// The only wait most frames should need, covering every buffer at once
+	poll();
+	if (m_frames.size() >= FRAMESYNC_FRAMES_IN_FLIGHT) {
+		wait(m_frames.front(), m_frameWait, FRAMESYNC_INFINITE);
+		m_frames.pop_front();
+	}
+}
+
+void Frame_Sync::endFrame()
+{
+	closeEpoch();
+	m_frames.push_back(m_epoch - 1ULL);
+}
+
+std::uint64_t Frame_Sync::epoch() const noexcept
+{
+	return m_epoch;
+}
+
+bool Frame_Sync::tryAcquire(const std::uint64_t& epoch)
+{
+	if (epoch <= m_completed)
+		return true;
+	// An open epoch can't finish until it is fenced
+	if (epoch >= m_epoch)
+		closeEpoch();
+	poll();
+	return epoch <= m_completed;
+}
+
+bool Frame_Sync::acquire(const std::uint64_t& epoch, Sync_Stats& stats, const std::int64_t& timeout)
+{
+	if (epoch <= m_completed)
+		return true;
+	Sync_Stats waited;
+	const bool acquired = wait(epoch, waited, timeout);
+	stats.m_stalls += waited.m_stalls;
+	stats.m_stallTime += waited.m_stallTime;
+	m_bufferStalls.m_stalls += waited.m_stalls;
+	m_bufferStalls.m_stallTime += waited.m_stallTime;
+	return acquired;
+}
+
+const Sync_Stats& Frame_Sync::getFrameWait() const noexcept
+{
+	return m_frameWait;
+}
+
+const Sync_Stats& Frame_Sync::getBufferStalls() const noexcept
+{
+	return m_lastBufferStalls;
+}
+
+void Frame_Sync::reset()
+{
+	for (const auto& pending : m_pending)
+		m_fences->deleteFence(pending.m_fence);
+	m_pending.clear();
+	m_frames.clear();
+	m_completed = m_epoch - 1ULL;
+}
+
+void Frame_Sync::closeEpoch()
+{
+	m_pending.push_back({ m_epoch, m_fences->insertFence() });
+	++m_epoch;
+}
+
+void Frame_Sync::poll()
+{
+	// Fences pass in order, so stop at the first that hasn't
+	size_t passed(0ULL);
+	while (passed < m_pending.size() && m_fences->waitFence(m_pending[passed].m_fence, 0LL, false))
+		++passed;
+	complete(passed);
+}
+
+void Frame_Sync::complete(const size_t& count)
+{
+	for (size_t x = 0ULL; x < count; ++x) {
+		m_completed = m_pending.front().m_epoch;
+		m_fences->deleteFence(m_pending.front().m_fence);
+		m_pending.pop_front();
+	}
+}
+
+bool Frame_Sync::wait(const std::uint64_t& epoch, Sync_Stats& stats, const std::int64_t& timeout)
+{
+	if (epoch <= m_completed)
+		return true;
+	if (epoch >= m_epoch)
+		closeEpoch();
+	poll();
+	if (epoch <= m_completed)
+		return true;
+
+	// Find the fence closing the epoch, which also covers every epoch before it
+	const auto spot = std::find_if(m_pending.cbegin(), m_pending.cend(), [&epoch](const auto& pending) noexcept {
+		return pending.m_epoch >= epoch;
+		});
+	const auto count = static_cast<size_t>(std::distance(m_pending.cbegin(), spot)) + 1ULL;
+	void* const fence = spot->m_fence;
+
+	// Flush on the first wait only, then back off with longer waits
+	PROFILE_ZONE("Sync", "Frame_Sync::wait");
+	const auto start = m_fences->getTime();
+	auto slice = std::min<std::int64_t>(FRAMESYNC_MIN_WAIT, timeout);
+	bool flush = true, signaled = false;
+	while (!(signaled = m_fences->waitFence(fence, slice, flush))) {
+		const auto elapsed = m_fences->getTime() - start;
+		if (elapsed >= timeout)
+			break;
+		flush = false;
+		slice = std::min<std::int64_t>({ slice * 2LL, FRAMESYNC_MAX_WAIT, timeout - elapsed });
+	}
+	stats.m_stalls++;
+	stats.m_stallTime += m_fences->getTime() - start;
+	if (signaled)
+		complete(count);
+	return signaled;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+#ifndef FRAME_SYNC_H
+#define FRAME_SYNC_H
+
+#include "Utilities/GL/Fence_Interface.h"
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+
+
+/** Number of frames the CPU may run ahead of the GPU. */
+constexpr size_t FRAMESYNC_FRAMES_IN_FLIGHT = 3ULL;
+/** Shortest and longest single fence wait, in nanoseconds, between which waiting backs off. */
+constexpr std::int64_t FRAMESYNC_MIN_WAIT = 50000LL, FRAMESYNC_MAX_WAIT = 2000000LL;
+/** Timeout meaning wait forever. */
+constexpr std::int64_t FRAMESYNC_INFINITE = std::numeric_limits<std::int64_t>::max();
+
+/** How often, and for how long, something waited on the GPU. */
+struct Sync_Stats {
+	size_t m_stalls = 0ULL;
+	std::int64_t m_stallTime = 0LL;
+};
+
+/** Schedules GPU fences for every multi-buffered persistent buffer together.
+GPU work is split into epochs, each closed by a single fence, so buffers only need to remember the epoch they were last read in.
+One fence is placed per frame, and the start of each frame waits for the frame FRAMESYNC_FRAMES_IN_FLIGHT frames ago, after which buffers cycling once per frame never wait themselves.
+Buffers reused sooner than that close the current epoch early, costing an extra fence.
+Not thread-safe, use only from the rendering thread. */
+class Frame_Sync {
+public:
+	// Public (De)Constructors
+	/** Destroy any remaining fences. */
+	~Frame_Sync();
+	/** Construct a frame synchronizer.
+	@param	fences			the fence implementation to use. */
+	explicit Frame_Sync(std::unique_ptr<Fence_Interface>&& fences) noexcept;
+	/** Disallow frame sync move constructor. */
+	Frame_Sync(Frame_Sync&&) noexcept = delete;
+	/** Disallow frame sync copy constructor. */
+	Frame_Sync(const Frame_Sync&) noexcept = delete;
+	/** Disallow frame sync move assignment. */
+	Frame_Sync& operator =(Frame_Sync&&) noexcept = delete;
+	/** Disallow frame sync copy assignment. */
+	Frame_Sync& operator =(const Frame_Sync&) noexcept = delete;
+
+
+	// Public Methods
+	/** Begin a frame, waiting until the GPU is no more than FRAMESYNC_FRAMES_IN_FLIGHT frames behind. */
+	void beginFrame();
+	/** End a frame, fencing every GPU command issued during it. */
+	void endFrame();
+	/** Retrieve the epoch GPU commands issued right now belong to, to be passed to tryAcquire or acquire later.
+	@return					the current epoch. */
+	std::uint64_t epoch() const noexcept;
+	/** Check if the GPU has finished an epoch, without waiting.
+	@param	epoch			the epoch to check.
+	@return					true if the epoch has finished, false otherwise. */
+	bool tryAcquire(const std::uint64_t& epoch);
+	/** Wait for the GPU to finish an epoch, with increasingly long waits until the timeout.
+	@param	epoch			the epoch to wait for.
+	@param	stats			the waiter's statistics, updated if it had to wait.
+	@param	timeout			the longest time to wait, in nanoseconds.
+	@return					true if the epoch has finished, false if the timeout expired. */
+	bool acquire(const std::uint64_t& epoch, Sync_Stats& stats, const std::int64_t& timeout = FRAMESYNC_INFINITE);
+	/** Retrieve how long the start of the last frame waited on the GPU.
+	@return					the frame wait statistics. */
+	const Sync_Stats& getFrameWait() const noexcept;
+	/** Retrieve how often, and for how long, buffers waited on the GPU over the last frame.
+	@return					the buffer stall statistics, summed across every buffer. */
+	const Sync_Stats& getBufferStalls() const noexcept;
+	/** Destroy every fence and treat all work as finished, such as before the GPU context is destroyed. */
+	void reset();
+
+
+private:
+	// Private Methods
+	/** Close the current epoch with a fence. */
+	void closeEpoch();
+	/** Forget fences the GPU has already passed, without waiting. */
+	void poll();
+	/** Mark every epoch up to a pending fence as finished.
+	@param	count			the number of pending fences that have passed. */
+	void complete(const size_t& count);
+	/** Wait for the GPU to finish an epoch.
+	@param	epoch			the epoch to wait for.
+	@param	stats			statistics updated if it had to wait.
+	@param	timeout			the longest time to wait, in nanoseconds.
+	@return					true if the epoch has finished, false if the timeout expired. */
+	bool wait(const std::uint64_t& epoch, Sync_Stats& stats, const std::int64_t& timeout);
+
+
+	// Private Attributes
+	/** A fence closing an epoch. */
+	struct Pending_Fence {
+		std::uint64_t m_epoch = 0ULL;
+		void* m_fence = nullptr;
+	};
+	std::unique_ptr<Fence_Interface> m_fences;
+	std::deque<Pending_Fence> m_pending;
+	/** Epochs closed at the end of each frame still in flight. */
+	std::deque<std::uint64_t> m_frames;
+	std::uint64_t m_epoch = 1ULL, m_completed = 0ULL;
+	Sync_Stats m_frameWait, m_bufferStalls, m_lastBufferStalls;
+};
+
+#endif // FRAME_SYNC_H
\ No newline at end of file
@@ -0,0 +1,32 @@
+#include "Utilities/GL/GL_Fence.h"
+#include <glad/glad.h>
+#include <chrono>
+
+
+void* GL_Fence::insertFence()
+{
+	return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+bool GL_Fence::waitFence(void* fence, const std::int64_t& timeout, const bool& flush)
+{
+	// Treat failures as signaled, rather than waiting on them forever
+	const auto waitReturn = glClientWaitSync(static_cast<GLsync>(fence), flush ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, static_cast<GLuint64>(timeout));
+	return waitReturn != GL_TIMEOUT_EXPIRED;
+}
+
+void GL_Fence::deleteFence(void* fence)
+{
+	glDeleteSync(static_cast<GLsync>(fence));
+}
+
+std::int64_t GL_Fence::getTime()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Frame_Sync& GL_Fence::Get_Frame_Sync()
+{
+	static Frame_Sync frameSync(std::make_unique<GL_Fence>());
+	return frameSync;
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+#ifndef GL_FENCE_H
+#define GL_FENCE_H
+
+#include "Utilities/GL/Frame_Sync.h"
+
+
+/** Implements fences with OpenGL sync objects. */
+class GL_Fence final : public Fence_Interface {
+public:
+	// Public Interface Implementations
+	void* insertFence() final;
+	bool waitFence(void* fence, const std::int64_t& timeout, const bool& flush) final;
+	void deleteFence(void* fence) final;
+	std::int64_t getTime() final;
+
+
+	// Public Methods
+	/** Retrieve the frame synchronizer shared by every OpenGL buffer.
+	@return					the engine-wide frame synchronizer. */
+	static Frame_Sync& Get_Frame_Sync();
+};
+
+#endif // GL_FENCE_H
\ No newline at end of file
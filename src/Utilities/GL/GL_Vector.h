@@ -3,6 +3,7 @@
 #define GL_VECTOR_H
 
 #include "Utilities/GL/Buffer_Interface.h"
+#include "Utilities/GL/GL_Fence.h"
 #include <algorithm>
 
 
@@ -16,8 +17,6 @@ public:
 	inline ~GL_Vector() {
 		// Safely destroy each buffer this class owns
 		for (int x = 0; x < BufferCount; ++x) {
-			WaitForFence(m_writeFence[x]);
-			WaitForFence(m_readFence[x]);
 			if (m_bufferID[x]) {
 				glUnmapNamedBuffer(m_bufferID[x]);
 				glDeleteBuffers(1, &m_bufferID[x]);
@@ -26,13 +25,12 @@ public:
 	}
 	/** Construct a GL Vector.
 	@param	capacity		the starting capacity (1 or more). */
-	inline GL_Vector(const size_t& capacity = 1) noexcept : m_capacity(std::max(1ull, capacity)) {
+	inline GL_Vector(const size_t& capacity = 1) noexcept : m_capacity(std::max<size_t>(1ULL, capacity)) {
 		// Zero-initialize our starting variables
 		for (int x = 0; x < BufferCount; ++x) {
 			m_bufferID[x] = 0;
 			m_bufferPtr[x] = nullptr;
-			m_writeFence[x] = nullptr;
-			m_readFence[x] = nullptr;
+			m_slotEpoch[x] = 0ULL;
 		}
 
 		// Create 'BufferCount' number of buffers & map them
@@ -58,13 +56,9 @@ public:
 
 	// Public Interface Implementations
 	inline void bindBuffer(const GLenum& target) const noexcept final {
-		// Ensure writing has finished before reading
-		//WaitForFence(m_writeFence[m_index]);
 		glBindBuffer(target, m_bufferID[m_index]);
 	}
 	inline void bindBufferBase(const GLenum& target, const GLuint& index) const noexcept final {
-		// Ensure writing has finished before reading
-		//WaitForFence(m_writeFence[m_index]);
 		glBindBufferBase(target, index, m_bufferID[m_index]);
 	}
 
@@ -72,25 +66,26 @@ public:
 	// Public Methods
 	/** Prepare this buffer for writing, waiting on any unfinished reads. */
 	inline void beginWriting() const noexcept {
-		// Ensure all reads and writes at this index have finished.
-		WaitForFence(m_writeFence[m_index]);
-		WaitForFence(m_readFence[m_index]);
-	}
-	/** Signal that this multi-buffer is finished being written to. */
-	inline void endWriting() const noexcept {
-		if (!m_writeFence[m_index])
-			m_writeFence[m_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		// Usually already passed, as each frame begins by waiting on older frames
+		GL_Fence::Get_Frame_Sync().acquire(m_slotEpoch[m_index], m_syncStats);
 	}
+	/** Signal that this multi-buffer is finished being written to.
+	@note					Mapped writes are coherent, so nothing needs fencing until the buffer is read. */
+	inline void endWriting() const noexcept {}
 	/** Signal that this multi-buffer is finished being read from. */
 	inline void endReading() noexcept {
-		if (!m_readFence[m_index])
-			m_readFence[m_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_slotEpoch[m_index] = GL_Fence::Get_Frame_Sync().epoch();
 		m_index = (m_index + 1) % BufferCount;
 	}
+	/** Retrieve how often, and for how long, this buffer has waited on the GPU.
+	@return					the stall statistics. */
+	inline const Sync_Stats& getSyncStats() const noexcept {
+		return m_syncStats;
+	}
 	/** Resizes the internal capacity of this vector.
 	@note					Does nothing if the capacity is the same
 	@note					Currently, only grows, never shrinks
-	@note					May stall waiting for old buffers to finish, invalidate them.
+	@note					Stalls once, waiting for the current buffer's contents to be copied.
 	@param	newCapacity		the new desired capacity. */
 	inline void resize(const size_t& newCapacity) noexcept {
 		// See if we must expand this container
@@ -100,11 +95,9 @@ public:
 			const auto newByteSize = sizeof(T) * newCapacity;
 			m_capacity = newCapacity;
 
-			// Wait for and transfer data from old buffers into new buffers of the new size
+			// Transfer data from old buffers into new buffers of the new size, on the GPU
+			auto& frameSync = GL_Fence::Get_Frame_Sync();
 			for (int x = 0; x < BufferCount; ++x) {
-				WaitForFence(m_writeFence[x]);
-				WaitForFence(m_readFence[x]);
-
 				// Create new buffer
 				GLuint newBuffer = 0;
 				glCreateBuffers(1, &newBuffer);
@@ -121,9 +114,18 @@ public:
 				// Migrate new buffer
 				m_bufferID[x] = newBuffer;
 				m_bufferPtr[x] = (T*)(glMapNamedBufferRange(m_bufferID[x], 0, newByteSize, BufferFlags));
+				m_slotEpoch[x] = frameSync.epoch();
 			}
+
+			// Only the buffer being written now must wait for its copy, the rest wait when next written
+			frameSync.acquire(m_slotEpoch[m_index], m_syncStats);
 		}
 	}
+	/** Retrieve which of the multi-buffers is currently in use.
+	@return					the current buffer index. */
+	inline int getIndex() const noexcept {
+		return m_index;
+	}
 	/** Retrieve the length of this vector (the number of elements in it).
 	@return					the number of elements in this array. */
 	inline size_t getLength() const noexcept {
@@ -135,12 +137,10 @@ public:
 		for (int x = 0; x < BufferCount; ++x) {
 			m_bufferID[x] = std::move(other.m_bufferID[x]);
 			m_bufferPtr[x] = std::move(other.m_bufferPtr[x]);
-			m_writeFence[x] = std::move(other.m_writeFence[x]);
-			m_readFence[x] = std::move(other.m_readFence[x]);
+			m_slotEpoch[x] = std::move(other.m_slotEpoch[x]);
 			other.m_bufferID[x] = 0;
 			other.m_bufferPtr[x] = nullptr;
-			other.m_writeFence[x] = nullptr;
-			other.m_readFence[x] = nullptr;
+			other.m_slotEpoch[x] = 0ULL;
 		}
 
 		m_capacity = std::move(other.m_capacity);
@@ -166,26 +166,10 @@ public:
 
 
 private:
-	// Private Methods
-	/** Wait for the fence at the supplied index to pass.
-	@param	fence			the fence belonging to a particular internal buffer. */
-	static void WaitForFence(GLsync& fence) noexcept {
-		while (fence) {
-			GLbitfield waitFlags = 0;
-			if (const auto waitReturn = glClientWaitSync(fence, waitFlags, 1);
-				waitReturn == GL_SIGNALED || waitReturn == GL_ALREADY_SIGNALED || waitReturn == GL_CONDITION_SATISFIED) {
-				glDeleteSync(fence);
-				fence = nullptr;
-				return;
-			}
-			waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
-		}
-	}
-
-
 	// Private Attributes
 	constexpr const static GLbitfield BufferFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
-	mutable GLsync m_writeFence[BufferCount]{}, m_readFence[BufferCount]{};
+	std::uint64_t m_slotEpoch[BufferCount]{};
+	mutable Sync_Stats m_syncStats;
 	GLuint m_bufferID[BufferCount]{};
 	T* m_bufferPtr[BufferCount]{};
 	int m_index = 0;
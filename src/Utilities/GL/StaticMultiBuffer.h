@@ -3,6 +3,7 @@
 #define STATICMULTIBUFFER_H
 
 #include "Utilities/GL/Buffer_Interface.h"
+#include "Utilities/GL/GL_Fence.h"
 #include <utility>
 
 
@@ -11,11 +12,9 @@ template <int BufferCount = 3>
 class StaticMultiBuffer final : public Buffer_Interface {
 public:
 	// Public (De)Constructors
-	/** Wait on this buffers fences, then destroy it. */
+	/** Destroy this buffer, the driver deferring deletion until the GPU is done with it. */
 	inline ~StaticMultiBuffer() {
 		for (int x = 0; x < BufferCount; ++x) {
-			WaitForFence(m_writeFence[x]);
-			WaitForFence(m_readFence[x]);
 			if (m_bufferID[x]) {
 				glUnmapNamedBuffer(m_bufferID[x]);
 				glDeleteBuffers(1, &m_bufferID[x]);
@@ -28,8 +27,7 @@ public:
 		for (int x = 0; x < BufferCount; ++x) {
 			m_bufferID[x] = 0;
 			m_bufferPtr[x] = nullptr;
-			m_writeFence[x] = nullptr;
-			m_readFence[x] = nullptr;
+			m_slotEpoch[x] = 0ULL;
 		}
 	}
 	/** Construct a new Static Multi-Buffer.
@@ -42,8 +40,7 @@ public:
 		for (int x = 0; x < BufferCount; ++x) {
 			m_bufferID[x] = 0;
 			m_bufferPtr[x] = nullptr;
-			m_writeFence[x] = nullptr;
-			m_readFence[x] = nullptr;
+			m_slotEpoch[x] = 0ULL;
 		}
 
 		glCreateBuffers(BufferCount, m_bufferID);
@@ -61,8 +58,7 @@ public:
 		for (int x = 0; x < BufferCount; ++x) {
 			m_bufferID[x] = 0;
 			m_bufferPtr[x] = nullptr;
-			m_writeFence[x] = nullptr;
-			m_readFence[x] = nullptr;
+			m_slotEpoch[x] = 0ULL;
 		}
 
 		for (int x = 0; x < BufferCount; ++x)
@@ -76,13 +72,9 @@ public:
 
 	// Public Interface Implementations
 	inline void bindBuffer(const GLenum& target) const noexcept final {
-		// Ensure writing has finished before reading
-		//WaitForFence(m_writeFence[m_index]);
 		glBindBuffer(target, m_bufferID[m_index]);
 	}
 	inline void bindBufferBase(const GLenum& target, const GLuint& index) const noexcept final {
-		// Ensure writing has finished before reading
-		//WaitForFence(m_writeFence[m_index]);
 		glBindBufferBase(target, index, m_bufferID[m_index]);
 	}
 
@@ -97,21 +89,22 @@ public:
 	}
 	/** Prepare this buffer for writing, waiting on any unfinished reads. */
 	inline void beginWriting() const noexcept {
-		// Ensure all reads and writes at this index have finished.
-		WaitForFence(m_writeFence[m_index]);
-		WaitForFence(m_readFence[m_index]);
+		// Usually already passed, as each frame begins by waiting on older frames
+		GL_Fence::Get_Frame_Sync().acquire(m_slotEpoch[m_index], m_syncStats);
 	}
-	/** Signal that this multi-buffer is finished being written to. */
-	inline void endWriting() const noexcept {
-		if (!m_writeFence[m_index])
-			m_writeFence[m_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-	}
-	/** Signal that this multi-buffer has finished being read from. */
+	/** Signal that this multi-buffer is finished being written to.
+	@note					Mapped writes are coherent, so nothing needs fencing until the buffer is read. */
+	inline void endWriting() const noexcept {}
+	/** Signal that this multi-buffer is finished being read from. */
 	inline void endReading() noexcept {
-		if (!m_readFence[m_index])
-			m_readFence[m_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_slotEpoch[m_index] = GL_Fence::Get_Frame_Sync().epoch();
 		m_index = (m_index + 1) % BufferCount;
 	}
+	/** Retrieve how often, and for how long, this buffer has waited on the GPU.
+	@return					the stall statistics. */
+	inline const Sync_Stats& getSyncStats() const noexcept {
+		return m_syncStats;
+	}
 	/** Copy GL object from 1 instance in to another. */
 	inline StaticMultiBuffer& operator=(const StaticMultiBuffer& other) noexcept {
 		if (this != &other) {
@@ -128,12 +121,10 @@ public:
 			for (int x = 0; x < BufferCount; ++x) {
 				m_bufferID[x] = std::move(other.m_bufferID[x]);
 				m_bufferPtr[x] = std::move(other.m_bufferPtr[x]);
-				m_writeFence[x] = std::move(other.m_writeFence[x]);
-				m_readFence[x] = std::move(other.m_readFence[x]);
+				m_slotEpoch[x] = std::move(other.m_slotEpoch[x]);
 				other.m_bufferID[x] = 0;
 				other.m_bufferPtr[x] = nullptr;
-				other.m_writeFence[x] = nullptr;
-				other.m_readFence[x] = nullptr;
+				other.m_slotEpoch[x] = 0ULL;
 			}
 			m_mapFlags = (std::move(other.m_mapFlags));
 			m_index = std::move(other.m_index);
@@ -147,26 +138,10 @@ public:
 
 
 private:
-	// Private Methods
-	/** Wait for the fence at the supplied index to pass.
-	@param	fence			the fence belonging to a particular internal buffer. */
-	static void WaitForFence(GLsync& fence) noexcept {
-		while (fence) {
-			GLbitfield waitFlags = 0;
-			if (const auto waitReturn = glClientWaitSync(fence, waitFlags, 1);
-				waitReturn == GL_SIGNALED || waitReturn == GL_ALREADY_SIGNALED || waitReturn == GL_CONDITION_SATISFIED) {
-				glDeleteSync(fence);
-				fence = nullptr;
-				return;
-			}
-			waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
-		}
-	}
-
-
 	// Private Attributes
 	GLbitfield m_mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
-	mutable GLsync m_writeFence[BufferCount]{}, m_readFence[BufferCount]{};
+	std::uint64_t m_slotEpoch[BufferCount]{};
+	mutable Sync_Stats m_syncStats;
 	GLuint m_bufferID[BufferCount]{};
 	void* m_bufferPtr[BufferCount]{};
 	int m_index = 0;
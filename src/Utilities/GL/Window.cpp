@@ -2,6 +2,7 @@
 #include "Engine.h"
 #include <glad/glad.h>
 #include "GLFW/glfw3.h"
+#include <algorithm>
 
 
 constexpr int DESIRED_OGL_VER_MAJOR = 4;
@@ -26,7 +27,7 @@ Window::Window(Engine& engine) :
 {
 	// Initialize GLFW
 	if (glfwInit() == 0) {
-		engine.getManager_Messages().error("GLFW unable to initialize, shutting down...");
+		engine.getManager_Messages().error("GLFW unable to initialize, shutting down...", Message_Category::GRAPHICS);
 		glfwTerminate();
 		exit(-1);
 	}
@@ -58,7 +59,7 @@ Window::Window(Engine& engine) :
 
 	// Initialize GLAD
 	if (gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress)) == 0) {
-		engine.getManager_Messages().error("GLAD unable to initialize, shutting down...");
+		engine.getManager_Messages().error("GLAD unable to initialize, shutting down...", Message_Category::GRAPHICS);
 		glfwTerminate();
 		exit(-1);
 	}
@@ -123,8 +124,12 @@ Window::Window(Engine& engine) :
 		if ((v != 0) && GL_CONTEXT_FLAG_DEBUG_BIT) {
 			glEnable(GL_DEBUG_OUTPUT);
 			glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-			engine.getManager_Messages().statement(">>> KHR DEBUG MODE ENABLED <<<");
+			engine.getManager_Messages().statement(">>> KHR DEBUG MODE ENABLED <<<", Message_Category::GRAPHICS);
 			constexpr const static auto myCallback = [](GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* msg, const void* data) {
+				// Skip building the message entirely if it would be discarded
+				auto* messageManager = static_cast<MessageManager*>(const_cast<void*>(data));
+				if (severity == GL_DEBUG_SEVERITY_NOTIFICATION || severity == GL_DEBUG_SEVERITY_LOW || !messageManager->isEnabled(Message_Severity::FAILURE, Message_Category::GRAPHICS))
+					return;
 				std::string _source;
 				std::string _type;
 				std::string _severity;
@@ -197,9 +202,8 @@ Window::Window(Engine& engine) :
 					break;
 				}
 
-				if (severity != GL_DEBUG_SEVERITY_NOTIFICATION && severity != GL_DEBUG_SEVERITY_LOW)
-					static_cast<MessageManager*>(const_cast<void*>(data))->error(
-						std::to_string(id) + ": " + _type + " of " + _severity + " severity, raised from " + _source + ": " + std::string(msg, length));
+				messageManager->error(
+					std::to_string(id) + ": " + _type + " of " + _severity + " severity, raised from " + _source + ": " + std::string(msg, length), Message_Category::GRAPHICS);
 			};
 			glDebugMessageCallbackKHR(myCallback, &engine.getManager_Messages());
 		}
@@ -211,7 +215,7 @@ Window::Window(Engine& engine) :
 
 void Window::initThreads()
 {
-	const unsigned int maxThreads = std::max(1U, std::thread::hardware_concurrency());
+	const auto maxThreads = m_engine.getManager_Assets().getThreadCount();
 	m_threads.resize(maxThreads);
 	for (auto& threadEntry : m_threads) {
 		auto& [workerThread, exitSignal, sharedContext] = threadEntry;
@@ -0,0 +1,34 @@
+#include "Utilities/IO/Atomic_File.h"
+#include <cstdio>
+#include <filesystem>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+
+bool Atomic_File::Write(const std::string& fullPath, const std::vector<char>& data)
+{
+	const auto tempPath = fullPath + ".tmp";
+	auto* file = std::fopen(tempPath.c_str(), "wb");
+	if (file == nullptr)
+		return false;
+	bool success = std::fwrite(data.data(), 1ULL, data.size(), file) == data.size() && std::fflush(file) == 0;
+#ifdef _WIN32
+	success = success && _commit(_fileno(file)) == 0;
+#else
+	success = success && fsync(fileno(file)) == 0;
+#endif
+	success = std::fclose(file) == 0 && success;
+
+	// Only replace the destination once the new data is safely on disk
+	std::error_code errorCode;
+	if (success)
+		std::filesystem::rename(tempPath, fullPath, errorCode);
+	if (!success || errorCode) {
+		std::filesystem::remove(tempPath, errorCode);
+		return false;
+	}
+	return true;
+}
\ No newline at end of file
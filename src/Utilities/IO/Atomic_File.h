@@ -0,0 +1,20 @@
+#pragma once
+#ifndef	ATOMIC_FILE_H
+#define	ATOMIC_FILE_H
+
+#include <string>
+#include <vector>
+
+
+/** A static helper class used for replacing files without ever leaving a partially written one behind. */
+class Atomic_File {
+public:
+	/** Write data to a file atomically, writing and flushing a temporary file to disk before renaming it over the destination.
+	@note						if anything fails, including a crash part-way through, the destination keeps its previous contents.
+	@param	fullPath			the absolute path to the file.
+	@param	data				the data to write.
+	@return						true if the file was written, false otherwise. */
+	static bool Write(const std::string& fullPath, const std::vector<char>& data);
+};
+
+#endif // ATOMIC_FILE_H
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "Utilities/IO/Block_Compression.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+
+/** Gather a 4x4 block of RGBA pixels, repeating the edge pixels for blocks that overhang the image.
+@param	pixels		the tightly packed RGBA pixels to read from.
+@param	dimensions	the image size.
+@param	blockX		the horizontal block index.
+@param	blockY		the vertical block index.
+@param	block		the 16 gathered pixels. */
+inline static void Gather_Block(const GLubyte* pixels, const glm::ivec2& dimensions, const int& blockX, const int& blockY, GLubyte block[64]) noexcept
+{
+	for (int y = 0; y < 4; ++y)
+		for (int x = 0; x < 4; ++x) {
+			const auto sourceX = std::min(blockX * 4 + x, dimensions.x - 1);
+			const auto sourceY = std::min(blockY * 4 + y, dimensions.y - 1);
+			std::memcpy(&block[(y * 4 + x) * 4], &pixels[(static_cast<size_t>(sourceY) * static_cast<size_t>(dimensions.x) + static_cast<size_t>(sourceX)) * 4ULL], 4ULL);
+		}
+}
+
+/** Pack an RGB color into 5:6:5 bits. */
+inline static std::uint16_t Pack_565(const int& r, const int& g, const int& b) noexcept
+{
+	return static_cast<std::uint16_t>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+}
+
+/** Expand a 5:6:5 color back into 8 bits per channel. */
+inline static void Unpack_565(const std::uint16_t& color, int rgb[3]) noexcept
+{
+	const int r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+	rgb[0] = (r << 3) | (r >> 2);
+	rgb[1] = (g << 2) | (g >> 4);
+	rgb[2] = (b << 3) | (b >> 2);
+}
+
+/** Build the 4 color palette of a color block, always in its opaque 4 color mode. */
+inline static void Color_Palette(const std::uint16_t& color0, const std::uint16_t& color1, int palette[4][3]) noexcept
+{
+	Unpack_565(color0, palette[0]);
+	Unpack_565(color1, palette[1]);
+	for (int c = 0; c < 3; ++c) {
+		palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+		palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+	}
+}
+
+/** Encode the RGB channels of a block as an 8 byte BC1 color block, spanning the block's bounding box.
+@param	block		the 16 pixels to encode.
+@param	output		the 8 bytes to write to. */
+inline static void Encode_Color_Block(const GLubyte block[64], GLubyte* output) noexcept
+{
+	int minimum[3] = { 255, 255, 255 }, maximum[3] = { 0, 0, 0 };
+	for (int p = 0; p < 16; ++p)
+		for (int c = 0; c < 3; ++c) {
+			minimum[c] = std::min(minimum[c], static_cast<int>(block[p * 4 + c]));
+			maximum[c] = std::max(maximum[c], static_cast<int>(block[p * 4 + c]));
+		}
+	// Inset the box slightly, as the end points are rarely the best fit
+	for (int c = 0; c < 3; ++c) {
+		const int inset = (maximum[c] - minimum[c]) / 16;
+		minimum[c] += inset;
+		maximum[c] -= inset;
+	}
+
+	// The first color must be the larger one to stay in 4 color mode
+	auto color0 = Pack_565(maximum[0], maximum[1], maximum[2]);
+	auto color1 = Pack_565(minimum[0], minimum[1], minimum[2]);
+	if (color0 < color1)
+		std::swap(color0, color1);
+	int palette[4][3];
+	Color_Palette(color0, color1, palette);
+	std::uint32_t indices = 0U;
+	if (color0 != color1)
+		for (int p = 0; p < 16; ++p) {
+			int bestIndex = 0, bestDistance = std::numeric_limits<int>::max();
+			for (int i = 0; i < 4; ++i) {
+				int distance = 0;
+				for (int c = 0; c < 3; ++c) {
+					const int delta = static_cast<int>(block[p * 4 + c]) - palette[i][c];
+					distance += delta * delta;
+				}
+				if (distance < bestDistance) {
+					bestDistance = distance;
+					bestIndex = i;
+				}
+			}
+			indices |= static_cast<std::uint32_t>(bestIndex) << (p * 2);
+		}
+	const GLubyte bytes[8] = {
+		static_cast<GLubyte>(color0 & 0xFFU), static_cast<GLubyte>(color0 >> 8U),
+		static_cast<GLubyte>(color1 & 0xFFU), static_cast<GLubyte>(color1 >> 8U),
+		static_cast<GLubyte>(indices & 0xFFU), static_cast<GLubyte>((indices >> 8U) & 0xFFU),
+		static_cast<GLubyte>((indices >> 16U) & 0xFFU), static_cast<GLubyte>(indices >> 24U)
+	};
+	std::memcpy(output, bytes, sizeof(bytes));
+}
+
+/** Decode an 8 byte BC1 color block into the RGB channels of 16 pixels.
+@param	input		the 8 bytes to read from.
+@param	block		the 16 pixels to write to.
+@param	allowAlpha	true for standalone BC1 blocks, which can use a 3 color mode with transparent black. */
+inline static void Decode_Color_Block(const GLubyte* input, GLubyte block[64], const bool& allowAlpha) noexcept
+{
+	const auto color0 = static_cast<std::uint16_t>(input[0] | (input[1] << 8));
+	const auto color1 = static_cast<std::uint16_t>(input[2] | (input[3] << 8));
+	const auto indices = static_cast<std::uint32_t>(input[4]) | (static_cast<std::uint32_t>(input[5]) << 8U) | (static_cast<std::uint32_t>(input[6]) << 16U) | (static_cast<std::uint32_t>(input[7]) << 24U);
+	int palette[4][3];
+	Color_Palette(color0, color1, palette);
+	const bool threeColor = allowAlpha && color0 <= color1;
+	if (threeColor)
+		for (int c = 0; c < 3; ++c) {
+			palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+			palette[3][c] = 0;
+		}
+	for (int p = 0; p < 16; ++p) {
+		const auto index = (indices >> (p * 2)) & 3U;
+		for (int c = 0; c < 3; ++c)
+			block[p * 4 + c] = static_cast<GLubyte>(palette[index][c]);
+		if (allowAlpha)
+			block[p * 4 + 3] = (threeColor && index == 3U) ? 0U : 255U;
+	}
+}
+
+/** Encode one channel of a block as an 8 byte BC4 block, using its 8 value mode.
+@param	block		the 16 pixels to encode.
+@param	channel		the channel to encode.
+@param	output		the 8 bytes to write to. */
+inline static void Encode_Channel_Block(const GLubyte block[64], const int& channel, GLubyte* output) noexcept
+{
+	int minimum = 255, maximum = 0;
+	for (int p = 0; p < 16; ++p) {
+		minimum = std::min(minimum, static_cast<int>(block[p * 4 + channel]));
+		maximum = std::max(maximum, static_cast<int>(block[p * 4 + channel]));
+	}
+	int palette[8] = { maximum, minimum };
+	for (int i = 1; i < 7; ++i)
+		palette[i + 1] = ((7 - i) * maximum + i * minimum) / 7;
+	std::uint64_t indices = 0ULL;
+	if (maximum != minimum)
+		for (int p = 0; p < 16; ++p) {
+			int bestIndex = 0, bestDistance = std::numeric_limits<int>::max();
+			for (int i = 0; i < 8; ++i) {
+				const int distance = std::abs(static_cast<int>(block[p * 4 + channel]) - palette[i]);
+				if (distance < bestDistance) {
+					bestDistance = distance;
+					bestIndex = i;
+				}
+			}
+			indices |= static_cast<std::uint64_t>(bestIndex) << (p * 3);
+		}
+	output[0] = static_cast<GLubyte>(maximum);
+	output[1] = static_cast<GLubyte>(minimum);
+	for (int b = 0; b < 6; ++b)
+		output[2 + b] = static_cast<GLubyte>((indices >> (b * 8)) & 0xFFU);
+}
+
+/** Decode an 8 byte BC4 block into one channel of 16 pixels.
+@param	input		the 8 bytes to read from.
+@param	channel		the channel to write to.
+@param	block		the 16 pixels to write to. */
+inline static void Decode_Channel_Block(const GLubyte* input, const int& channel, GLubyte block[64]) noexcept
+{
+	const int value0 = input[0], value1 = input[1];
+	int palette[8] = { value0, value1 };
+	if (value0 > value1)
+		for (int i = 1; i < 7; ++i)
+			palette[i + 1] = ((7 - i) * value0 + i * value1) / 7;
+	else {
+		for (int i = 1; i < 5; ++i)
+			palette[i + 1] = ((5 - i) * value0 + i * value1) / 5;
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+	std::uint64_t indices = 0ULL;
+	for (int b = 0; b < 6; ++b)
+		indices |= static_cast<std::uint64_t>(input[2 + b]) << (b * 8);
+	for (int p = 0; p < 16; ++p)
+		block[p * 4 + channel] = static_cast<GLubyte>(palette[(indices >> (p * 3)) & 7U]);
+}
+
+size_t Block_Compression::Get_Block_Size(const Texture_Format& format) noexcept
+{
+	switch (format) {
+	case Texture_Format::BC1:
+		return 8ULL;
+	case Texture_Format::BC3:
+	case Texture_Format::BC5:
+		return 16ULL;
+	default:
+		return 0ULL;
+	}
+}
+
+std::vector<GLubyte> Block_Compression::Compress_Image(const GLubyte* pixels, const glm::ivec2& dimensions, const Texture_Format& format)
+{
+	const int blocksX = (dimensions.x + 3) / 4, blocksY = (dimensions.y + 3) / 4;
+	const auto blockBytes = Get_Block_Size(format);
+	std::vector<GLubyte> blocks(static_cast<size_t>(blocksX) * static_cast<size_t>(blocksY) * blockBytes);
+	GLubyte block[64];
+	auto* output = blocks.data();
+	for (int y = 0; y < blocksY; ++y)
+		for (int x = 0; x < blocksX; ++x, output += blockBytes) {
+			Gather_Block(pixels, dimensions, x, y, block);
+			switch (format) {
+			case Texture_Format::BC1:
+				Encode_Color_Block(block, output);
+				break;
+			case Texture_Format::BC3:
+				Encode_Channel_Block(block, 3, output);
+				Encode_Color_Block(block, output + 8);
+				break;
+			case Texture_Format::BC5:
+				Encode_Channel_Block(block, 0, output);
+				Encode_Channel_Block(block, 1, output + 8);
+				break;
+			default:
+				break;
+			}
+		}
+	return blocks;
+}
+
+std::vector<GLubyte> Block_Compression::Decompress_Image(const GLubyte* blocks, const glm::ivec2& dimensions, const Texture_Format& format)
+{
+	const int blocksX = (dimensions.x + 3) / 4, blocksY = (dimensions.y + 3) / 4;
+	const auto blockBytes = Get_Block_Size(format);
+	std::vector<GLubyte> pixels(static_cast<size_t>(dimensions.x) * static_cast<size_t>(dimensions.y) * 4ULL);
+	GLubyte block[64];
+	const auto* input = blocks;
+	for (int y = 0; y < blocksY; ++y)
+		for (int x = 0; x < blocksX; ++x, input += blockBytes) {
+			switch (format) {
+			case Texture_Format::BC1:
+				Decode_Color_Block(input, block, true);
+				break;
+			case Texture_Format::BC3:
+				Decode_Channel_Block(input, 3, block);
+				Decode_Color_Block(input + 8, block, false);
+				break;
+			case Texture_Format::BC5:
+				Decode_Channel_Block(input, 0, block);
+				Decode_Channel_Block(input + 8, 1, block);
+				for (int p = 0; p < 16; ++p) {
+					block[p * 4 + 2] = 0U;
+					block[p * 4 + 3] = 255U;
+				}
+				break;
+			default:
+				break;
+			}
+
+			// Skip the parts of edge blocks that overhang the image
+			for (int by = 0; by < 4 && y * 4 + by < dimensions.y; ++by)
+				for (int bx = 0; bx < 4 && x * 4 + bx < dimensions.x; ++bx)
+					std::memcpy(&pixels[(static_cast<size_t>(y * 4 + by) * static_cast<size_t>(dimensions.x) + static_cast<size_t>(x * 4 + bx)) * 4ULL], &block[(by * 4 + bx) * 4], 4ULL);
+		}
+	return pixels;
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#ifndef	BLOCK_COMPRESSION_H
+#define	BLOCK_COMPRESSION_H
+
+#include "Utilities/IO/Image_IO.h"
+
+
+/** A static helper class encoding and decoding the 4x4 block compressed texture formats, used when baking texture caches.
+Blocks overhanging the right or bottom edge of an image repeat its edge pixels. */
+class Block_Compression {
+public:
+	// Public Methods
+	/** Retrieve the number of bytes in each 4x4 block of a compressed format.
+	@param	format			the format to check.
+	@return					the block size in bytes, or 0 if the format is uncompressed. */
+	static size_t Get_Block_Size(const Texture_Format& format) noexcept;
+	/** Compress an RGBA image into 4x4 blocks.
+	@param	pixels			the tightly packed RGBA pixels to compress.
+	@param	dimensions		the image size, which needn't be a multiple of 4.
+	@param	format			the block compressed format to use.
+	@return					the compressed blocks, row by row. */
+	static std::vector<GLubyte> Compress_Image(const GLubyte* pixels, const glm::ivec2& dimensions, const Texture_Format& format);
+	/** Decompress a block compressed image back into RGBA pixels.
+	@param	blocks			the compressed blocks to read from.
+	@param	dimensions		the image size, which needn't be a multiple of 4.
+	@param	format			the block compressed format the image uses.
+	@return					the tightly packed RGBA pixels. */
+	static std::vector<GLubyte> Decompress_Image(const GLubyte* blocks, const glm::ivec2& dimensions, const Texture_Format& format);
+};
+
+#endif // BLOCK_COMPRESSION_H
\ No newline at end of file
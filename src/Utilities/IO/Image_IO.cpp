@@ -1,18 +1,108 @@
 #include "Utilities/IO/Image_IO.h"
 #include "Engine.h"
+#include "Utilities/IO/Atomic_File.h"
+#include "Utilities/IO/Block_Compression.h"
+#include "Utilities/IO/Image_Kernels.h"
+#include "Utilities/IO/Mapped_File.h"
 #include "FreeImagePlus.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
 
 
-inline auto RGBA_to_BGRA(const GLubyte* pixels, const unsigned int& size)
+/** Find the size of each mip level of a texture.
+@param	dimensions	the size of the top mip level.
+@return				the size of each level, down to 1x1. */
+inline std::vector<glm::ivec2> mip_sizes(const glm::ivec2& dimensions)
 {
-	std::vector<GLubyte> newPixels(size_t(size) * 4ULL);
-	for (size_t x = 0; x < size; ++x) {
-		newPixels[x * 4 + 0] = pixels[x * 4 + 2];
-		newPixels[x * 4 + 1] = pixels[x * 4 + 1];
-		newPixels[x * 4 + 2] = pixels[x * 4 + 0];
-		newPixels[x * 4 + 3] = pixels[x * 4 + 3];
+	std::vector<glm::ivec2> sizes;
+	for (auto size = dimensions; ; size = glm::ivec2(std::max(1, size.x / 2), std::max(1, size.y / 2))) {
+		sizes.push_back(size);
+		if (size.x == 1 && size.y == 1)
+			break;
 	}
-	return newPixels;
+	return sizes;
+}
+
+/** Find where each mip level of a texture starts.
+@param	textureData	the texture to lay out (gets its mip offsets updated).
+@return				the total number of bytes the texture takes up. */
+inline size_t layout_mips(Texture_Data& textureData)
+{
+	textureData.mipOffsets.clear();
+	size_t total = 0ULL;
+	for (const auto& size : mip_sizes(textureData.dimensions)) {
+		textureData.mipOffsets.push_back(total);
+		total += Image_IO::Get_Image_Size(size, textureData.format) * textureData.layers;
+	}
+	return total;
+}
+
+/* TEXTURE CACHE STRUCTURE {
+	header
+	payload		(every mip level in turn, each holding every layer in turn)
+} */
+constexpr char TextureCacheMagic[4] = { 'R', 'T', 'E', 'X' };
+/** Bump whenever the mip generation, compression or cache layout change, invalidating every cached texture. */
+constexpr std::uint32_t TextureCacheVersion = 1U;
+
+/** Identifies the source files and settings a texture cache file was generated from. */
+struct Texture_Cache_Header {
+	char magic[4];
+	std::uint32_t version;
+	std::uint32_t format;
+	std::uint32_t width;
+	std::uint32_t height;
+	std::uint32_t layers;
+	std::uint64_t sourceKey;
+	std::uint64_t payloadSize;
+	std::uint64_t checksum;
+};
+
+/** Compute a 64-bit FNV-1a hash of a block of memory, continuing from a previous hash. */
+inline std::uint64_t fnv_hash(const void* data, const size_t& size, std::uint64_t hash = 14695981039346656037ULL) noexcept
+{
+	const auto* bytes = static_cast<const unsigned char*>(data);
+	for (size_t x = 0ULL; x < size; ++x)
+		hash = (hash ^ bytes[x]) * 1099511628211ULL;
+	return hash;
+}
+
+/** Hash the names, sizes and write times of a texture's source files.
+@param	sourcePaths	the relative paths of the files the texture was generated from.
+@return				the combined hash. */
+inline std::uint64_t texture_source_key(const std::vector<std::string>& sourcePaths)
+{
+	auto hash = fnv_hash(nullptr, 0ULL);
+	for (const auto& relativePath : sourcePaths) {
+		// Missing files still contribute, as they are replaced by deterministic fill images
+		std::int64_t stats[2] = { -1, -1 };
+		std::error_code ec;
+		const std::filesystem::path sourcePath(Engine::Get_Current_Dir() + relativePath);
+		if (!relativePath.empty() && std::filesystem::is_regular_file(sourcePath, ec)) {
+			const auto fileSize = std::filesystem::file_size(sourcePath, ec);
+			const auto fileTime = std::filesystem::last_write_time(sourcePath, ec);
+			if (!ec) {
+				stats[0] = static_cast<std::int64_t>(fileSize);
+				stats[1] = static_cast<std::int64_t>(fileTime.time_since_epoch().count());
+			}
+		}
+		hash = fnv_hash(relativePath.data(), relativePath.size() + 1ULL, hash);
+		hash = fnv_hash(stats, sizeof(stats), hash);
+	}
+	return hash;
+}
+
+/** Generate the full path of the cache file for a texture.
+@param	cacheName	the name the texture is cached under.
+@return				the full path to the cache file. */
+inline std::string texture_cache_path(const std::string& cacheName)
+{
+	auto flatName = cacheName;
+	std::replace_if(flatName.begin(), flatName.end(), [](const char& ch) noexcept { return ch == '\\' || ch == '/' || ch == ':'; }, '_');
+	return Engine::Get_Current_Dir() + "\\Cache\\Textures\\" + flatName + ".tcache";
 }
 
 FIBITMAP* Image_IO::Import_Bitmap(Engine& engine, const std::string& relativePath)
@@ -25,18 +115,20 @@ FIBITMAP* Image_IO::Import_Bitmap(Engine& engine, const std::string& relativePat
 
 		auto& messageManager = engine.getManager_Messages();
 		if (format == -1)
-			messageManager.error("The file \"" + relativePath + "\" does not exist.");
+			messageManager.error("The file \"" + relativePath + "\" does not exist.", Message_Category::ASSETS);
 		else if (format == FIF_UNKNOWN) {
-			messageManager.error("The file \"" + relativePath + "\" exists, but is corrupted. Attempting to recover...");
+			messageManager.error("The file \"" + relativePath + "\" exists, but is corrupted. Attempting to recover...", Message_Category::ASSETS);
 			format = FreeImage_GetFIFFromFilename(file);
 			if (FreeImage_FIFSupportsReading(format) == 0)
-				messageManager.warning("Failed to recover the file \"" + relativePath + ".");
+				messageManager.warning("Failed to recover the file \"" + relativePath + ".", Message_Category::ASSETS);
 		}
 		else if (format == FIF_GIF)
-			messageManager.warning("GIF loading unsupported!");
+			messageManager.warning("GIF loading unsupported!", Message_Category::ASSETS);
 		else {
 			bitmap = FreeImage_Load(format, file);
-			if (FreeImage_GetBPP(bitmap) != 32) {
+			// 24 and 32-bit images are expanded while loading their pixels, anything else is converted here
+			const auto bpp = FreeImage_GetBPP(bitmap);
+			if (bitmap != nullptr && (FreeImage_GetImageType(bitmap) != FIT_BITMAP || (bpp != 24 && bpp != 32))) {
 				FIBITMAP* temp = FreeImage_ConvertTo32Bits(bitmap);
 				FreeImage_Unload(bitmap);
 				bitmap = temp;
@@ -72,22 +164,24 @@ bool Image_IO::Import_Image(Engine& engine, const std::string& relativePath, Ima
 void Image_IO::Load_Pixel_Data(FIBITMAP* bitmap, Image_Data& importedData)
 {
 	const glm::ivec2 dimensions(FreeImage_GetWidth(bitmap), FreeImage_GetHeight(bitmap));
-	const size_t size_mult = static_cast<size_t>(dimensions.x) * static_cast<size_t>(dimensions.y);
-
-	// Always create RGBA format
-	importedData.pixelData.resize(size_mult * 4ULL);
+	const auto width = static_cast<size_t>(dimensions.x), height = static_cast<size_t>(dimensions.y);
+	const auto bpp = FreeImage_GetBPP(bitmap);
+	const auto sourcePitch = static_cast<size_t>(FreeImage_GetPitch(bitmap));
 	const GLubyte* pixels = static_cast<GLubyte*>(FreeImage_GetBits(bitmap));
 
-	for (size_t i = 0; i < size_mult; ++i) {
-		importedData.pixelData[i * 4 + 2] = pixels[i * 4 + 0];
-		importedData.pixelData[i * 4 + 1] = pixels[i * 4 + 1];
-		importedData.pixelData[i * 4 + 0] = pixels[i * 4 + 2];
-		importedData.pixelData[i * 4 + 3] = pixels[i * 4 + 3];
+	// Always create tightly packed RGBA format, row by row as FreeImage pads rows
+	importedData.pixelData.resize(width * height * 4ULL);
+	for (size_t y = 0ULL; y < height; ++y) {
+		auto* row = &importedData.pixelData[y * width * 4ULL];
+		if (bpp == 24U)
+			Image_Kernels::Expand_Row(pixels + y * sourcePitch, row, width);
+		else
+			Image_Kernels::Swizzle_Row(pixels + y * sourcePitch, row, width);
 	}
 
 	importedData.dimensions = dimensions;
-	importedData.pitch = static_cast<int>(FreeImage_GetPitch(bitmap));
-	importedData.bpp = FreeImage_GetBPP(bitmap);
+	importedData.pitch = dimensions.x * 4;
+	importedData.bpp = 32U;
 }
 
 void Image_IO::Resize_Image(const glm::ivec2 newSize, Image_Data& importedData, const Resize_Policy& resizePolicy)
@@ -96,21 +190,104 @@ void Image_IO::Resize_Image(const glm::ivec2 newSize, Image_Data& importedData,
 	if ((newSize.x != 0) && (newSize.y != 0) && (importedData.dimensions.x != 0) && (importedData.dimensions.y != 0))
 		// Proceed if dimensions aren't the same
 		if (newSize != importedData.dimensions) {
-			// Create FreeImage bitmap from data provided
-			auto BGRA_Pixels = RGBA_to_BGRA(&importedData.pixelData[0], importedData.dimensions.x * importedData.dimensions.y);
-			importedData.pixelData.clear();
-			FIBITMAP* bitmap = FreeImage_ConvertFromRawBits(BGRA_Pixels.data(), importedData.dimensions.x, importedData.dimensions.y, importedData.pitch, importedData.bpp, 0, 0, 0);
-			BGRA_Pixels.clear();
-			BGRA_Pixels.shrink_to_fit();
-
-			// Resize the bitmap
-			FIBITMAP* newBitmap = FreeImage_Rescale(bitmap, newSize.x, newSize.y, resizePolicy == Resize_Policy::LINEAR ? FREE_IMAGE_FILTER::FILTER_CATMULLROM : FREE_IMAGE_FILTER::FILTER_BOX);
-			Load_Pixel_Data(newBitmap, importedData);
-
-			// Free Resources
-			FreeImage_Unload(newBitmap);
-			FreeImage_Unload(bitmap);
+			// Resample straight from the RGBA data, without converting to and from a FreeImage bitmap
+			std::vector<GLubyte> newPixels(static_cast<size_t>(newSize.x) * static_cast<size_t>(newSize.y) * 4ULL);
+			Image_Kernels::Resample(importedData.pixelData.data(), importedData.dimensions, newPixels.data(), newSize, resizePolicy);
+			importedData.pixelData = std::move(newPixels);
+			importedData.dimensions = newSize;
+			importedData.pitch = newSize.x * 4;
+			importedData.bpp = 32U;
+		}
+}
+
+size_t Image_IO::Get_Image_Size(const glm::ivec2& dimensions, const Texture_Format& format) noexcept
+{
+	if (format == Texture_Format::RGBA8)
+		return static_cast<size_t>(dimensions.x) * static_cast<size_t>(dimensions.y) * 4ULL;
+	return static_cast<size_t>((dimensions.x + 3) / 4) * static_cast<size_t>((dimensions.y + 3) / 4) * Block_Compression::Get_Block_Size(format);
+}
+
+void Image_IO::Generate_Mipmaps(Texture_Data& textureData, const Texture_Format& format)
+{
+	// Split the top level into its layers
+	const auto layerSize = Get_Image_Size(textureData.dimensions, Texture_Format::RGBA8);
+	std::vector<Image_Data> layers(textureData.layers);
+	for (size_t l = 0ULL; l < layers.size(); ++l) {
+		const auto* layerStart = textureData.pixelData.data() + l * layerSize;
+		layers[l] = Image_Data{ std::vector<GLubyte>(layerStart, layerStart + layerSize), textureData.dimensions, textureData.dimensions.x * 4, 32U };
+	}
+
+	// Box filter each level from the one above it, compressing as we go
+	textureData.format = format;
+	std::vector<GLubyte> chain(layout_mips(textureData));
+	const auto sizes = mip_sizes(textureData.dimensions);
+	for (size_t m = 0ULL; m < sizes.size(); ++m) {
+		auto* levelStart = chain.data() + textureData.mipOffsets[m];
+		const auto levelLayerSize = Get_Image_Size(sizes[m], format);
+		for (size_t l = 0ULL; l < layers.size(); ++l) {
+			if (m > 0ULL)
+				Resize_Image(sizes[m], layers[l], Resize_Policy::NEAREST);
+			if (format == Texture_Format::RGBA8)
+				std::copy(layers[l].pixelData.cbegin(), layers[l].pixelData.cend(), levelStart + l * levelLayerSize);
+			else {
+				const auto blocks = Block_Compression::Compress_Image(layers[l].pixelData.data(), sizes[m], format);
+				std::copy(blocks.cbegin(), blocks.cend(), levelStart + l * levelLayerSize);
+			}
 		}
+	}
+	textureData.pixelData = std::move(chain);
+}
+
+bool Image_IO::Import_Texture_Cache(const std::string& cacheName, const std::vector<std::string>& sourcePaths, Texture_Data& textureData)
+{
+	Mapped_File file(texture_cache_path(cacheName));
+	if (!file.isOpen() || file.size() < sizeof(Texture_Cache_Header))
+		return false;
+
+	// Reject caches generated from different files or settings, or that fail their checksum
+	Texture_Cache_Header header{};
+	std::memcpy(&header, file.data(), sizeof(Texture_Cache_Header));
+	Texture_Data cachedData{ {}, {}, textureData.dimensions, textureData.layers, textureData.format };
+	const auto payloadSize = layout_mips(cachedData);
+	const auto* payload = file.data() + sizeof(Texture_Cache_Header);
+	if (std::memcmp(header.magic, TextureCacheMagic, sizeof(TextureCacheMagic)) != 0 ||
+		header.version != TextureCacheVersion ||
+		header.format != static_cast<std::uint32_t>(textureData.format) ||
+		header.width != static_cast<std::uint32_t>(textureData.dimensions.x) ||
+		header.height != static_cast<std::uint32_t>(textureData.dimensions.y) ||
+		header.layers != textureData.layers ||
+		header.payloadSize != payloadSize ||
+		file.size() - sizeof(Texture_Cache_Header) != payloadSize ||
+		header.sourceKey != texture_source_key(sourcePaths) ||
+		header.checksum != fnv_hash(payload, payloadSize))
+		return false;
+
+	cachedData.pixelData.assign(payload, payload + payloadSize);
+	textureData = std::move(cachedData);
+	return true;
+}
+
+bool Image_IO::Export_Texture_Cache(const std::string& cacheName, const std::vector<std::string>& sourcePaths, const Texture_Data& textureData)
+{
+	Texture_Cache_Header header{};
+	std::memcpy(header.magic, TextureCacheMagic, sizeof(TextureCacheMagic));
+	header.version = TextureCacheVersion;
+	header.format = static_cast<std::uint32_t>(textureData.format);
+	header.width = static_cast<std::uint32_t>(textureData.dimensions.x);
+	header.height = static_cast<std::uint32_t>(textureData.dimensions.y);
+	header.layers = textureData.layers;
+	header.sourceKey = texture_source_key(sourcePaths);
+	header.payloadSize = static_cast<std::uint64_t>(textureData.pixelData.size());
+	header.checksum = fnv_hash(textureData.pixelData.data(), textureData.pixelData.size());
+
+	// Write atomically, so other readers never see a partial cache, even after a crash or power loss
+	std::vector<char> fileData(sizeof(Texture_Cache_Header));
+	std::memcpy(fileData.data(), &header, sizeof(Texture_Cache_Header));
+	fileData.insert(fileData.end(), textureData.pixelData.cbegin(), textureData.pixelData.cend());
+	std::error_code ec;
+	const std::filesystem::path path(texture_cache_path(cacheName));
+	std::filesystem::create_directories(path.parent_path(), ec);
+	return Atomic_File::Write(path.string(), fileData);
 }
 
 std::string Image_IO::Get_Version()
@@ -32,6 +32,23 @@ enum class Resize_Policy {
 	LINEAR,
 };
 
+/** Pixel formats a texture can be stored in. */
+enum class Texture_Format {
+	RGBA8,
+	BC1,	// Opaque RGB, 8 bytes per 4x4 block
+	BC3,	// RGBA, 16 bytes per 4x4 block
+	BC5,	// Two channel RG, 16 bytes per 4x4 block
+};
+
+/** Container defining a stack of equally sized image layers and their mip chain. */
+struct Texture_Data {
+	std::vector<GLubyte> pixelData;
+	std::vector<size_t> mipOffsets;
+	glm::ivec2 dimensions = glm::ivec2(0);
+	unsigned int layers = 0;
+	Texture_Format format = Texture_Format::RGBA8;
+};
+
 /** A static helper class used for reading/writing images.
 Uses the FreeImage texture importer: http://freeimage.sourceforge.net/ */
 class Image_IO {
@@ -56,6 +73,27 @@ public:
 	@param	importedData	the container holding the image data (gets updated with new data).
 	@param	resizePolicy	the resize policy to use, such as nearest neighbor or linear interpolation. */
 	static void Resize_Image(const glm::ivec2 newSize, Image_Data& importedData, const Resize_Policy& resizePolicy = Resize_Policy::LINEAR);
+	/** Retrieve the number of bytes a single image takes up in a given format.
+	@param	dimensions		the image size.
+	@param	format			the format the image uses.
+	@return					the image size in bytes. */
+	static size_t Get_Image_Size(const glm::ivec2& dimensions, const Texture_Format& format) noexcept;
+	/** Generate a full mip chain for a stack of RGBA image layers, optionally block compressing it.
+	@param	textureData		the container holding the top level RGBA layers (gets updated with the full chain).
+	@param	format			the format to store the chain in. */
+	static void Generate_Mipmaps(Texture_Data& textureData, const Texture_Format& format);
+	/** Read a texture from the texture cache, if its cached copy was generated from the same source files and settings.
+	@param	cacheName		the name to cache the texture under.
+	@param	sourcePaths		the paths of the files the texture was generated from.
+	@param	textureData		the container holding the desired dimensions, layer count and format (gets filled with the cached data).
+	@return					true on a cache hit, false if missing, stale or corrupt. */
+	static bool Import_Texture_Cache(const std::string& cacheName, const std::vector<std::string>& sourcePaths, Texture_Data& textureData);
+	/** Write a texture to the texture cache, keyed by the files it was generated from.
+	@param	cacheName		the name to cache the texture under.
+	@param	sourcePaths		the paths of the files the texture was generated from.
+	@param	textureData		the texture and its full mip chain.
+	@return					true if the cache file was written, false otherwise. */
+	static bool Export_Texture_Cache(const std::string& cacheName, const std::vector<std::string>& sourcePaths, const Texture_Data& textureData);
 	/** Retrieve the plugin version.
 	@return					the plugin version. */
 	static std::string Get_Version();
@@ -0,0 +1,245 @@
+#include "Utilities/IO/Image_Kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMAGE_KERNELS_SSE2
+#endif
+
+
+/** The source pixels and weights that make up a single resampled pixel. */
+struct Filter_Span {
+	size_t first = 0ULL, count = 0ULL, weightOffset = 0ULL;
+};
+
+/** Evaluate the resampling filter at a distance from a pixel's center.
+@param	distance		the distance in source pixels, already scaled by the filter's footprint.
+@param	resizePolicy	the resize policy choosing between a Catmull-Rom or box filter.
+@return					the filter weight. */
+inline static float Filter_Weight(const float& distance, const Resize_Policy& resizePolicy) noexcept
+{
+	const auto d = std::abs(distance);
+	if (resizePolicy == Resize_Policy::NEAREST)
+		return d <= 0.5F ? 1.0F : 0.0F;
+	if (d < 1.0F)
+		return (1.5F * d - 2.5F) * d * d + 1.0F;
+	if (d < 2.0F)
+		return ((-0.5F * d + 2.5F) * d - 4.0F) * d + 2.0F;
+	return 0.0F;
+}
+
+/** Precompute which source pixels, and with what weights, contribute to each pixel along one axis.
+@param	sourceSize		the number of source pixels along the axis.
+@param	newSize			the number of resampled pixels along the axis.
+@param	resizePolicy	the resize policy choosing between a Catmull-Rom or box filter.
+@param	spans			the span of each resampled pixel.
+@param	weights			the normalized weights referenced by the spans. */
+static void Build_Filter(const size_t& sourceSize, const size_t& newSize, const Resize_Policy& resizePolicy, std::vector<Filter_Span>& spans, std::vector<float>& weights)
+{
+	// Widen the filter when shrinking, so that every source pixel contributes
+	const auto scale = static_cast<float>(newSize) / static_cast<float>(sourceSize);
+	const auto footprint = std::max(1.0F, 1.0F / scale);
+	const auto radius = (resizePolicy == Resize_Policy::NEAREST ? 0.5F : 2.0F) * footprint;
+	spans.resize(newSize);
+	weights.clear();
+	for (size_t x = 0ULL; x < newSize; ++x) {
+		const auto center = (static_cast<float>(x) + 0.5F) / scale;
+		const auto first = static_cast<size_t>(std::max(0.0F, std::floor(center - radius)));
+		const auto last = std::min<size_t>(sourceSize - 1ULL, static_cast<size_t>(std::max(0.0F, std::ceil(center + radius))));
+		auto& span = spans[x];
+		span.first = first;
+		span.weightOffset = weights.size();
+		float total = 0.0F;
+		for (size_t s = first; s <= last; ++s) {
+			const auto weight = Filter_Weight((static_cast<float>(s) + 0.5F - center) / footprint, resizePolicy);
+			weights.push_back(weight);
+			total += weight;
+		}
+		span.count = weights.size() - span.weightOffset;
+
+		// Normalize, falling back to the nearest pixel if nothing overlapped
+		if (std::abs(total) > 0.0F)
+			for (size_t w = span.weightOffset; w < weights.size(); ++w)
+				weights[w] /= total;
+		else {
+			weights.resize(span.weightOffset + 1ULL);
+			span.first = std::min<size_t>(sourceSize - 1ULL, static_cast<size_t>(center));
+			span.count = 1ULL;
+			weights.back() = 1.0F;
+		}
+	}
+}
+
+bool Image_Kernels::Has_Path(const Kernel_Path& path) noexcept
+{
+	switch (path) {
+	case Kernel_Path::SCALAR:
+		return true;
+#if defined(IMAGE_KERNELS_SSE2)
+	case Kernel_Path::SSE2:
+		return true;
+#endif
+#if defined(__AVX2__)
+	case Kernel_Path::AVX2:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+Kernel_Path Image_Kernels::Best_Path() noexcept
+{
+#if defined(__AVX2__)
+	return Kernel_Path::AVX2;
+#elif defined(IMAGE_KERNELS_SSE2)
+	return Kernel_Path::SSE2;
+#else
+	return Kernel_Path::SCALAR;
+#endif
+}
+
+void Image_Kernels::Swizzle_Row(const GLubyte* source, GLubyte* destination, const size_t& count, [[maybe_unused]] const Kernel_Path& path) noexcept
+{
+	size_t x = 0ULL;
+#if defined(__AVX2__)
+	if (path == Kernel_Path::AVX2) {
+		const auto shuffle = _mm256_setr_epi8(
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+		for (; x + 8ULL <= count; x += 8ULL) {
+			const auto pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + x * 4ULL));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + x * 4ULL), _mm256_shuffle_epi8(pixels, shuffle));
+		}
+	}
+#endif
+#if defined(IMAGE_KERNELS_SSE2)
+	if (path != Kernel_Path::SCALAR) {
+		// Keep green and alpha in place, and shift red and blue past each other
+		const auto greenAlpha = _mm_set1_epi32(static_cast<int>(0xFF00FF00U));
+		const auto low = _mm_set1_epi32(0x000000FF);
+		for (; x + 4ULL <= count; x += 4ULL) {
+			const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + x * 4ULL));
+			const auto redBlue = _mm_or_si128(
+				_mm_and_si128(_mm_srli_epi32(pixels, 16), low),
+				_mm_slli_epi32(_mm_and_si128(pixels, low), 16));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x * 4ULL), _mm_or_si128(_mm_and_si128(pixels, greenAlpha), redBlue));
+		}
+	}
+#endif
+	for (; x < count; ++x) {
+		const GLubyte blue = source[x * 4ULL + 0ULL];
+		destination[x * 4ULL + 0ULL] = source[x * 4ULL + 2ULL];
+		destination[x * 4ULL + 1ULL] = source[x * 4ULL + 1ULL];
+		destination[x * 4ULL + 2ULL] = blue;
+		destination[x * 4ULL + 3ULL] = source[x * 4ULL + 3ULL];
+	}
+}
+
+void Image_Kernels::Expand_Row(const GLubyte* source, GLubyte* destination, const size_t& count, [[maybe_unused]] const Kernel_Path& path) noexcept
+{
+	size_t x = 0ULL;
+#if defined(__AVX2__)
+	// SSE2 alone has no byte shuffle, so only the AVX2 path is vectorized
+	// Each load reads 16 bytes but only consumes 12, so stop while a full load still fits
+	if (path == Kernel_Path::AVX2) {
+		const auto shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+		const auto alpha = _mm_set1_epi32(static_cast<int>(0xFF000000U));
+		for (; x + 6ULL <= count; x += 4ULL) {
+			const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + x * 3ULL));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x * 4ULL), _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), alpha));
+		}
+	}
+#endif
+	for (; x < count; ++x) {
+		destination[x * 4ULL + 0ULL] = source[x * 3ULL + 2ULL];
+		destination[x * 4ULL + 1ULL] = source[x * 3ULL + 1ULL];
+		destination[x * 4ULL + 2ULL] = source[x * 3ULL + 0ULL];
+		destination[x * 4ULL + 3ULL] = 255U;
+	}
+}
+
+void Image_Kernels::Resample(const GLubyte* source, const glm::ivec2& sourceSize, GLubyte* destination, const glm::ivec2& newSize, const Resize_Policy& resizePolicy, [[maybe_unused]] const Kernel_Path& path)
+{
+	const auto sourceWidth = static_cast<size_t>(sourceSize.x), sourceHeight = static_cast<size_t>(sourceSize.y);
+	const auto newWidth = static_cast<size_t>(newSize.x), newHeight = static_cast<size_t>(newSize.y);
+	std::vector<Filter_Span> columnSpans, rowSpans;
+	std::vector<float> columnWeights, rowWeights;
+	Build_Filter(sourceWidth, newWidth, resizePolicy, columnSpans, columnWeights);
+	Build_Filter(sourceHeight, newHeight, resizePolicy, rowSpans, rowWeights);
+#if defined(IMAGE_KERNELS_SSE2)
+	// Both passes only need SSE2, so the AVX2 path uses it too
+	const bool simd = path != Kernel_Path::SCALAR;
+#endif
+
+	// Horizontal pass, into floating point rows so the vertical pass doesn't lose precision
+	// Every path multiplies then adds in the same order, so they round identically
+	std::vector<float> rows(newWidth * sourceHeight * 4ULL);
+	for (size_t y = 0ULL; y < sourceHeight; ++y) {
+		const auto* sourceRow = source + y * sourceWidth * 4ULL;
+		auto* row = rows.data() + y * newWidth * 4ULL;
+		for (size_t x = 0ULL; x < newWidth; ++x) {
+			const auto& span = columnSpans[x];
+			const auto* weight = columnWeights.data() + span.weightOffset;
+			const auto* pixel = sourceRow + span.first * 4ULL;
+#if defined(IMAGE_KERNELS_SSE2)
+			if (simd) {
+				const auto zero = _mm_setzero_si128();
+				auto sum = _mm_setzero_ps();
+				for (size_t s = 0ULL; s < span.count; ++s, pixel += 4ULL) {
+					int texel;
+					std::memcpy(&texel, pixel, sizeof(int));
+					const auto channels = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(texel), zero), zero));
+					sum = _mm_add_ps(sum, _mm_mul_ps(channels, _mm_set1_ps(weight[s])));
+				}
+				_mm_storeu_ps(row + x * 4ULL, sum);
+				continue;
+			}
+#endif
+			float sum[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+			for (size_t s = 0ULL; s < span.count; ++s, pixel += 4ULL)
+				for (size_t c = 0ULL; c < 4ULL; ++c)
+					sum[c] += static_cast<float>(pixel[c]) * weight[s];
+			std::copy(sum, sum + 4, row + x * 4ULL);
+		}
+	}
+
+	// Vertical pass, weighting whole rows at a time then rounding back to bytes
+	const auto rowLength = newWidth * 4ULL;
+	std::vector<float> sum(rowLength);
+	for (size_t y = 0ULL; y < newHeight; ++y) {
+		const auto& span = rowSpans[y];
+		const auto* weight = rowWeights.data() + span.weightOffset;
+		std::fill(sum.begin(), sum.end(), 0.0F);
+		for (size_t s = 0ULL; s < span.count; ++s) {
+			const auto* row = rows.data() + (span.first + s) * rowLength;
+			size_t x = 0ULL;
+#if defined(IMAGE_KERNELS_SSE2)
+			if (simd) {
+				const auto rowWeight = _mm_set1_ps(weight[s]);
+				for (; x < rowLength; x += 4ULL)
+					_mm_storeu_ps(sum.data() + x, _mm_add_ps(_mm_loadu_ps(sum.data() + x), _mm_mul_ps(_mm_loadu_ps(row + x), rowWeight)));
+			}
+#endif
+			for (; x < rowLength; ++x)
+				sum[x] += row[x] * weight[s];
+		}
+		auto* destinationRow = destination + y * rowLength;
+		size_t x = 0ULL;
+#if defined(IMAGE_KERNELS_SSE2)
+		// Saturating packs clamp Catmull-Rom's overshoot to [0, 255], rounding to nearest even like std::nearbyint
+		if (simd)
+			for (; x + 16ULL <= rowLength; x += 16ULL) {
+				const auto low = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(sum.data() + x)), _mm_cvtps_epi32(_mm_loadu_ps(sum.data() + x + 4ULL)));
+				const auto high = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(sum.data() + x + 8ULL)), _mm_cvtps_epi32(_mm_loadu_ps(sum.data() + x + 12ULL)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destinationRow + x), _mm_packus_epi16(low, high));
+			}
+#endif
+		for (; x < rowLength; ++x)
+			destinationRow[x] = static_cast<GLubyte>(std::clamp(std::nearbyint(sum[x]), 0.0F, 255.0F));
+	}
+}
\ No newline at end of file
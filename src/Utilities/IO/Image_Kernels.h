@@ -0,0 +1,50 @@
+#pragma once
+#ifndef	IMAGE_KERNELS_H
+#define	IMAGE_KERNELS_H
+
+#include "Utilities/IO/Image_IO.h"
+
+
+/** Instruction sets the pixel kernels can be run with. */
+enum class Kernel_Path {
+	SCALAR,
+	SSE2,
+	AVX2,
+};
+
+/** A static helper class converting and resampling tightly packed pixels, used while importing images.
+Each kernel has SIMD paths for the instruction sets compiled in, which produce exactly the same pixels as the scalar path.
+Requesting a path that wasn't compiled in falls back to the fastest one that was, below it. */
+class Image_Kernels {
+public:
+	// Public Methods
+	/** Retrieve whether a path was compiled in, rather than falling back to a slower one.
+	@param	path			the path to check.
+	@return					true if the path is available, false otherwise. */
+	static bool Has_Path(const Kernel_Path& path) noexcept;
+	/** Retrieve the fastest path compiled in.
+	@return					the fastest available path. */
+	static Kernel_Path Best_Path() noexcept;
+	/** Swap the red and blue channels of a row of 32-bit pixels, converting between BGRA and RGBA.
+	@param	source			the pixels to read from.
+	@param	destination		the pixels to write to, which may be the source.
+	@param	count			the number of pixels to convert.
+	@param	path			the instruction set to use. */
+	static void Swizzle_Row(const GLubyte* source, GLubyte* destination, const size_t& count, const Kernel_Path& path = Best_Path()) noexcept;
+	/** Expand a row of 24-bit BGR pixels into opaque 32-bit RGBA pixels.
+	@param	source			the pixels to read from.
+	@param	destination		the pixels to write to.
+	@param	count			the number of pixels to convert.
+	@param	path			the instruction set to use. */
+	static void Expand_Row(const GLubyte* source, GLubyte* destination, const size_t& count, const Kernel_Path& path = Best_Path()) noexcept;
+	/** Resample a tightly packed RGBA image with a separable filter, first along rows then along columns.
+	@param	source			the pixels to read from.
+	@param	sourceSize		the dimensions of the source image.
+	@param	destination		the pixels to write to.
+	@param	newSize			the dimensions of the resampled image.
+	@param	resizePolicy	the resize policy choosing between a Catmull-Rom or box filter.
+	@param	path			the instruction set to use. */
+	static void Resample(const GLubyte* source, const glm::ivec2& sourceSize, GLubyte* destination, const glm::ivec2& newSize, const Resize_Policy& resizePolicy, const Kernel_Path& path = Best_Path());
+};
+
+#endif // IMAGE_KERNELS_H
\ No newline at end of file
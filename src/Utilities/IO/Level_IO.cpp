@@ -1,16 +1,168 @@
 #include "Utilities/IO/Level_IO.h"
+#include "Utilities/IO/Atomic_File.h"
+#include "Utilities/IO/Mapped_File.h"
+#include "Utilities/IO/Serializer.h"
 #include "Engine.h"
+#include <cstdint>
 #include <filesystem>
-#include <fstream>
+#include <map>
+#include <string_view>
 
 
 constexpr auto LevelPrefix = "\\Maps\\";
 
+/* VERSIONED LEVEL DATA STRUCTURE {
+	header
+	string table		(offset and size of every string)
+	schema table		(one per component type)
+	field table			(the fields of every schema)
+	entity table		(parents before their children)
+	component table		(schema and record offset of every component)
+	string data			(null-terminated)
+	record data			(one fixed-layout record per component)
+}
+All offsets are relative to the start of the data, and all tables and records are 8-byte aligned. */
+constexpr char BMapMagic[4] = { 'R', 'B', 'M', 'P' };
+constexpr std::uint32_t BMapVersion = 1U;
+constexpr std::uint32_t BMapVariableField = 1U;
+constexpr size_t LegacyHeaderSize = sizeof(int) + 32ULL + sizeof(int);
+
+/** The header at the start of versioned level data. */
+struct BMap_Header {
+	char m_magic[4];
+	std::uint32_t m_version;
+	std::uint32_t m_stringCount, m_schemaCount, m_fieldCount, m_entityCount, m_componentCount, m_reserved;
+	std::uint64_t m_stringOffset, m_schemaOffset, m_fieldOffset, m_entityOffset, m_componentOffset, m_dataSize;
+};
+/** A string's location. */
+struct BMap_String {
+	std::uint64_t m_offset, m_size;
+};
+/** A component type, and the layout of its records. */
+struct BMap_Schema {
+	std::uint32_t m_name, m_firstField, m_fieldCount, m_recordSize;
+};
+/** A single labeled value within a record. */
+struct BMap_Field {
+	std::uint32_t m_name, m_offset, m_size, m_flags;
+};
+/** An entity, its parent entity index (-1 if none), and its range of components. */
+struct BMap_Entity {
+	std::uint32_t m_name;
+	std::int32_t m_parent;
+	std::uint32_t m_firstComponent, m_componentCount;
+};
+/** A component, its schema, and the location of its record. */
+struct BMap_Component {
+	std::uint32_t m_schema, m_reserved;
+	std::uint64_t m_record;
+};
+
 inline static auto Get_Full_Path(const std::string& relativePath)
 {
 	return Engine::Get_Current_Dir() + LevelPrefix + relativePath;
 }
 
+/** Retrieve whether a file exists but holds no data, which can't be mapped into memory.
+@param	fullPath			the absolute path to the file.
+@return						true if the file is empty, false otherwise. */
+inline static bool Is_Empty_File(const std::string& fullPath)
+{
+	std::error_code errorCode;
+	return std::filesystem::file_size(fullPath, errorCode) == 0ULL && !errorCode;
+}
+
+inline static bool Is_Versioned(const char* data, const size_t& size)
+{
+	return size >= sizeof(BMap_Header) && std::memcmp(data, BMapMagic, sizeof(BMapMagic)) == 0;
+}
+
+inline static size_t Align(const size_t& value, const size_t& alignment = 8ULL)
+{
+	return (value + alignment - 1ULL) & ~(alignment - 1ULL);
+}
+
+template <typename T>
+inline static bool Read_Value(const char* data, const size_t& size, size_t& index, T& value)
+{
+	if (index + sizeof(T) > size)
+		return false;
+	std::memcpy(&value, &data[index], sizeof(T));
+	index += sizeof(T);
+	return true;
+}
+
+template <typename T>
+inline static bool Table_Fits(const size_t& size, const std::uint64_t& offset, const std::uint32_t& count)
+{
+	return offset % 8ULL == 0ULL && offset <= size && (size - offset) / sizeof(T) >= count;
+}
+
+/** A component from the older format, viewing its labeled values in-place. */
+struct Legacy_Component {
+	std::string_view m_type;
+	std::vector<std::pair<std::string_view, std::string_view>> m_fields;
+};
+
+/** An entity from the older format. */
+struct Legacy_Entity {
+	std::string_view m_name;
+	int m_parent = -1;
+	size_t m_firstComponent = 0ULL, m_componentCount = 0ULL;
+};
+
+static bool Parse_Legacy_Entity(const char* data, const size_t& size, size_t& index, const int& parent, std::vector<Legacy_Entity>& entities, std::vector<Legacy_Component>& components)
+{
+	// See ecsWorld::serializeEntity() for the structure
+	unsigned int nameSize(0U), childCount(0U);
+	size_t componentDataCount(0ULL);
+	if (!Read_Value(data, size, index, nameSize) || index + nameSize > size)
+		return false;
+	const std::string_view name(&data[index], nameSize);
+	index += nameSize;
+	if (!Read_Value(data, size, index, componentDataCount) || !Read_Value(data, size, index, childCount) || componentDataCount > size - index)
+		return false;
+
+	const auto entityIndex = static_cast<int>(entities.size());
+	entities.push_back({ name, parent, components.size(), 0ULL });
+	const auto endIndex = index + componentDataCount;
+	while (index < endIndex) {
+		// See ecsComponent::to_buffer() for the structure
+		int charCount(0);
+		size_t classDataSize(0ULL);
+		if (!Read_Value(data, endIndex, index, charCount) || charCount < 0 || index + charCount > endIndex)
+			return false;
+		Legacy_Component component{ std::string_view(&data[index], static_cast<size_t>(charCount)), {} };
+		index += charCount;
+		if (!Read_Value(data, endIndex, index, classDataSize) || classDataSize > endIndex - index)
+			return false;
+
+		// See Serializer::Serialize_Value() for the structure, the first of any duplicate labels wins
+		const auto classEnd = index + classDataSize;
+		for (size_t memberIndex = index; memberIndex + LegacyHeaderSize <= classEnd;) {
+			int structSize(0), payloadSize(0);
+			std::memcpy(&structSize, &data[memberIndex], sizeof(int));
+			std::memcpy(&payloadSize, &data[memberIndex + sizeof(int) + 32ULL], sizeof(int));
+			const auto* nameChars = &data[memberIndex + sizeof(int)];
+			const std::string_view memberName(nameChars, std::find(nameChars, nameChars + 32, '\0') - nameChars);
+			if (structSize <= 0 || memberName.empty() || memberIndex + structSize > classEnd)
+				break;
+			if (payloadSize >= 0 && LegacyHeaderSize + payloadSize <= static_cast<size_t>(structSize)
+				&& std::none_of(component.m_fields.cbegin(), component.m_fields.cend(), [&](const auto& field) { return field.first == memberName; }))
+				component.m_fields.emplace_back(memberName, std::string_view(&data[memberIndex + LegacyHeaderSize], static_cast<size_t>(payloadSize)));
+			memberIndex += structSize;
+		}
+		components.push_back(std::move(component));
+		index = classEnd;
+	}
+	entities[entityIndex].m_componentCount = components.size() - entities[entityIndex].m_firstComponent;
+
+	for (unsigned int child = 0U; child < childCount && index < size; ++child)
+		if (!Parse_Legacy_Entity(data, size, index, entityIndex, entities, components))
+			return false;
+	return true;
+}
+
 bool Level_IO::Level_Exists(const std::string& relativePath)
 {
 	return std::filesystem::exists(Get_Full_Path(relativePath));
@@ -18,31 +170,286 @@ bool Level_IO::Level_Exists(const std::string& relativePath)
 
 bool Level_IO::Import_BMap(const std::string& relativePath, ecsWorld& world)
 {
+	// An empty file is an empty level, rather than a file which failed to map
+	const auto fullPath = Get_Full_Path(relativePath);
+	if (Is_Empty_File(fullPath)) {
+		world = ecsWorld();
+		return true;
+	}
+
 	// Try to get file first
-	const auto path = Get_Full_Path(relativePath);
-	std::ifstream mapFile(path, std::ios::binary | std::ios::in | std::ios::beg);
-	if (!mapFile.is_open())
+	const Mapped_File mapFile(fullPath);
+	if (!mapFile.isOpen())
 		return false;
 
-	// Read ecsData from disk
-	std::vector<char> ecsData(std::filesystem::file_size(path));
-	mapFile.read(ecsData.data(), static_cast<std::streamsize>(ecsData.size()));
-	mapFile.close();
-	world = ecsWorld(ecsData);
+	// Construct straight from the mapped data, or fall back to the older format
+	if (Is_Versioned(mapFile.data(), mapFile.size()))
+		return Import_Level_Data(mapFile.data(), mapFile.size(), world);
+	world = ecsWorld(std::vector<char>(mapFile.data(), mapFile.data() + mapFile.size()));
 	return true;
 }
 
 bool Level_IO::Export_BMap(const std::string& relativePath, const ecsWorld& world)
 {
-	// Try to get file first
-	std::fstream mapFile(Get_Full_Path(relativePath), std::ios::binary | std::ios::out);
-	if (!mapFile.is_open())
+	EntityHandle rootHandle;
+	return Export_Entity_Data(relativePath, world.serializeEntities(world.getEntityHandles(rootHandle)));
+}
+
+bool Level_IO::Export_Entity_Data(const std::string& relativePath, const std::vector<char>& entityData)
+{
+	// Convert ECS data to the versioned format
+	std::vector<char> levelData;
+	if (!Convert_Entity_Data(entityData.data(), entityData.size(), levelData))
 		return false;
 
-	// Write ECS data to disk
-	EntityHandle rootHandle;
-	const auto data = world.serializeEntities(world.getEntityHandles(rootHandle));
-	mapFile.write(data.data(), static_cast<std::streamsize>(data.size()));
-	mapFile.close();
+	// Write level data to disk
+	return Atomic_File::Write(Get_Full_Path(relativePath), levelData);
+}
+
+bool Level_IO::Convert_BMap(const std::string& relativePath, const std::string& newRelativePath)
+{
+	std::vector<char> levelData;
+	const auto fullPath = Get_Full_Path(relativePath);
+	if (Is_Empty_File(fullPath)) {
+		if (!Convert_Entity_Data(nullptr, 0ULL, levelData))
+			return false;
+	}
+	else {
+		// Try to get file first, releasing it before any overwrite
+		const Mapped_File mapFile(fullPath);
+		if (!mapFile.isOpen() || Is_Versioned(mapFile.data(), mapFile.size()) || !Convert_Entity_Data(mapFile.data(), mapFile.size(), levelData))
+			return false;
+	}
+
+	// Write level data to disk, leaving the destination intact if anything fails
+	return Atomic_File::Write(Get_Full_Path(newRelativePath), levelData);
+}
+
+bool Level_IO::Convert_Entity_Data(const char* data, const size_t& size, std::vector<char>& levelData)
+{
+	// Parse every entity, viewing their data in-place
+	std::vector<Legacy_Entity> entities;
+	std::vector<Legacy_Component> components;
+	for (size_t index = 0ULL; index < size;)
+		if (!Parse_Legacy_Entity(data, size, index, -1, entities, components))
+			return false;
+
+	// Pool all the strings, de-duplicating them
+	std::vector<std::string_view> strings;
+	std::map<std::string_view, std::uint32_t> stringMap;
+	const auto Add_String = [&](const std::string_view& string) {
+		const auto [spot, inserted] = stringMap.try_emplace(string, static_cast<std::uint32_t>(strings.size()));
+		if (inserted)
+			strings.push_back(string);
+		return spot->second;
+	};
+
+	// Find each component type's fields, in order of first appearance
+	// Fields with a size that varies, or missing from any component, are stored in the string pool instead
+	struct Schema_Info {
+		std::vector<std::tuple<std::string_view, size_t, bool, size_t>> m_fields; // name, size, variable, count
+		size_t m_instances = 0ULL;
+	};
+	std::vector<Schema_Info> schemaInfo;
+	std::vector<BMap_Schema> schemas;
+	std::map<std::string_view, std::uint32_t> schemaMap;
+	std::vector<std::uint32_t> componentSchemas(components.size());
+	const auto componentCount = components.size();
+	for (size_t c = 0; c < componentCount; ++c) {
+		const auto& component = components[c];
+		const auto [spot, inserted] = schemaMap.try_emplace(component.m_type, static_cast<std::uint32_t>(schemas.size()));
+		if (inserted) {
+			schemas.push_back({ Add_String(component.m_type), 0U, 0U, 0U });
+			schemaInfo.emplace_back();
+		}
+		componentSchemas[c] = spot->second;
+		auto& info = schemaInfo[spot->second];
+		++info.m_instances;
+		for (const auto& [fieldName, fieldData] : component.m_fields) {
+			auto field = std::find_if(info.m_fields.begin(), info.m_fields.end(), [&](const auto& f) { return std::get<0>(f) == fieldName; });
+			if (field == info.m_fields.end())
+				info.m_fields.emplace_back(fieldName, fieldData.size(), info.m_instances > 1ULL, 1ULL);
+			else {
+				auto& [name, fieldSize, variable, count] = *field;
+				variable = variable || fieldSize != fieldData.size();
+				++count;
+			}
+		}
+	}
+
+	// Lay out each schema's record, aligning fields to their size
+	std::vector<BMap_Field> fields;
+	const auto schemaCount = schemas.size();
+	for (size_t s = 0; s < schemaCount; ++s) {
+		auto& schema = schemas[s];
+		schema.m_firstField = static_cast<std::uint32_t>(fields.size());
+		size_t recordSize(0ULL);
+		for (auto& [fieldName, fieldSize, variable, count] : schemaInfo[s].m_fields) {
+			variable = variable || count != schemaInfo[s].m_instances;
+			const auto slotSize = variable ? sizeof(std::uint32_t) : fieldSize;
+			const auto alignment = slotSize % 8ULL == 0ULL ? 8ULL : slotSize % 4ULL == 0ULL ? 4ULL : 1ULL;
+			recordSize = Align(recordSize, alignment);
+			fields.push_back({ Add_String(fieldName), static_cast<std::uint32_t>(recordSize), static_cast<std::uint32_t>(slotSize), variable ? BMapVariableField : 0U });
+			recordSize += slotSize;
+		}
+		schema.m_fieldCount = static_cast<std::uint32_t>(fields.size()) - schema.m_firstField;
+		schema.m_recordSize = static_cast<std::uint32_t>(Align(recordSize));
+	}
+
+	// Pool any remaining strings before sizing the tables
+	std::vector<BMap_Entity> entityTable;
+	entityTable.reserve(entities.size());
+	for (const auto& entity : entities)
+		entityTable.push_back({ Add_String(entity.m_name), entity.m_parent, static_cast<std::uint32_t>(entity.m_firstComponent), static_cast<std::uint32_t>(entity.m_componentCount) });
+	for (size_t c = 0; c < componentCount; ++c) {
+		const auto& schema = schemas[componentSchemas[c]];
+		for (auto f = schema.m_firstField; f < schema.m_firstField + schema.m_fieldCount; ++f)
+			if ((fields[f].m_flags & BMapVariableField) != 0U)
+				for (const auto& [fieldName, fieldData] : components[c].m_fields)
+					if (fieldName == strings[fields[f].m_name])
+						Add_String(fieldData);
+	}
+
+	// Find where each section lives
+	BMap_Header header{};
+	std::memcpy(header.m_magic, BMapMagic, sizeof(BMapMagic));
+	header.m_version = BMapVersion;
+	header.m_stringCount = static_cast<std::uint32_t>(strings.size());
+	header.m_schemaCount = static_cast<std::uint32_t>(schemas.size());
+	header.m_fieldCount = static_cast<std::uint32_t>(fields.size());
+	header.m_entityCount = static_cast<std::uint32_t>(entityTable.size());
+	header.m_componentCount = static_cast<std::uint32_t>(componentCount);
+	header.m_stringOffset = Align(sizeof(BMap_Header));
+	header.m_schemaOffset = Align(header.m_stringOffset + strings.size() * sizeof(BMap_String));
+	header.m_fieldOffset = Align(header.m_schemaOffset + schemas.size() * sizeof(BMap_Schema));
+	header.m_entityOffset = Align(header.m_fieldOffset + fields.size() * sizeof(BMap_Field));
+	header.m_componentOffset = Align(header.m_entityOffset + entityTable.size() * sizeof(BMap_Entity));
+	auto offset = Align(header.m_componentOffset + componentCount * sizeof(BMap_Component));
+	std::vector<BMap_String> stringTable;
+	stringTable.reserve(strings.size());
+	for (const auto& string : strings) {
+		stringTable.push_back({ offset, string.size() });
+		offset += string.size() + 1ULL;
+	}
+	offset = Align(offset);
+	std::vector<BMap_Component> componentTable;
+	componentTable.reserve(componentCount);
+	for (size_t c = 0; c < componentCount; ++c) {
+		componentTable.push_back({ componentSchemas[c], 0U, offset });
+		offset += schemas[componentSchemas[c]].m_recordSize;
+	}
+	header.m_dataSize = offset;
+
+	// Write every section
+	levelData.assign(static_cast<size_t>(header.m_dataSize), '\0');
+	auto* output = levelData.data();
+	std::memcpy(output, &header, sizeof(BMap_Header));
+	std::memcpy(&output[header.m_stringOffset], stringTable.data(), stringTable.size() * sizeof(BMap_String));
+	std::memcpy(&output[header.m_schemaOffset], schemas.data(), schemas.size() * sizeof(BMap_Schema));
+	std::memcpy(&output[header.m_fieldOffset], fields.data(), fields.size() * sizeof(BMap_Field));
+	std::memcpy(&output[header.m_entityOffset], entityTable.data(), entityTable.size() * sizeof(BMap_Entity));
+	std::memcpy(&output[header.m_componentOffset], componentTable.data(), componentTable.size() * sizeof(BMap_Component));
+	const auto stringCount = strings.size();
+	for (size_t x = 0; x < stringCount; ++x)
+		std::memcpy(&output[stringTable[x].m_offset], strings[x].data(), strings[x].size());
+	for (size_t c = 0; c < componentCount; ++c) {
+		const auto& schema = schemas[componentSchemas[c]];
+		auto* record = &output[componentTable[c].m_record];
+		for (auto f = schema.m_firstField; f < schema.m_firstField + schema.m_fieldCount; ++f) {
+			const auto& field = fields[f];
+			const auto& fieldName = strings[field.m_name];
+			const auto spot = std::find_if(components[c].m_fields.cbegin(), components[c].m_fields.cend(), [&](const auto& member) { return member.first == fieldName; });
+			if ((field.m_flags & BMapVariableField) != 0U) {
+				// Missing fields point past the end of the string table
+				const auto stringIndex = spot != components[c].m_fields.cend() ? stringMap.at(spot->second) : header.m_stringCount;
+				std::memcpy(&record[field.m_offset], &stringIndex, sizeof(std::uint32_t));
+			}
+			else
+				std::memcpy(&record[field.m_offset], spot->second.data(), field.m_size);
+		}
+	}
+	return true;
+}
+
+bool Level_IO::Import_Level_Data(const char* data, const size_t& size, ecsWorld& world)
+{
+	// Validate the header and every table before touching the world
+	if (!Is_Versioned(data, size))
+		return false;
+	BMap_Header header{};
+	std::memcpy(&header, data, sizeof(BMap_Header));
+	if (header.m_version != BMapVersion || header.m_dataSize > size
+		|| !Table_Fits<BMap_String>(size, header.m_stringOffset, header.m_stringCount)
+		|| !Table_Fits<BMap_Schema>(size, header.m_schemaOffset, header.m_schemaCount)
+		|| !Table_Fits<BMap_Field>(size, header.m_fieldOffset, header.m_fieldCount)
+		|| !Table_Fits<BMap_Entity>(size, header.m_entityOffset, header.m_entityCount)
+		|| !Table_Fits<BMap_Component>(size, header.m_componentOffset, header.m_componentCount))
+		return false;
+	const auto* stringTable = reinterpret_cast<const BMap_String*>(&data[header.m_stringOffset]);
+	const auto* schemaTable = reinterpret_cast<const BMap_Schema*>(&data[header.m_schemaOffset]);
+	const auto* fieldTable = reinterpret_cast<const BMap_Field*>(&data[header.m_fieldOffset]);
+	const auto* entityTable = reinterpret_cast<const BMap_Entity*>(&data[header.m_entityOffset]);
+	const auto* componentTable = reinterpret_cast<const BMap_Component*>(&data[header.m_componentOffset]);
+
+	// View every string in-place
+	std::vector<std::string_view> strings;
+	strings.reserve(header.m_stringCount);
+	for (std::uint32_t x = 0U; x < header.m_stringCount; ++x) {
+		const auto& string = stringTable[x];
+		if (string.m_offset > size || string.m_size >= size - string.m_offset || data[string.m_offset + string.m_size] != '\0')
+			return false;
+		strings.emplace_back(&data[string.m_offset], static_cast<size_t>(string.m_size));
+	}
+
+	// Describe each component type's record, and find its runtime ID once
+	std::vector<Serial_Schema> schemas(header.m_schemaCount);
+	std::vector<std::optional<ComponentID>> componentIDs(header.m_schemaCount);
+	for (std::uint32_t s = 0U; s < header.m_schemaCount; ++s) {
+		const auto& schema = schemaTable[s];
+		if (schema.m_name >= header.m_stringCount || schema.m_firstField > header.m_fieldCount || schema.m_fieldCount > header.m_fieldCount - schema.m_firstField)
+			return false;
+		schemas[s].m_strings = &strings;
+		for (auto f = schema.m_firstField; f < schema.m_firstField + schema.m_fieldCount; ++f) {
+			const auto& field = fieldTable[f];
+			const auto variable = (field.m_flags & BMapVariableField) != 0U;
+			if (field.m_name >= header.m_stringCount || static_cast<std::uint64_t>(field.m_offset) + field.m_size > schema.m_recordSize || (variable && field.m_size != sizeof(std::uint32_t)))
+				return false;
+			schemas[s].m_fields.push_back({ strings[field.m_name], field.m_offset, field.m_size, variable });
+		}
+		componentIDs[s] = ecsWorld::nameToComponentID(strings[schema.m_name].data());
+	}
+	for (std::uint32_t e = 0U; e < header.m_entityCount; ++e) {
+		const auto& entity = entityTable[e];
+		if (entity.m_name >= header.m_stringCount || entity.m_parent >= static_cast<std::int32_t>(e) || entity.m_firstComponent > header.m_componentCount || entity.m_componentCount > header.m_componentCount - entity.m_firstComponent)
+			return false;
+	}
+	for (std::uint32_t c = 0U; c < header.m_componentCount; ++c) {
+		const auto& component = componentTable[c];
+		if (component.m_schema >= header.m_schemaCount || component.m_record % 8ULL != 0ULL || component.m_record > size || schemaTable[component.m_schema].m_recordSize > size - component.m_record)
+			return false;
+	}
+
+	// Make every entity, parents first, constructing components straight from their records
+	ecsWorld newWorld;
+	newWorld.reserve(header.m_entityCount, header.m_componentCount);
+	std::vector<EntityHandle> entityHandles(header.m_entityCount);
+	std::vector<std::shared_ptr<ecsBaseComponent>> pointers;
+	std::vector<ecsBaseComponent*> components;
+	for (std::uint32_t e = 0U; e < header.m_entityCount; ++e) {
+		const auto& entity = entityTable[e];
+		pointers.clear();
+		components.clear();
+		for (auto c = entity.m_firstComponent; c < entity.m_firstComponent + entity.m_componentCount; ++c) {
+			const auto& component = componentTable[c];
+			if (const auto& componentID = componentIDs[component.m_schema])
+				if (auto clone = ecsBaseComponent::from_buffer(*componentID, Serial_Data{ &data[component.m_record], schemaTable[component.m_schema].m_recordSize, &schemas[component.m_schema] })) {
+					components.push_back(clone.get());
+					pointers.push_back(std::move(clone));
+				}
+		}
+		const auto parentHandle = entity.m_parent >= 0 ? entityHandles[entity.m_parent] : EntityHandle();
+		newWorld.makeEntity(components.data(), components.size(), std::string(strings[entity.m_name]), entityHandles[e], parentHandle);
+	}
+	world = std::move(newWorld);
 	return true;
 }
\ No newline at end of file
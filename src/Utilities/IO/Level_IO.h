@@ -4,6 +4,7 @@
 
 #include "Modules/ECS/ecsWorld.h"
 #include <string>
+#include <vector>
 
 
 /** A static helper class used for reading/writing levels. */
@@ -14,15 +15,40 @@ public:
 	@return						true if the level file exists, false otherwise. */
 	static bool Level_Exists(const std::string& relativePath);
 	/** Read a binary level map into the ecsWorld specified.
+	@note						accepts both the versioned format, which is memory-mapped, and the older un-versioned format.
 	@param	relativePath		the relative path to a level file.
 	@param	world				the ecsWorld to import into.
 	@return						true if the level is successfully imported, false otherwise. */
 	static bool Import_BMap(const std::string& relativePath, ecsWorld& world);
-	/** Write a binary level map using the ecsWorld specified.
+	/** Write a binary level map using the ecsWorld specified, in the versioned format.
 	@param	relativePath		the relative path to a level file.
 	@param	world				the ecsWorld to read from.
 	@return						true if the level is successfully exported, false otherwise. */
 	static bool Export_BMap(const std::string& relativePath, const ecsWorld& world);
+	/** Write a binary level map using serialized entity data, in the versioned format.
+	@note						safe to call from any thread, the file is written to a temporary first then swapped in, so a crash never leaves a partial level behind.
+	@param	relativePath		the relative path to a level file.
+	@param	entityData			the serialized entity data, as produced by ecsWorld::serializeEntities().
+	@return						true if the level is successfully exported, false otherwise. */
+	static bool Export_Entity_Data(const std::string& relativePath, const std::vector<char>& entityData);
+	/** Convert a level map from the older un-versioned format into the versioned format.
+	@note						the conversion works on the raw data, carrying over every entity and labeled value, even for unknown component types.
+	@param	relativePath		the relative path to the old level file.
+	@param	newRelativePath		the relative path to write the converted level file to, may match the old path.
+	@return						true if the level is successfully converted, false otherwise (including if already converted). */
+	static bool Convert_BMap(const std::string& relativePath, const std::string& newRelativePath);
+	/** Convert serialized entity data from the older un-versioned format into the versioned format.
+	@param	data				pointer to the serialized entity data, as produced by ecsWorld::serializeEntities().
+	@param	size				the byte-size of the data.
+	@param	levelData			reference updated with the converted level data.
+	@return						true if the data is successfully converted, false if malformed. */
+	static bool Convert_Entity_Data(const char* data, const size_t& size, std::vector<char>& levelData);
+	/** Read level data in the versioned format into the ecsWorld specified, constructing components straight from it.
+	@param	data				pointer to the level data.
+	@param	size				the byte-size of the level data.
+	@param	world				the ecsWorld to import into.
+	@return						true if the level is successfully imported, false if malformed or not in the versioned format. */
+	static bool Import_Level_Data(const char* data, const size_t& size, ecsWorld& world);
 };
 
 #endif // LEVEL_IO_H
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "Utilities/IO/Mapped_File.h"
+#include <utility>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+Mapped_File::~Mapped_File()
+{
+	close();
+}
+
+Mapped_File::Mapped_File(const std::string& fullPath)
+{
+	open(fullPath);
+}
+
+Mapped_File::Mapped_File(Mapped_File&& other) noexcept :
+	m_data(std::exchange(other.m_data, nullptr)),
+	m_size(std::exchange(other.m_size, 0ULL)),
+	m_fileHandle(std::exchange(other.m_fileHandle, nullptr)),
+	m_mappingHandle(std::exchange(other.m_mappingHandle, nullptr))
+{
+}
+
+Mapped_File& Mapped_File::operator=(Mapped_File&& other) noexcept
+{
+	if (this != &other) {
+		close();
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0ULL);
+		m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+		m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+	}
+	return *this;
+}
+
+bool Mapped_File::open(const std::string& fullPath)
+{
+	close();
+#ifdef _WIN32
+	const auto file = CreateFileA(fullPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+		CloseHandle(file);
+		return false;
+	}
+	const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		CloseHandle(file);
+		return false;
+	}
+	const auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+	m_fileHandle = file;
+	m_mappingHandle = mapping;
+	m_data = static_cast<const char*>(view);
+	m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+	const auto file = ::open(fullPath.c_str(), O_RDONLY);
+	if (file < 0)
+		return false;
+	struct stat fileStat {};
+	if (fstat(file, &fileStat) != 0 || fileStat.st_size <= 0) {
+		::close(file);
+		return false;
+	}
+	auto* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file);
+	if (view == MAP_FAILED)
+		return false;
+	m_data = static_cast<const char*>(view);
+	m_size = static_cast<size_t>(fileStat.st_size);
+#endif
+	return true;
+}
+
+void Mapped_File::close() noexcept
+{
+	if (m_data == nullptr)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(m_data);
+	CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+	CloseHandle(static_cast<HANDLE>(m_fileHandle));
+#else
+	munmap(const_cast<char*>(m_data), m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0ULL;
+	m_fileHandle = nullptr;
+	m_mappingHandle = nullptr;
+}
+
+bool Mapped_File::isOpen() const noexcept
+{
+	return m_data != nullptr;
+}
+
+const char* Mapped_File::data() const noexcept
+{
+	return m_data;
+}
+
+size_t Mapped_File::size() const noexcept
+{
+	return m_size;
+}
\ No newline at end of file
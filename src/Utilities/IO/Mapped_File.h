@@ -0,0 +1,58 @@
+#pragma once
+#ifndef	MAPPED_FILE_H
+#define	MAPPED_FILE_H
+
+#include <string>
+
+
+/** A read-only view of a file mapped into memory, unmapped when destroyed. */
+class Mapped_File {
+public:
+	// Public (De)Constructors
+	/** Unmap this file. */
+	~Mapped_File();
+	/** Construct an empty mapping. */
+	Mapped_File() noexcept = default;
+	/** Map a file into memory.
+	@param	fullPath		the absolute path to the file. */
+	explicit Mapped_File(const std::string& fullPath);
+	/** Move a mapping. */
+	Mapped_File(Mapped_File&& other) noexcept;
+	/** Move-assign a mapping. */
+	Mapped_File& operator=(Mapped_File&& other) noexcept;
+
+
+	// Public Methods
+	/** Map a file into memory, replacing any previous mapping.
+	@param	fullPath		the absolute path to the file.
+	@return					true if the file was mapped, false otherwise. */
+	bool open(const std::string& fullPath);
+	/** Unmap the file, if any. */
+	void close() noexcept;
+	/** Retrieve whether or not a file is currently mapped.
+	@return					true if mapped, false otherwise. */
+	bool isOpen() const noexcept;
+	/** Retrieve a pointer to the first byte of the file.
+	@return					pointer to the mapped bytes, nullptr if not mapped. */
+	const char* data() const noexcept;
+	/** Retrieve the byte-size of the file.
+	@return					the number of mapped bytes. */
+	size_t size() const noexcept;
+
+
+private:
+	// Private and deleted
+	/** Disallow mapping copy constructor. */
+	Mapped_File(const Mapped_File&) noexcept = delete;
+	/** Disallow mapping copy assignment. */
+	Mapped_File& operator=(const Mapped_File&) noexcept = delete;
+
+
+	// Private Attributes
+	const char* m_data = nullptr;
+	size_t m_size = 0ULL;
+	void* m_fileHandle = nullptr;
+	void* m_mappingHandle = nullptr;
+};
+
+#endif // MAPPED_FILE_H
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "Utilities/IO/Mesh_IO.h"
 #include "Engine.h"
+#include "Utilities/IO/Atomic_File.h"
+#include "Utilities/IO/Mapped_File.h"
+#include "Utilities/IO/Mesh_Simplifier.h"
 #include "assimp/Importer.hpp"
 #include "assimp/postprocess.h"
 #include "assimp/scene.h"
@@ -9,6 +12,13 @@
 #include <algorithm>
 #include <string>
 #include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
 
 
 /** Convert an aiMatrix to glm::mat4.
@@ -38,14 +48,328 @@ inline glm::mat4 aiMatrix_to_Mat4x4(const aiMatrix4x4& d) noexcept
 	return newNode;
 }
 
-bool Mesh_IO::Import_Model(Engine& engine, const std::string& relativePath, Mesh_Geometry& importedData)
+/** Every attribute of a single vertex, used to weld identical vertices together. */
+struct Vertex_Key {
+	glm::vec3 vertex, normal, tangent, bitangent;
+	glm::vec2 uv;
+	GLuint materialIndex, meshIndex;
+	VertexBoneData bone;
+
+	/** Give every float a single bit pattern per value, so that -0.0 matches +0.0 and every NaN matches itself.
+	Must be called before the key is hashed or compared, as both work on the key's bytes. */
+	inline void canonicalize() noexcept {
+		const auto canonical = [](float& value) noexcept {
+			if (value == 0.0F)
+				value = 0.0F;
+			else if (std::isnan(value))
+				value = std::numeric_limits<float>::quiet_NaN();
+		};
+		for (auto* attribute : { &vertex, &normal, &tangent, &bitangent })
+			for (int x = 0; x < 3; ++x)
+				canonical((*attribute)[x]);
+		canonical(uv.x);
+		canonical(uv.y);
+		for (auto& weight : bone.Weights)
+			canonical(weight);
+	}
+	inline bool operator==(const Vertex_Key& other) const noexcept {
+		return std::memcmp(this, &other, sizeof(Vertex_Key)) == 0;
+	}
+};
+/** Hashes the bytes of a canonicalized vertex key. */
+struct Vertex_Key_Hash {
+	inline size_t operator()(const Vertex_Key& key) const noexcept {
+		// FNV-1a
+		const auto* bytes = reinterpret_cast<const unsigned char*>(&key);
+		size_t hash = 14695981039346656037ULL;
+		for (size_t x = 0ULL; x < sizeof(Vertex_Key); ++x)
+			hash = (hash ^ bytes[x]) * 1099511628211ULL;
+		return hash;
+	}
+};
+
+/** Find or add a bone by name, returning its index in the bone transforms.
+@param	bone			the bone to register.
+@param	importedData	reference to the container holding the bones.
+@return					the index of the bone. */
+inline size_t register_bone(const aiBone& bone, Mesh_Geometry& importedData)
+{
+	size_t BoneIndex = 0;
+	std::string BoneName(bone.mName.data);
+
+	if (importedData.boneMap.find(BoneName) == importedData.boneMap.end()) {
+		BoneIndex = importedData.boneTransforms.size();
+		importedData.boneTransforms.emplace_back(1.0F);
+	}
+	else
+		BoneIndex = importedData.boneMap[BoneName];
+
+	importedData.boneMap[BoneName] = BoneIndex;
+	importedData.boneTransforms[BoneIndex] = aiMatrix_to_Mat4x4(bone.mOffsetMatrix);
+	return BoneIndex;
+}
+
+/** Import every mesh in a scene as welded vertices and a triangle index list.
+@param	scene			the scene to import from.
+@param	importedData	reference to the container to place the imported data within. */
+static void import_indexed_geometry(const aiScene& scene, Mesh_Geometry& importedData)
+{
+	std::unordered_map<Vertex_Key, GLuint, Vertex_Key_Hash> weldedVertices;
+	const auto meshCount = scene.mNumMeshes;
+	const auto materialCount = scene.mNumMaterials;
+	for (unsigned int a = 0; a < meshCount; ++a) {
+		const aiMesh* mesh = scene.mMeshes[a];
+		const GLuint meshMaterialOffset = std::max(0U, materialCount > 1 ? mesh->mMaterialIndex - 1U : 0U);
+
+		// Gather the bone weights of each of this mesh's vertices
+		const auto vertexCount = mesh->mNumVertices;
+		std::vector<VertexBoneData> meshBones(vertexCount);
+		const auto boneCount = mesh->mNumBones;
+		for (unsigned int b = 0U; b < boneCount; ++b) {
+			const auto BoneIndex = register_bone(*mesh->mBones[b], importedData);
+			const auto weightCount = mesh->mBones[b]->mNumWeights;
+			for (unsigned int j = 0U; j < weightCount; ++j) {
+				const auto& weight = mesh->mBones[b]->mWeights[j];
+				if (weight.mVertexId < vertexCount)
+					meshBones[weight.mVertexId].AddBoneData(static_cast<int>(BoneIndex), weight.mWeight);
+			}
+		}
+
+		// Weld each vertex against every vertex seen so far
+		std::vector<GLuint> remap(vertexCount);
+		for (unsigned int v = 0; v < vertexCount; ++v) {
+			Vertex_Key key{};
+			key.vertex = glm::vec3(mesh->mVertices[v].x, mesh->mVertices[v].y, mesh->mVertices[v].z);
+
+			const auto normal = mesh->HasNormals() ? mesh->mNormals[v] : aiVector3D(1.0F, 1.0F, 1.0F);
+			key.normal = glm::normalize(glm::vec3(normal.x, normal.y, normal.z));
+
+			const auto tangent = mesh->HasTangentsAndBitangents() ? mesh->mTangents[v] : aiVector3D(1.0F, 1.0F, 1.0F);
+			key.tangent = glm::normalize(glm::vec3(tangent.x, tangent.y, tangent.z));
+
+			const auto bitangent = mesh->HasTangentsAndBitangents() ? mesh->mBitangents[v] : aiVector3D(1.0F, 1.0F, 1.0F);
+			key.bitangent = glm::normalize(glm::vec3(bitangent.x, bitangent.y, bitangent.z));
+
+			const auto uvmap = mesh->HasTextureCoords(0) ? (mesh->mTextureCoords[0][v]) : aiVector3D(0, 0, 0);
+			key.uv = glm::vec2(uvmap.x, uvmap.y);
+
+			key.materialIndex = meshMaterialOffset;
+			key.meshIndex = a;
+			key.bone = meshBones[v];
+			key.canonicalize();
+
+			const auto [entry, inserted] = weldedVertices.try_emplace(key, static_cast<GLuint>(importedData.vertices.size()));
+			if (inserted) {
+				importedData.vertices.push_back(key.vertex);
+				importedData.normals.push_back(key.normal);
+				importedData.tangents.push_back(key.tangent);
+				importedData.bitangents.push_back(key.bitangent);
+				importedData.texCoords.push_back(key.uv);
+				importedData.materialIndices.push_back(key.materialIndex);
+				importedData.meshIndices.push_back(key.meshIndex);
+				importedData.bones.push_back(key.bone);
+			}
+			remap[v] = entry->second;
+		}
+
+		// Keep the faces' indices, remapped onto the welded vertices
+		const auto faceCount = mesh->mNumFaces;
+		for (unsigned int x = 0; x < faceCount; ++x) {
+			const aiFace& face = mesh->mFaces[x];
+			if (face.mNumIndices != 3U)
+				continue;
+			for (unsigned int b = 0; b < 3U; ++b)
+				importedData.indices.push_back(remap[face.mIndices[b]]);
+		}
+	}
+}
+
+/* MESH CACHE STRUCTURE {
+	header
+	payload {
+		vertices, normals, tangents, bitangents, texCoords, materialIndices, meshIndices, indices
+		lods
+		bones, boneTransforms
+		boneMap
+		animations
+		rootNode
+		materials
+	}
+}
+Arrays are prefixed by a 64-bit element count, strings by a 64-bit length, all values are little-endian. */
+constexpr char MeshCacheMagic[4] = { 'R', 'M', 'S', 'H' };
+/** Bump whenever the import steps or the cache layout change, invalidating every cached mesh. */
+constexpr std::uint32_t MeshCacheVersion = 3U;
+
+/** Identifies the source file and importer a cache file was generated from. */
+struct Mesh_Cache_Header {
+	char magic[4];
+	std::uint32_t version;
+	std::uint32_t importerVersion;
+	std::uint32_t indexed;
+	std::uint64_t sourceSize;
+	std::int64_t sourceTime;
+	std::uint64_t payloadSize;
+	std::uint64_t checksum;
+};
+
+static std::atomic_size_t g_cacheHits = 0ULL, g_cacheMisses = 0ULL, g_cacheCorrupt = 0ULL;
+
+/** Compute a 64-bit FNV-1a checksum of a block of memory.
+@param	data	the memory to checksum.
+@param	size	the number of bytes to checksum.
+@return			the checksum. */
+inline std::uint64_t cache_checksum(const char* data, const size_t& size) noexcept
+{
+	std::uint64_t hash = 14695981039346656037ULL;
+	for (size_t x = 0ULL; x < size; ++x)
+		hash = (hash ^ static_cast<unsigned char>(data[x])) * 1099511628211ULL;
+	return hash;
+}
+
+/** Generate the full path of the cache file for a model.
+@param	relativePath	the path to the model's source file.
+@param	indexed			whether the cache holds the indexed or flat version of the model.
+@return					the full path to the cache file. */
+inline std::string cache_path(const std::string& relativePath, const bool& indexed)
+{
+	auto flatPath = relativePath;
+	std::replace_if(flatPath.begin(), flatPath.end(), [](const char& ch) noexcept { return ch == '\\' || ch == '/' || ch == ':'; }, '_');
+	return Engine::Get_Current_Dir() + "\\Cache\\Models\\" + flatPath + (indexed ? ".indexed" : "") + ".mcache";
+}
+
+/** Fill in the fields of a cache header that identify its source file and importer.
+@param	relativePath	the path to the model's source file.
+@param	indexed			whether the cache holds the indexed or flat version of the model.
+@param	header			reference to the header to fill in.
+@return					true if the source file could be inspected, false otherwise. */
+inline bool cache_key(const std::string& relativePath, const bool& indexed, Mesh_Cache_Header& header)
+{
+	std::error_code ec;
+	const std::filesystem::path sourcePath(Engine::Get_Current_Dir() + relativePath);
+	const auto sourceSize = std::filesystem::file_size(sourcePath, ec);
+	if (ec)
+		return false;
+	const auto sourceTime = std::filesystem::last_write_time(sourcePath, ec);
+	if (ec)
+		return false;
+
+	std::memcpy(header.magic, MeshCacheMagic, sizeof(MeshCacheMagic));
+	header.version = MeshCacheVersion;
+	header.importerVersion = ((aiGetVersionMajor() & 0xFFU) << 24U) | ((aiGetVersionMinor() & 0xFFU) << 16U) | (aiGetVersionRevision() & 0xFFFFU);
+	header.indexed = indexed ? 1U : 0U;
+	header.sourceSize = static_cast<std::uint64_t>(sourceSize);
+	header.sourceTime = static_cast<std::int64_t>(sourceTime.time_since_epoch().count());
+	return true;
+}
+
+/** Appends values to a cache file's payload. */
+struct Cache_Writer {
+	std::vector<char> data;
+
+	template <typename T>
+	inline void write(const T& value) {
+		static_assert(std::is_trivially_copyable_v<T>, "Cache values must be trivially copyable");
+		const auto* bytes = reinterpret_cast<const char*>(&value);
+		data.insert(data.end(), bytes, bytes + sizeof(T));
+	}
+	template <typename T>
+	inline void writeArray(const std::vector<T>& values) {
+		static_assert(std::is_trivially_copyable_v<T>, "Cache values must be trivially copyable");
+		write(static_cast<std::uint64_t>(values.size()));
+		const auto* bytes = reinterpret_cast<const char*>(values.data());
+		data.insert(data.end(), bytes, bytes + (values.size() * sizeof(T)));
+	}
+	inline void writeString(const std::string& value) {
+		write(static_cast<std::uint64_t>(value.size()));
+		data.insert(data.end(), value.cbegin(), value.cend());
+	}
+	template <typename T>
+	inline void writeKeys(const std::vector<Animation_Time_Key<T>>& keys) {
+		// Keys are written field by field, so that struct padding never reaches the file
+		write(static_cast<std::uint64_t>(keys.size()));
+		for (const auto& key : keys) {
+			write(key.time);
+			write(key.value);
+		}
+	}
+	inline void writeNode(const Node& node) {
+		writeString(node.name);
+		write(node.transformation);
+		write(static_cast<std::uint64_t>(node.children.size()));
+		for (const auto& child : node.children)
+			writeNode(child);
+	}
+};
+
+/** Reads values from a cache file's payload, failing instead of reading out of bounds. */
+struct Cache_Reader {
+	const char* data = nullptr;
+	size_t size = 0ULL, offset = 0ULL;
+	bool valid = true;
+
+	/** Retrieve the number of elements the next array holds, provided each takes at least the given number of bytes. */
+	inline size_t readCount(const size_t& minimumElementSize) {
+		const auto count = read<std::uint64_t>();
+		if (count > (size - offset) / minimumElementSize) {
+			valid = false;
+			return 0ULL;
+		}
+		return static_cast<size_t>(count);
+	}
+	template <typename T>
+	inline T read() {
+		T value{};
+		if (!valid || size - offset < sizeof(T)) {
+			valid = false;
+			return value;
+		}
+		std::memcpy(&value, data + offset, sizeof(T));
+		offset += sizeof(T);
+		return value;
+	}
+	template <typename T>
+	inline void readArray(std::vector<T>& values) {
+		values.resize(readCount(sizeof(T)));
+		if (!values.empty())
+			std::memcpy(values.data(), data + offset, values.size() * sizeof(T));
+		offset += values.size() * sizeof(T);
+	}
+	inline std::string readString() {
+		const auto length = readCount(1ULL);
+		std::string value(data + offset, length);
+		offset += length;
+		return value;
+	}
+	template <typename T>
+	inline void readKeys(std::vector<Animation_Time_Key<T>>& keys) {
+		keys.resize(readCount(sizeof(double) + sizeof(T)));
+		for (auto& key : keys) {
+			key.time = read<double>();
+			key.value = read<T>();
+		}
+	}
+	inline void readNode(Node& node) {
+		node.name = readString();
+		node.transformation = read<glm::mat4>();
+		node.children.resize(readCount(sizeof(std::uint64_t) * 2ULL + sizeof(glm::mat4)));
+		for (auto& child : node.children)
+			readNode(child);
+	}
+};
+
+bool Mesh_IO::Import_Model(Engine& engine, const std::string& relativePath, Mesh_Geometry& importedData, const bool& indexed, const bool& useCache)
 {
 	// Check if the file exists
 	if (!Engine::File_Exists(relativePath)) {
-		engine.getManager_Messages().error("The file \"" + relativePath + "\" does not exist.");
+		engine.getManager_Messages().error("The file \"" + relativePath + "\" does not exist.", Message_Category::ASSETS);
 		return false;
 	}
 
+	// Skip the importer entirely if the cache is up to date
+	if (useCache && Import_Cache(relativePath, importedData, indexed))
+		return true;
+
 	// Get Importer Resource
 	Assimp::Importer importer;
 	const aiScene* scene = importer.ReadFile(
@@ -62,14 +386,16 @@ bool Mesh_IO::Import_Model(Engine& engine, const std::string& relativePath, Mesh
 
 	// Check if scene imported successfully
 	if (scene == nullptr) {
-		engine.getManager_Messages().error("The file \"" + relativePath + "\" exists, but is corrupted.");
+		engine.getManager_Messages().error("The file \"" + relativePath + "\" exists, but is corrupted.", Message_Category::ASSETS);
 		return false;
 	}
 
 	// Import geometry
 	const auto meshCount = scene->mNumMeshes;
 	const auto materialCount = scene->mNumMaterials;
-	for (unsigned int a = 0; a < meshCount; ++a) {
+	if (indexed)
+		import_indexed_geometry(*scene, importedData);
+	for (unsigned int a = 0; a < meshCount && !indexed; ++a) {
 		const aiMesh* mesh = scene->mMeshes[a];
 		const GLuint meshMaterialOffset = std::max(0U, materialCount > 1 ? mesh->mMaterialIndex - 1U : 0U);
 		const auto faceCount = mesh->mNumFaces;
@@ -135,27 +461,16 @@ bool Mesh_IO::Import_Model(Engine& engine, const std::string& relativePath, Mesh
 		}
 	}
 
-	// Copy Root Node and bones
+	// Copy Root Node and bones (indexed geometry already gathered its bones while welding)
 	const auto VertexCount = importedData.vertices.size();
 	importedData.rootNode = copy_node(scene->mRootNode);
 	importedData.bones.resize(VertexCount);
 	int vertexOffset = 0;
-	for (unsigned int a = 0U; a < meshCount; ++a) {
+	for (unsigned int a = 0U; a < meshCount && !indexed; ++a) {
 		const aiMesh* mesh = scene->mMeshes[a];
 		const auto boneCount = mesh->mNumBones;
 		for (unsigned int b = 0U; b < boneCount; ++b) {
-			size_t BoneIndex = 0;
-			std::string BoneName(mesh->mBones[b]->mName.data);
-
-			if (importedData.boneMap.find(BoneName) == importedData.boneMap.end()) {
-				BoneIndex = importedData.boneTransforms.size();
-				importedData.boneTransforms.emplace_back(1.0F);
-			}
-			else
-				BoneIndex = importedData.boneMap[BoneName];
-
-			importedData.boneMap[BoneName] = BoneIndex;
-			importedData.boneTransforms[BoneIndex] = aiMatrix_to_Mat4x4(mesh->mBones[b]->mOffsetMatrix);
+			const auto BoneIndex = register_bone(*mesh->mBones[b], importedData);
 
 			const auto weightCount = mesh->mBones[b]->mNumWeights;
 			for (unsigned int j = 0U; j < weightCount; ++j) {
@@ -226,9 +541,168 @@ bool Mesh_IO::Import_Model(Engine& engine, const std::string& relativePath, Mesh
 		}
 	else
 		importedData.materials.emplace_back(Material_Strings());
+
+	// Simplify indexed geometry here, so that cached imports skip it
+	if (indexed)
+		Mesh_Simplifier::Generate_LODs(importedData);
+
+	// Failing to cache only costs the next import time, so it isn't reported
+	if (useCache)
+		Export_Cache(relativePath, importedData, indexed);
+	return true;
+}
+
+bool Mesh_IO::Import_Cache(const std::string& relativePath, Mesh_Geometry& importedData, const bool& indexed)
+{
+	// Find out what the cache file should have been generated from
+	Mesh_Cache_Header expected{};
+	Mapped_File file;
+	if (!cache_key(relativePath, indexed, expected) || !file.open(cache_path(relativePath, indexed))) {
+		++g_cacheMisses;
+		return false;
+	}
+
+	// A mismatched header means the cache is stale, a mismatched checksum means it's corrupt
+	Mesh_Cache_Header header{};
+	if (file.size() < sizeof(Mesh_Cache_Header)) {
+		++g_cacheMisses;
+		++g_cacheCorrupt;
+		return false;
+	}
+	std::memcpy(&header, file.data(), sizeof(Mesh_Cache_Header));
+	if (std::memcmp(header.magic, expected.magic, sizeof(MeshCacheMagic)) != 0 ||
+		header.version != expected.version ||
+		header.importerVersion != expected.importerVersion ||
+		header.indexed != expected.indexed ||
+		header.sourceSize != expected.sourceSize ||
+		header.sourceTime != expected.sourceTime) {
+		++g_cacheMisses;
+		return false;
+	}
+	const auto* payload = file.data() + sizeof(Mesh_Cache_Header);
+	const auto payloadSize = file.size() - sizeof(Mesh_Cache_Header);
+	if (header.payloadSize != payloadSize || header.checksum != cache_checksum(payload, payloadSize)) {
+		++g_cacheMisses;
+		++g_cacheCorrupt;
+		return false;
+	}
+
+	// Read the payload
+	Mesh_Geometry cachedData;
+	Cache_Reader reader{ payload, payloadSize };
+	reader.readArray(cachedData.vertices);
+	reader.readArray(cachedData.normals);
+	reader.readArray(cachedData.tangents);
+	reader.readArray(cachedData.bitangents);
+	reader.readArray(cachedData.texCoords);
+	reader.readArray(cachedData.materialIndices);
+	reader.readArray(cachedData.meshIndices);
+	reader.readArray(cachedData.indices);
+	cachedData.lods.resize(reader.readCount(sizeof(std::uint64_t) + sizeof(float)));
+	for (auto& lod : cachedData.lods) {
+		reader.readArray(lod.indices);
+		lod.error = reader.read<float>();
+	}
+	reader.readArray(cachedData.bones);
+	reader.readArray(cachedData.boneTransforms);
+	const auto boneCount = reader.readCount(sizeof(std::uint64_t) * 2ULL);
+	for (size_t x = 0ULL; x < boneCount && reader.valid; ++x) {
+		auto name = reader.readString();
+		cachedData.boneMap[std::move(name)] = static_cast<size_t>(reader.read<std::uint64_t>());
+	}
+	cachedData.animations.resize(reader.readCount(sizeof(std::uint32_t) + sizeof(double) * 2ULL + sizeof(std::uint64_t)));
+	for (auto& animation : cachedData.animations) {
+		animation.numChannels = reader.read<std::uint32_t>();
+		animation.ticksPerSecond = reader.read<double>();
+		animation.duration = reader.read<double>();
+		animation.channels.resize(reader.readCount(sizeof(std::uint64_t) * 4ULL));
+		for (auto& channel : animation.channels) {
+			channel.nodeName = reader.readString();
+			reader.readKeys(channel.scalingKeys);
+			reader.readKeys(channel.rotationKeys);
+			reader.readKeys(channel.positionKeys);
+		}
+	}
+	reader.readNode(cachedData.rootNode);
+	cachedData.materials.resize(reader.readCount(sizeof(std::uint64_t) * 6ULL));
+	for (auto& material : cachedData.materials)
+		for (auto* texture : { &material.albedo, &material.normal, &material.metalness, &material.roughness, &material.height, &material.ao })
+			*texture = reader.readString();
+	if (!reader.valid || reader.offset != payloadSize) {
+		++g_cacheMisses;
+		++g_cacheCorrupt;
+		return false;
+	}
+
+	importedData = std::move(cachedData);
+	++g_cacheHits;
 	return true;
 }
 
+bool Mesh_IO::Export_Cache(const std::string& relativePath, const Mesh_Geometry& importedData, const bool& indexed)
+{
+	Mesh_Cache_Header header{};
+	if (!cache_key(relativePath, indexed, header))
+		return false;
+
+	// Write the payload
+	Cache_Writer writer;
+	writer.writeArray(importedData.vertices);
+	writer.writeArray(importedData.normals);
+	writer.writeArray(importedData.tangents);
+	writer.writeArray(importedData.bitangents);
+	writer.writeArray(importedData.texCoords);
+	writer.writeArray(importedData.materialIndices);
+	writer.writeArray(importedData.meshIndices);
+	writer.writeArray(importedData.indices);
+	writer.write(static_cast<std::uint64_t>(importedData.lods.size()));
+	for (const auto& lod : importedData.lods) {
+		writer.writeArray(lod.indices);
+		writer.write(lod.error);
+	}
+	writer.writeArray(importedData.bones);
+	writer.writeArray(importedData.boneTransforms);
+	writer.write(static_cast<std::uint64_t>(importedData.boneMap.size()));
+	for (const auto& [name, index] : importedData.boneMap) {
+		writer.writeString(name);
+		writer.write(static_cast<std::uint64_t>(index));
+	}
+	writer.write(static_cast<std::uint64_t>(importedData.animations.size()));
+	for (const auto& animation : importedData.animations) {
+		writer.write(static_cast<std::uint32_t>(animation.numChannels));
+		writer.write(animation.ticksPerSecond);
+		writer.write(animation.duration);
+		writer.write(static_cast<std::uint64_t>(animation.channels.size()));
+		for (const auto& channel : animation.channels) {
+			writer.writeString(channel.nodeName);
+			writer.writeKeys(channel.scalingKeys);
+			writer.writeKeys(channel.rotationKeys);
+			writer.writeKeys(channel.positionKeys);
+		}
+	}
+	writer.writeNode(importedData.rootNode);
+	writer.write(static_cast<std::uint64_t>(importedData.materials.size()));
+	for (const auto& material : importedData.materials)
+		for (const auto* texture : { &material.albedo, &material.normal, &material.metalness, &material.roughness, &material.height, &material.ao })
+			writer.writeString(*texture);
+	header.payloadSize = static_cast<std::uint64_t>(writer.data.size());
+	header.checksum = cache_checksum(writer.data.data(), writer.data.size());
+
+	// Write atomically, so other readers never see a partial cache, even after a crash or power loss
+	std::vector<char> fileData(sizeof(Mesh_Cache_Header));
+	std::memcpy(fileData.data(), &header, sizeof(Mesh_Cache_Header));
+	fileData.insert(fileData.end(), writer.data.cbegin(), writer.data.cend());
+	std::error_code ec;
+	const std::filesystem::path path(cache_path(relativePath, indexed));
+	std::filesystem::create_directories(path.parent_path(), ec);
+	return Atomic_File::Write(path.string(), fileData);
+}
+
+Mesh_Cache_Statistics Mesh_IO::Get_Cache_Statistics() noexcept
+{
+	return Mesh_Cache_Statistics{ g_cacheHits.load(), g_cacheMisses.load(), g_cacheCorrupt.load() };
+}
+
 std::string Mesh_IO::Get_Version()
 {
 	return std::to_string(aiGetVersionMajor()) + "." + std::to_string(aiGetVersionMinor()) + "." + std::to_string(aiGetVersionRevision());
@@ -57,6 +57,19 @@ struct Animation {
 	double duration = 0.0;
 	std::vector<Node_Animation> channels;
 };
+/** Container for a node hierarchy flattened into parent-first order, with names resolved to indices once. */
+struct Skeleton_Binding {
+	std::vector<int> parents;					// Index of each node's parent, -1 for the root
+	std::vector<int> bones;						// Index of each node's bone, -1 if it has none
+	std::vector<glm::mat4> transformations;		// Each node's bind transformation
+	std::vector<std::vector<int>> channels;		// Per animation, index of the channel animating each node, -1 if it isn't animated
+	glm::mat4 inverseRootTransform = glm::mat4(1);
+};
+/** Container for a simplified version of a mesh. */
+struct Mesh_LOD {
+	std::vector<GLuint> indices;		// Triangle list indexing the full mesh's attributes
+	float error = 0.0F;					// Farthest the surface strays from the full mesh, in model space
+};
 /** Container for underlying mesh data. */
 struct Mesh_Geometry {
 	// Per Vertex Attributes
@@ -68,6 +81,11 @@ struct Mesh_Geometry {
 	std::vector<GLuint> materialIndices;
 	std::vector<GLuint> meshIndices;
 
+	// Triangle list indexing the attributes above, empty when they are already a triangle list
+	std::vector<GLuint> indices;
+	// Simplified triangle lists indexing the same attributes, coarsest last, only generated for indexed imports
+	std::vector<Mesh_LOD> lods;
+
 	// Materials
 	std::vector<Material_Strings> materials;
 
@@ -77,6 +95,7 @@ struct Mesh_Geometry {
 	std::map<std::string, size_t> boneMap;
 	std::vector<Animation> animations;
 	Node rootNode;
+	Skeleton_Binding skeleton;
 };
 /** Container defining a single vertex. */
 struct SingleVertex {
@@ -89,9 +108,22 @@ struct SingleVertex {
 	glm::ivec4 boneIDs = glm::ivec4(0);
 	glm::vec4 weights = glm::vec4(0.0f);
 };
+/** Container defining a range of indices drawing one level of detail. */
+struct Geometry_LOD {
+	size_t m_firstIndex = 0ULL, m_indexCount = 0ULL;
+	float m_error = 0.0F;
+};
 /** Container defining a collection of vertices. */
 struct GeometryInfo {
 	std::vector<SingleVertex> m_vertices;
+	std::vector<GLuint> m_indices;
+	std::vector<Geometry_LOD> m_lods;	// Ranges of the indices above per level of detail, finest first
+};
+/** Container counting how often imports were served by the mesh cache. */
+struct Mesh_Cache_Statistics {
+	size_t hits = 0ULL;		// Imports read from the cache
+	size_t misses = 0ULL;	// Imports that needed Assimp, including corrupt cache files
+	size_t corrupt = 0ULL;	// Cache files rejected by their checksum or structure
 };
 
 /** A static helper class used for reading/writing models.
@@ -99,11 +131,29 @@ Uses the Assimp library: http://assimp.sourceforge.net/ */
 class Mesh_IO {
 public:
 	/** Import a model from disk.
+	@note					reads the mesh cache if it holds an up-to-date copy of the model, otherwise imports with Assimp and refreshes the cache.
 	@param	engine			reference to the engine to use.
 	@param	relativePath	the path to the file.
 	@param	importedData	reference to the container to place the imported data within.
+	@param	indexed			if true, welds identical vertices together and fills the geometry's index list, otherwise imports a flat triangle list.
+	@param	useCache		if false, always imports with Assimp and leaves the cache untouched.
 	@return					true on successful import, false otherwise (error reported to engine). */
-	static bool Import_Model(Engine& engine, const std::string& relativePath, Mesh_Geometry& importedData);
+	static bool Import_Model(Engine& engine, const std::string& relativePath, Mesh_Geometry& importedData, const bool& indexed = false, const bool& useCache = true);
+	/** Read a model from the mesh cache, if its cached copy matches the source file and importer version.
+	@param	relativePath	the path to the source file.
+	@param	importedData	reference to the container to place the cached data within.
+	@param	indexed			whether to read the indexed or flat version of the model.
+	@return					true on a cache hit, false if missing, stale or corrupt. */
+	static bool Import_Cache(const std::string& relativePath, Mesh_Geometry& importedData, const bool& indexed);
+	/** Write an imported model to the mesh cache, keyed by its source file and the importer version.
+	@param	relativePath	the path to the source file.
+	@param	importedData	the imported data to cache.
+	@param	indexed			whether the data is the indexed or flat version of the model.
+	@return					true if the cache file was written, false otherwise. */
+	static bool Export_Cache(const std::string& relativePath, const Mesh_Geometry& importedData, const bool& indexed);
+	/** Retrieve how often imports have been served by the mesh cache.
+	@return					the cache statistics since startup. */
+	static Mesh_Cache_Statistics Get_Cache_Statistics() noexcept;
 	/** Retrieve the plugin version.
 	@return					the plugin version. */
 	static std::string Get_Version();
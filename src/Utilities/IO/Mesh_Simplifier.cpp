@@ -0,0 +1,304 @@
+#include "Utilities/IO/Mesh_Simplifier.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <queue>
+#include <tuple>
+
+
+/** Symmetric 4x4 matrix summing the squared distances from a point to a set of planes. */
+struct Quadric {
+	double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0, a11 = 0.0, a12 = 0.0, a13 = 0.0, a22 = 0.0, a23 = 0.0, a33 = 0.0;
+
+	/** Add a plane to this quadric.
+	@param	n		the unit-length plane normal.
+	@param	d		the plane's distance term, such that dot(n, p) + d = 0 on the plane. */
+	inline void addPlane(const glm::dvec3& n, const double& d) noexcept {
+		a00 += n.x * n.x; a01 += n.x * n.y; a02 += n.x * n.z; a03 += n.x * d;
+		a11 += n.y * n.y; a12 += n.y * n.z; a13 += n.y * d;
+		a22 += n.z * n.z; a23 += n.z * d;
+		a33 += d * d;
+	}
+	inline Quadric& operator+=(const Quadric& o) noexcept {
+		a00 += o.a00; a01 += o.a01; a02 += o.a02; a03 += o.a03;
+		a11 += o.a11; a12 += o.a12; a13 += o.a13;
+		a22 += o.a22; a23 += o.a23;
+		a33 += o.a33;
+		return *this;
+	}
+	/** Retrieve the summed squared distance from a point to every plane.
+	@param	p		the point to evaluate.
+	@return			the squared error of the point. */
+	inline double evaluate(const glm::dvec3& p) const noexcept {
+		return std::max(0.0,
+			a00 * p.x * p.x + 2.0 * a01 * p.x * p.y + 2.0 * a02 * p.x * p.z + 2.0 * a03 * p.x
+			+ a11 * p.y * p.y + 2.0 * a12 * p.y * p.z + 2.0 * a13 * p.y
+			+ a22 * p.z * p.z + 2.0 * a23 * p.z
+			+ a33);
+	}
+};
+
+/** A candidate edge collapse, moving one vertex onto another. */
+struct Edge_Collapse {
+	double cost = 0.0;
+	GLuint from = 0U, to = 0U;
+	unsigned int fromVersion = 0U, toVersion = 0U;
+
+	inline bool operator>(const Edge_Collapse& o) const noexcept {
+		return cost > o.cost;
+	}
+};
+
+float Mesh_Simplifier::Simplify(const std::vector<glm::vec3>& positions, const std::vector<GLuint>& regions, const std::vector<GLuint>& indices, const size_t& targetCount, const float& maxError, std::vector<GLuint>& result)
+{
+	result = indices;
+	const auto vertexCount = positions.size();
+	const auto triangleCount = indices.size() / 3ULL;
+	if (indices.size() <= targetCount || vertexCount == 0ULL)
+		return 0.0F;
+
+	// Group vertices sharing a position, as UV and material seams split one point of the surface into several vertices
+	// Each group shares the quadric of its first vertex, and seam vertices are locked so the seam can't open up
+	std::vector<GLuint> order(vertexCount);
+	std::iota(order.begin(), order.end(), 0U);
+	std::sort(order.begin(), order.end(), [&positions](const GLuint& a, const GLuint& b) noexcept {
+		const auto& pa = positions[a];
+		const auto& pb = positions[b];
+		return std::tie(pa.x, pa.y, pa.z) < std::tie(pb.x, pb.y, pb.z);
+		});
+	std::vector<GLuint> positionIDs(vertexCount);
+	std::vector<bool> locked(vertexCount, false);
+	for (size_t first = 0ULL; first < vertexCount;) {
+		auto last = first + 1ULL;
+		while (last < vertexCount && positions[order[last]] == positions[order[first]])
+			++last;
+		for (auto x = first; x < last; ++x) {
+			positionIDs[order[x]] = order[first];
+			locked[order[x]] = last - first > 1ULL;
+		}
+		first = last;
+	}
+
+	// Lock vertices on edges not shared by exactly two triangles, which would tear open if moved
+	std::vector<std::uint64_t> edges;
+	edges.reserve(triangleCount * 3ULL);
+	for (size_t t = 0ULL; t < triangleCount; ++t)
+		for (size_t e = 0ULL; e < 3ULL; ++e) {
+			auto a = positionIDs[indices[t * 3ULL + e]], b = positionIDs[indices[t * 3ULL + ((e + 1ULL) % 3ULL)]];
+			if (a > b)
+				std::swap(a, b);
+			edges.push_back((static_cast<std::uint64_t>(a) << 32ULL) | static_cast<std::uint64_t>(b));
+		}
+	std::sort(edges.begin(), edges.end());
+	for (size_t first = 0ULL; first < edges.size();) {
+		auto last = first + 1ULL;
+		while (last < edges.size() && edges[last] == edges[first])
+			++last;
+		if (last - first != 2ULL) {
+			locked[static_cast<size_t>(edges[first] >> 32ULL)] = true;
+			locked[static_cast<size_t>(edges[first] & 0xFFFFFFFFULL)] = true;
+		}
+		first = last;
+	}
+
+	// Lock vertices bordering another region, such as the vertices between two bones of a skinned mesh
+	// Moving them would drag one region's surface along with the other's skinning
+	if (regions.size() == vertexCount)
+		for (size_t t = 0ULL; t < triangleCount; ++t)
+			for (size_t e = 0ULL; e < 3ULL; ++e) {
+				const auto a = indices[t * 3ULL + e], b = indices[t * 3ULL + ((e + 1ULL) % 3ULL)];
+				if (regions[a] != regions[b]) {
+					locked[a] = true;
+					locked[b] = true;
+				}
+			}
+
+	// Sum the planes of the triangles around each position
+	std::vector<Quadric> quadrics(vertexCount);
+	for (size_t t = 0ULL; t < triangleCount; ++t) {
+		const glm::dvec3 p0(positions[indices[t * 3ULL]]), p1(positions[indices[t * 3ULL + 1ULL]]), p2(positions[indices[t * 3ULL + 2ULL]]);
+		auto normal = glm::cross(p1 - p0, p2 - p0);
+		const auto length = glm::length(normal);
+		if (length <= 0.0)
+			continue;
+		normal /= length;
+		Quadric plane;
+		plane.addPlane(normal, -glm::dot(normal, p0));
+		for (size_t k = 0ULL; k < 3ULL; ++k)
+			quadrics[positionIDs[indices[t * 3ULL + k]]] += plane;
+	}
+
+	// Find the triangles around each vertex
+	std::vector<GLuint> triangles(indices.cbegin(), indices.cbegin() + static_cast<std::ptrdiff_t>(triangleCount * 3ULL));
+	std::vector<std::vector<GLuint>> adjacency(vertexCount);
+	for (size_t t = 0ULL; t < triangleCount; ++t)
+		for (size_t k = 0ULL; k < 3ULL; ++k)
+			adjacency[triangles[t * 3ULL + k]].push_back(static_cast<GLuint>(t));
+
+	// Queue every edge in both directions, cheapest first
+	// Collapses are re-queued instead of updated in place, stale ones being recognized by their vertices' versions
+	const auto maxCost = static_cast<double>(maxError) * static_cast<double>(maxError);
+	std::vector<unsigned int> versions(vertexCount, 0U);
+	std::priority_queue<Edge_Collapse, std::vector<Edge_Collapse>, std::greater<Edge_Collapse>> queue;
+	const auto queueCollapse = [&](const GLuint& from, const GLuint& to) {
+		if (locked[from] || from == to)
+			return;
+		auto quadric = quadrics[positionIDs[from]];
+		quadric += quadrics[positionIDs[to]];
+		const auto cost = quadric.evaluate(glm::dvec3(positions[to]));
+		if (cost <= maxCost)
+			queue.push({ cost, from, to, versions[from], versions[to] });
+	};
+	for (size_t t = 0ULL; t < triangleCount; ++t)
+		for (size_t e = 0ULL; e < 3ULL; ++e) {
+			const auto a = triangles[t * 3ULL + e], b = triangles[t * 3ULL + ((e + 1ULL) % 3ULL)];
+			queueCollapse(a, b);
+			queueCollapse(b, a);
+		}
+
+	// Collapse edges until the target is met, or every remaining collapse costs too much
+	std::vector<bool> removedVertices(vertexCount, false), removedTriangles(triangleCount, false);
+	auto liveCount = triangleCount;
+	const auto targetTriangles = targetCount / 3ULL;
+	double largestCost = 0.0;
+	std::vector<GLuint> fromNeighbours, toNeighbours, oppositeNeighbours, sharedNeighbours;
+	const auto gatherNeighbours = [&](const GLuint& vertex, const GLuint& other, std::vector<GLuint>& neighbours, std::vector<GLuint>* opposite) {
+		// Find the positions around a vertex, and optionally those across its edge with the other vertex
+		neighbours.clear();
+		for (const auto& t : adjacency[vertex]) {
+			if (removedTriangles[t])
+				continue;
+			const auto* triangle = &triangles[t * 3ULL];
+			const bool shared = triangle[0] == other || triangle[1] == other || triangle[2] == other;
+			for (size_t k = 0ULL; k < 3ULL; ++k)
+				if (const auto neighbour = positionIDs[triangle[k]]; neighbour != positionIDs[vertex] && neighbour != positionIDs[other]) {
+					neighbours.push_back(neighbour);
+					if (shared && opposite != nullptr)
+						opposite->push_back(neighbour);
+				}
+		}
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+	};
+	while (liveCount > targetTriangles && !queue.empty()) {
+		const auto collapse = queue.top();
+		queue.pop();
+		const auto& from = collapse.from;
+		const auto& to = collapse.to;
+		if (removedVertices[from] || removedVertices[to] || versions[from] != collapse.fromVersion || versions[to] != collapse.toVersion)
+			continue;
+
+		// Reject collapses failing the link condition, where the vertices share a neighbour besides those across their edge
+		// Collapsing such an edge folds the surface onto itself, leaving edges shared by more than two triangles
+		oppositeNeighbours.clear();
+		gatherNeighbours(from, to, fromNeighbours, &oppositeNeighbours);
+		gatherNeighbours(to, from, toNeighbours, nullptr);
+		std::sort(oppositeNeighbours.begin(), oppositeNeighbours.end());
+		oppositeNeighbours.erase(std::unique(oppositeNeighbours.begin(), oppositeNeighbours.end()), oppositeNeighbours.end());
+		sharedNeighbours.clear();
+		std::set_intersection(fromNeighbours.cbegin(), fromNeighbours.cend(), toNeighbours.cbegin(), toNeighbours.cend(), std::back_inserter(sharedNeighbours));
+		if (sharedNeighbours != oppositeNeighbours)
+			continue;
+
+		// Reject collapses that would flip a triangle over, or squash it flat
+		bool flips = false;
+		for (const auto& t : adjacency[from]) {
+			const auto* triangle = &triangles[t * 3ULL];
+			if (removedTriangles[t] || triangle[0] == to || triangle[1] == to || triangle[2] == to)
+				continue;
+			glm::vec3 corners[3], moved[3];
+			for (size_t k = 0ULL; k < 3ULL; ++k) {
+				corners[k] = positions[triangle[k]];
+				moved[k] = triangle[k] == from ? positions[to] : corners[k];
+			}
+			const auto before = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+			const auto after = glm::cross(moved[1] - moved[0], moved[2] - moved[0]);
+			if (glm::dot(before, before) > 0.0F && glm::dot(before, after) <= 0.0F) {
+				flips = true;
+				break;
+			}
+		}
+		if (flips)
+			continue;
+
+		// Move the vertex, dropping the triangles that shared the edge
+		for (const auto& t : adjacency[from]) {
+			if (removedTriangles[t])
+				continue;
+			auto* triangle = &triangles[t * 3ULL];
+			for (size_t k = 0ULL; k < 3ULL; ++k)
+				if (triangle[k] == from)
+					triangle[k] = to;
+			if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2]) {
+				removedTriangles[t] = true;
+				--liveCount;
+			}
+			else
+				adjacency[to].push_back(t);
+		}
+		adjacency[from] = std::vector<GLuint>();
+		removedVertices[from] = true;
+		quadrics[positionIDs[to]] += quadrics[positionIDs[from]];
+		++versions[to];
+		largestCost = std::max(largestCost, collapse.cost);
+
+		// Re-queue the edges around the surviving vertex, as its quadric changed
+		auto& around = adjacency[to];
+		around.erase(std::remove_if(around.begin(), around.end(), [&removedTriangles](const GLuint& t) { return removedTriangles[t]; }), around.end());
+		for (const auto& t : around)
+			for (size_t k = 0ULL; k < 3ULL; ++k)
+				if (const auto neighbour = triangles[t * 3ULL + k]; neighbour != to) {
+					queueCollapse(neighbour, to);
+					queueCollapse(to, neighbour);
+				}
+	}
+
+	result.clear();
+	result.reserve(liveCount * 3ULL);
+	for (size_t t = 0ULL; t < triangleCount; ++t)
+		if (!removedTriangles[t])
+			result.insert(result.end(), triangles.cbegin() + static_cast<std::ptrdiff_t>(t * 3ULL), triangles.cbegin() + static_cast<std::ptrdiff_t>(t * 3ULL + 3ULL));
+	return static_cast<float>(std::sqrt(largestCost));
+}
+
+void Mesh_Simplifier::Generate_LODs(Mesh_Geometry& geometry)
+{
+	geometry.lods.clear();
+	if (geometry.indices.size() < MESHSIMPLIFIER_MIN_TRIANGLES * 3ULL || geometry.vertices.empty())
+		return;
+
+	// Cap the error relative to the mesh's size, so the coarsest level still resembles it
+	auto minimum = geometry.vertices[0], maximum = geometry.vertices[0];
+	for (const auto& vertex : geometry.vertices) {
+		minimum = glm::min(minimum, vertex);
+		maximum = glm::max(maximum, vertex);
+	}
+	const auto maxError = glm::distance(minimum, maximum) * MESHSIMPLIFIER_MAX_ERROR;
+
+	// Group skinned vertices by their most influential bone, as the skinning of a collapsed vertex is lost
+	std::vector<GLuint> regions;
+	if (!geometry.boneTransforms.empty() && geometry.bones.size() == geometry.vertices.size()) {
+		regions.reserve(geometry.bones.size());
+		for (const auto& bone : geometry.bones) {
+			const auto strongest = std::max_element(std::cbegin(bone.Weights), std::cend(bone.Weights)) - std::cbegin(bone.Weights);
+			regions.push_back(bone.Weights[strongest] > 0.0F ? static_cast<GLuint>(bone.IDs[strongest]) : ~0U);
+		}
+	}
+
+	// Each level halves the one before it, so errors add up along the chain
+	geometry.lods.reserve(MESHSIMPLIFIER_LOD_COUNT);
+	float error(0.0F);
+	for (size_t level = 0ULL; level < MESHSIMPLIFIER_LOD_COUNT; ++level) {
+		const auto& source = level == 0ULL ? geometry.indices : geometry.lods.back().indices;
+		Mesh_LOD lod;
+		const auto levelError = Simplify(geometry.vertices, regions, source, (source.size() / 6ULL) * 3ULL, maxError - error, lod.indices);
+		if (lod.indices.size() * 4ULL > source.size() * 3ULL)
+			break;
+		error += levelError;
+		lod.error = error;
+		geometry.lods.push_back(std::move(lod));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef MESH_SIMPLIFIER_H
+#define MESH_SIMPLIFIER_H
+
+#include "Utilities/IO/Mesh_IO.h"
+
+
+/** Number of levels of detail generated beyond the full mesh. */
+constexpr size_t MESHSIMPLIFIER_LOD_COUNT = 3ULL;
+/** Smallest triangle count worth generating levels of detail for. */
+constexpr size_t MESHSIMPLIFIER_MIN_TRIANGLES = 256ULL;
+/** Largest error the coarsest level may reach, as a fraction of the mesh's bounding box diagonal. */
+constexpr float MESHSIMPLIFIER_MAX_ERROR = 0.05F;
+
+/** A static helper class for reducing triangle meshes with quadric error metrics, used for generating levels of detail.
+Edges are collapsed onto one of their own vertices, so every level indexes the same vertex data as the full mesh.
+Vertices on open borders, attribute seams, and skinning region borders are never moved, keeping levels free of cracks.
+Collapses that would fold the surface onto itself or flip a triangle over are rejected. */
+class Mesh_Simplifier {
+public:
+	// Public Methods
+	/** Collapse edges of a triangle list until it shrinks to a target size, or no collapse stays within an error.
+	@param	positions		the vertex positions the triangle list indexes.
+	@param	regions			optional region of each vertex, vertices touching a vertex of another region are never moved.
+	@param	indices			the triangle list to simplify.
+	@param	targetCount		the index count to reduce the triangle list to.
+	@param	maxError		the largest distance the surface may move, in model space.
+	@param	result			output triangle list, indexing the same vertices.
+	@return					the largest distance the surface moved, in model space. */
+	static float Simplify(const std::vector<glm::vec3>& positions, const std::vector<GLuint>& regions, const std::vector<GLuint>& indices, const size_t& targetCount, const float& maxError, std::vector<GLuint>& result);
+	/** Replace an indexed mesh's levels of detail with a chain of successively coarser ones.
+	@note					stops early once the mesh can no longer be reduced by much.
+	@note					skinned vertices are grouped by their most influential bone, keeping the borders between bones in place.
+	@param	geometry		the mesh to generate levels of detail for. */
+	static void Generate_LODs(Mesh_Geometry& geometry);
+};
+
+#endif // MESH_SIMPLIFIER_H
\ No newline at end of file
@@ -3,12 +3,57 @@
 #define SERIALIZER_H
 
 #include <algorithm>
+#include <cstring>
 #include <optional>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 
+/** Describes the fixed layout shared by every serialized record of a given type, where each field sits at a known offset. */
+struct Serial_Schema {
+	/** A single field within a record. */
+	struct Field {
+		/** The field's label (i.e. the variable name). */
+		std::string_view m_name;
+		/** The field's byte-offset within the record. */
+		size_t m_offset = 0ULL;
+		/** The field's byte-size, or the size of a string table index if variable. */
+		size_t m_size = 0ULL;
+		/** If true, the field holds an index into the string table rather than the value itself. */
+		bool m_variable = false;
+	};
+	/** Find a field by name.
+	@param	name			the label to search for.
+	@return					the index of the field if found, -1 otherwise. */
+	inline int findField(const std::string_view& name) const noexcept {
+		const auto fieldCount = m_fields.size();
+		for (size_t x = 0; x < fieldCount; ++x)
+			if (m_fields[x].m_name == name)
+				return static_cast<int>(x);
+		return -1;
+	}
+
+
+	/** The fields making up a record. */
+	std::vector<Field> m_fields;
+	/** Table holding the bytes of variable-sized fields. */
+	const std::vector<std::string_view>* m_strings = nullptr;
+	/** The field index of each member, in the order they are requested when de-serializing, resolved on first use. */
+	mutable std::vector<int> m_memberFields;
+};
+
+/** A read-only view of serialized data, either labeled values or a fixed-layout record described by a schema. */
+struct Serial_Data {
+	/** Pointer to the first byte. */
+	const char* m_data = nullptr;
+	/** The number of bytes viewed. */
+	size_t m_size = 0ULL;
+	/** The record's schema, or nullptr if the data holds labeled values. */
+	const Serial_Schema* m_schema = nullptr;
+};
+
 /** A utility class for serializing labeled values. */
 class Serializer {
 public:
@@ -37,39 +82,25 @@ public:
 	@param	...members		the list of value pairs to update (variadic). */
 	template <typename ...Members>
 	inline static void Deserialize_Set(const std::vector<char>& memberData, const Members& ...members) {
-		// Ensure the data buffer is valid
-		if (memberData.size()) {
-			std::map<std::string, std::vector<char>> memberMap;
-
-			// Populate map with member info from buffer data
-			constexpr static auto Fill_Member_Map = [](auto& memberMap, const auto& memberData) {
-				size_t index(0ULL), prevIndex(0ULL);
-				while (index < memberData.size()) {
-					// Get the memory structure
-					/** The underlying structure of the serialized value. */
-					struct Memory_Structure {
-						int struct_size;
-						char payload_name[MAX_NAME_CHARS]{ '\0' };
-						int payload_size;
-					};
-					const auto& memStruct = *reinterpret_cast<const Memory_Structure*>(&memberData[index]);
-					const std::string memory_payload_string(memStruct.payload_name, MAX_NAME_CHARS);
-					if (memStruct.struct_size == 0 || memory_payload_string.empty())
-						break;
-
-					// Skip getting the memory payload's data
-					// char* memory_payload_data = const_cast<char*>(&memberData[index + sizeof(Memory_Structure)]);
-					index += memStruct.struct_size;
-
-					// Insert clamped string with memory data into map
-					memberMap.insert({ memory_payload_string.c_str(), std::vector<char>(memberData.begin() + prevIndex, memberData.begin() + index) });
-					prevIndex = index;
-				}
-			};
-			Fill_Member_Map(memberMap, memberData);
-
-			// Iterate through the expected member names
-			Search_And_Assign_Members(memberMap, members...);
+		if (memberData.size())
+			Deserialize_Set(Serial_Data{ memberData.data(), memberData.size() }, members...);
+	}
+	/** De-serialize a view of serialized data into a set of labeled value pairs, without copying it.
+	@note Input values must be a std::pair<std::string, *X> where X is a pointer to the value to be assigned!
+	@param	memberData		a view of either labeled data, or a fixed-layout record and its schema.
+	@param	...members		the list of value pairs to update (variadic). */
+	template <typename ...Members>
+	inline static void Deserialize_Set(const Serial_Data& memberData, const Members& ...members) {
+		if constexpr (sizeof...(members) > 0) {
+			if (memberData.m_schema != nullptr) {
+				// Match member names against the schema once, every record of this type shares the same layout
+				auto& memberFields = memberData.m_schema->m_memberFields;
+				if (memberFields.empty())
+					memberFields = { memberData.m_schema->findField(members.first)... };
+				Assign_Record_Members(memberData, memberFields.data(), members...);
+			}
+			else if (memberData.m_size)
+				Search_And_Assign_Members(memberData, members...);
 		}
 	}
 	/** Serialize a labeled pair of data into a char buffer.
@@ -106,7 +137,16 @@ public:
 	@param	dataBuffer		a char buffer containing serialized data.
 	@return					an optional pair containing a label and value T if successful. */
 	template <class T>
-	static std::optional<std::pair<std::string, T>> Deserialize_Value(const std::vector<char>& dataBuffer) {
+	inline static std::optional<std::pair<std::string, T>> Deserialize_Value(const std::vector<char>& dataBuffer) {
+		return Deserialize_Value<T>(dataBuffer.data(), dataBuffer.size());
+	}
+	/** De-serialize a char buffer into a labeled pair of data.
+	@tparam	T				the data type to de-serialize.
+	@param	dataBuffer		pointer to serialized data.
+	@param	dataSize		the byte-size of the serialized data.
+	@return					an optional pair containing a label and value T if successful. */
+	template <class T>
+	static std::optional<std::pair<std::string, T>> Deserialize_Value(const char* dataBuffer, const size_t& dataSize) {
 		// The expected structure of the input data
 		/** The underlying structure of the serialized value. */
 		struct Memory_Structure {
@@ -117,11 +157,13 @@ public:
 		};
 
 		// Ensure the data buffer is of the expected size
-		if (dataBuffer.size() == (int)sizeof(Memory_Structure)) {
-			// Cast the memory back into the structure
-			const auto& inputData = *reinterpret_cast<const Memory_Structure*>(&dataBuffer[0]);
+		if (dataSize == sizeof(Memory_Structure)) {
+			// Copy the memory back into the structure, as the buffer may not be aligned
+			alignas(Memory_Structure) char inputStorage[sizeof(Memory_Structure)];
+			std::memcpy(inputStorage, dataBuffer, sizeof(Memory_Structure));
+			const auto& inputData = *reinterpret_cast<const Memory_Structure*>(inputStorage);
 			// Ensure internal memory size matches
-			if (dataBuffer.size() == inputData.struct_size) {
+			if (inputData.struct_size >= 0 && dataSize == static_cast<size_t>(inputData.struct_size)) {
 				const std::string name(inputData.payload_name, MAX_NAME_CHARS);
 				const T& data = *reinterpret_cast<const T*>(&inputData.payload_data[0]);
 				return { { name,data } };
@@ -133,30 +175,85 @@ public:
 
 private:
 	// Private Methods
-	/** Given a filled member-map, search for the input label and assign the mapped value.
+	/** Search labeled data for the input labels, assigning the values found in-place.
 	@tparam	<FirstMember, ...RemainingMembers>	variadic list of any value to de-serialized (auto-deducible).
-	@param	memberMap		a map of labels to serialized data.
+	@param	memberData		a view of labeled data.
 	@param	first			the first value to de-serialize.
 	@param	...rest			the rest of the values to de-serialize. */
 	template <typename FirstMember, typename ...RemainingMembers>
-	inline static void Search_And_Assign_Members(const std::map<std::string, std::vector<char>>& memberMap, FirstMember& first, RemainingMembers& ...rest) {
-		// Try to find the first member of this parameter pack in the member map
+	inline static void Search_And_Assign_Members(const Serial_Data& memberData, FirstMember& first, RemainingMembers& ...rest) {
+		// Walk the labeled values until one matches the first member of this parameter pack
 		auto& [MemberName, MemberPointer] = first;
-		const auto memberNameSpot = memberMap.find(std::string(MemberName));
-		if (memberNameSpot != memberMap.end()) {
-			// Found member, de-serialize data
-			if (const auto qwe = Deserialize_Value<typename std::remove_pointer<decltype(MemberPointer)>::type>(memberMap.at(MemberName)))
-				*MemberPointer = qwe->second; // assign it
+		size_t index(0ULL);
+		while (index + HEADER_SIZE <= memberData.m_size) {
+			int struct_size(0);
+			std::memcpy(&struct_size, &memberData.m_data[index], sizeof(int));
+			const char* payload_name = &memberData.m_data[index + sizeof(int)];
+			if (struct_size <= 0 || payload_name[0] == '\0' || index + struct_size > memberData.m_size)
+				break;
+			if (std::strlen(MemberName) <= (size_t)(MAX_NAME_CHARS) && std::strncmp(payload_name, MemberName, MAX_NAME_CHARS) == 0) {
+				// Found member, de-serialize data
+				if (const auto qwe = Deserialize_Value<typename std::remove_pointer<decltype(MemberPointer)>::type>(&memberData.m_data[index], struct_size))
+					*MemberPointer = qwe->second; // assign it
+				break;
+			}
+			index += struct_size;
+		}
+
+		// Repeat for remaining members
+		if constexpr (sizeof...(rest) > 0)
+			Search_And_Assign_Members(memberData, rest...);
+	}
+	/** Assign a value from a buffer that may not be aligned for its type.
+	@tparam	T				the data type to assign.
+	@param	destination		pointer to the value to assign.
+	@param	source			pointer to the serialized value. */
+	template <class T>
+	inline static void Assign_Unaligned(T* destination, const char* source) {
+		alignas(T) char storage[sizeof(T)];
+		std::memcpy(storage, source, sizeof(T));
+		*destination = *reinterpret_cast<const T*>(storage);
+	}
+	/** Assign a set of values from a fixed-layout record, using fields previously matched against its schema.
+	@tparam	<FirstMember, ...RemainingMembers>	variadic list of any value to de-serialized (auto-deducible).
+	@param	memberData		a view of the record and its schema.
+	@param	fields			the schema field index of each member, or -1 if absent.
+	@param	first			the first value to de-serialize.
+	@param	...rest			the rest of the values to de-serialize. */
+	template <typename FirstMember, typename ...RemainingMembers>
+	inline static void Assign_Record_Members(const Serial_Data& memberData, const int* fields, FirstMember& first, RemainingMembers& ...rest) {
+		auto& [MemberName, MemberPointer] = first;
+		using T = typename std::remove_pointer<decltype(MemberPointer)>::type;
+		if (fields[0] >= 0) {
+			const auto& field = memberData.m_schema->m_fields[fields[0]];
+			const auto* payload = &memberData.m_data[field.m_offset];
+			if (field.m_variable) {
+				// Variable-sized fields store an index into the shared string table
+				unsigned int stringIndex(0U);
+				std::memcpy(&stringIndex, payload, sizeof(unsigned int));
+				if (stringIndex < memberData.m_schema->m_strings->size()) {
+					const auto& bytes = (*memberData.m_schema->m_strings)[stringIndex];
+					if constexpr (std::is_same<T, std::string>::value)
+						*MemberPointer = std::string(bytes);
+					else if (bytes.size() == sizeof(T))
+						Assign_Unaligned(MemberPointer, bytes.data());
+				}
+			}
+			else if constexpr (std::is_same<T, std::string>::value)
+				*MemberPointer = std::string(payload, field.m_size);
+			else if (field.m_size == sizeof(T))
+				Assign_Unaligned(MemberPointer, payload);
 		}
 
 		// Repeat for remaining members
 		if constexpr (sizeof...(rest) > 0)
-			Search_And_Assign_Members(memberMap, rest...);
+			Assign_Record_Members(memberData, &fields[1], rest...);
 	}
 
 
 	// Private Variables
 	constexpr static int MAX_NAME_CHARS = 32;
+	constexpr static size_t HEADER_SIZE = sizeof(int) + MAX_NAME_CHARS + sizeof(int);
 };
 
 template <>
@@ -187,7 +284,7 @@ inline std::vector<char> Serializer::Serialize_Value(const std::string& name, co
 	return dataBuffer;
 }
 template <>
-inline std::optional<std::pair<std::string, std::string>> Serializer::Deserialize_Value(const std::vector<char>& dataBuffer) {
+inline std::optional<std::pair<std::string, std::string>> Serializer::Deserialize_Value(const char* dataBuffer, const size_t& dataSize) {
 	// The expected structure of the input data
 	/** The underlying structure of the serialized value. */
 	struct Memory_Structure {
@@ -197,11 +294,13 @@ inline std::optional<std::pair<std::string, std::string>> Serializer::Deserializ
 	};
 
 	// Ensure the data buffer is of the expected size
-	if (dataBuffer.size() >= (int)sizeof(Memory_Structure)) {
-		// Cast the memory back into the structure
-		const auto& inputData = *reinterpret_cast<const Memory_Structure*>(&dataBuffer[0]);
-		// Ensure internal memory size matches
-		if (dataBuffer.size() == inputData.struct_size) {
+	if (dataSize >= sizeof(Memory_Structure)) {
+		// Copy the memory back into the structure, as the buffer may not be aligned
+		Memory_Structure inputData;
+		std::memcpy(&inputData, dataBuffer, sizeof(Memory_Structure));
+		// Ensure internal memory size matches, and that the payload fits within it
+		if (inputData.struct_size >= 0 && dataSize == static_cast<size_t>(inputData.struct_size) &&
+			inputData.payload_size >= 0 && sizeof(Memory_Structure) + static_cast<size_t>(inputData.payload_size) <= dataSize) {
 			const std::string name(inputData.payload_name, MAX_NAME_CHARS);
 			std::string payload_string(&dataBuffer[sizeof(Memory_Structure)], inputData.payload_size);
 			return { { name, payload_string } };
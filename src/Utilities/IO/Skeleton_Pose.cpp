@@ -0,0 +1,136 @@
+#include "Utilities/IO/Skeleton_Pose.h"
+#include <algorithm>
+#include <cassert>
+#include <unordered_map>
+
+
+/** Search for a key-frame appropriate for the current animation time, starting from the key-frame used last time.
+@param	AnimationTime	the current time in the animation.
+@param	cursor			the key-frame used last time, updated to the key-frame found.
+@param	keyVector		array of at least 2 key frames.
+@return					the index of the key-frame preceding the animation time. */
+constexpr auto FindKey = [](const float& AnimationTime, size_t& cursor, const auto& keyVector) noexcept
+{
+	// Times before the first or after the last key-frame belong to the first or last pair
+	const size_t lastIndex = keyVector.size() - 2ULL;
+	const auto isWithin = [&](const size_t& i) noexcept {
+		return (i == 0ULL || static_cast<float>(keyVector[i].time) <= AnimationTime)
+			&& (i == lastIndex || AnimationTime < static_cast<float>(keyVector[i + 1ULL].time));
+	};
+
+	// Animations mostly play forward, so try the last key-frame used and the one after it
+	if (cursor <= lastIndex && isWithin(cursor))
+		return cursor;
+	if (cursor < lastIndex && isWithin(cursor + 1ULL))
+		return ++cursor;
+
+	// Otherwise the animation looped or jumped, so search the whole range
+	const auto next = std::upper_bound(keyVector.cbegin() + 1, keyVector.cend(), AnimationTime, [](const float& time, const auto& key) noexcept {
+		return time < static_cast<float>(key.time);
+		});
+	cursor = std::min<size_t>(static_cast<size_t>(std::distance(keyVector.cbegin(), next)) - 1ULL, lastIndex);
+	return cursor;
+};
+
+/** Interpolate between this key-frame, and the next one, based on the animation time.
+@param	AnimationTime	the current time in the animation.
+@param	cursor			the key-frame used last time, updated to the key-frame used now.
+@param	keyVector		array of key frames.
+@return					a new key-frame value. */
+constexpr auto InterpolateKeys = [](const float& AnimationTime, size_t& cursor, const auto& keyVector) noexcept
+{
+	const size_t& keyCount = keyVector.size();
+	assert(keyCount > 0);
+	const auto& Result = keyVector[0].value;
+	if (keyCount > 1) { // Ensure we have 2 values to interpolate between
+		const size_t Index = FindKey(AnimationTime, cursor, keyVector);
+		const auto& Key = keyVector[Index];
+		const auto& NextKey = keyVector[Index + 1ULL];
+		const float DeltaTime = static_cast<float>(NextKey.time - Key.time);
+		const float Factor = DeltaTime > 0.0F ? glm::clamp((AnimationTime - static_cast<float>(Key.time)) / DeltaTime, 0.0f, 1.0f) : 0.0F;
+		if constexpr (std::is_same<decltype(Key.value), glm::quat>::value)
+			return glm::slerp(Key.value, NextKey.value, Factor);
+		else
+			return glm::mix(Key.value, NextKey.value, Factor);
+	}
+	return Result;
+};
+
+void Skeleton_Pose::Bind(Mesh_Geometry& importedData)
+{
+	auto& skeleton = importedData.skeleton;
+	skeleton = Skeleton_Binding();
+	skeleton.inverseRootTransform = glm::inverse(importedData.rootNode.transformation);
+
+	// Flatten the hierarchy breadth-first, so every parent precedes its children
+	std::vector<const Node*> nodes{ &importedData.rootNode };
+	skeleton.parents.push_back(-1);
+	for (size_t x = 0ULL; x < nodes.size(); ++x)
+		for (const auto& child : nodes[x]->children) {
+			nodes.push_back(&child);
+			skeleton.parents.push_back(static_cast<int>(x));
+		}
+
+	// Resolve each node's bone and bind transformation
+	const auto nodeCount = nodes.size();
+	skeleton.bones.resize(nodeCount, -1);
+	skeleton.transformations.resize(nodeCount);
+	for (size_t x = 0ULL; x < nodeCount; ++x) {
+		const auto bone = importedData.boneMap.find(nodes[x]->name);
+		if (bone != importedData.boneMap.end())
+			skeleton.bones[x] = static_cast<int>(bone->second);
+		skeleton.transformations[x] = nodes[x]->transformation;
+	}
+
+	// Resolve each node's channel per animation, preferring the first channel sharing its name
+	skeleton.channels.resize(importedData.animations.size());
+	for (size_t a = 0ULL; a < importedData.animations.size(); ++a) {
+		const auto& channels = importedData.animations[a].channels;
+		std::unordered_map<std::string, int> channelMap;
+		for (size_t c = 0ULL; c < channels.size(); ++c)
+			channelMap.emplace(channels[c].nodeName, static_cast<int>(c));
+		skeleton.channels[a].resize(nodeCount, -1);
+		for (size_t x = 0ULL; x < nodeCount; ++x) {
+			const auto channel = channelMap.find(nodes[x]->name);
+			if (channel != channelMap.end())
+				skeleton.channels[a][x] = channel->second;
+		}
+	}
+}
+
+void Skeleton_Pose::Animate(std::vector<glm::mat4>& transforms, std::vector<size_t>& keyCursors, std::vector<glm::mat4>& globals, const float& AnimationTime, const size_t& animation_ID, const Mesh_Geometry& geometry)
+{
+	const auto& skeleton = geometry.skeleton;
+	const auto& pAnimation = geometry.animations[animation_ID];
+	const auto& channels = skeleton.channels[animation_ID];
+	const auto nodeCount = skeleton.parents.size();
+	globals.resize(nodeCount);
+	// Cursors from another animation are only hints, but start afresh if the skeleton changed
+	if (keyCursors.size() != nodeCount * 3ULL)
+		keyCursors.assign(nodeCount * 3ULL, 0ULL);
+
+	// Parents precede their children, so each parent's global transformation is ready before it's needed
+	for (size_t x = 0ULL; x < nodeCount; ++x) {
+		glm::mat4 NodeTransformation = skeleton.transformations[x];
+
+		// Interpolate scaling, rotation, and translation.
+		// Compose them directly, equal to translation * rotation * scaling.
+		if (channels[x] >= 0) {
+			const auto& pNodeAnim = pAnimation.channels[static_cast<size_t>(channels[x])];
+			const glm::vec3 Scaling = InterpolateKeys(AnimationTime, keyCursors[x * 3ULL], pNodeAnim.scalingKeys);
+			const glm::quat Rotation = InterpolateKeys(AnimationTime, keyCursors[x * 3ULL + 1ULL], pNodeAnim.rotationKeys);
+			const glm::vec3 Translation = InterpolateKeys(AnimationTime, keyCursors[x * 3ULL + 2ULL], pNodeAnim.positionKeys);
+
+			NodeTransformation = glm::mat4_cast(Rotation);
+			NodeTransformation[0] *= Scaling.x;
+			NodeTransformation[1] *= Scaling.y;
+			NodeTransformation[2] *= Scaling.z;
+			NodeTransformation[3] = glm::vec4(Translation, 1.0F);
+		}
+
+		const auto& parent = skeleton.parents[x];
+		globals[x] = parent < 0 ? NodeTransformation : globals[static_cast<size_t>(parent)] * NodeTransformation;
+		if (const auto& BoneIndex = skeleton.bones[x]; BoneIndex >= 0)
+			transforms[static_cast<size_t>(BoneIndex)] = skeleton.inverseRootTransform * globals[x] * geometry.boneTransforms[static_cast<size_t>(BoneIndex)];
+	}
+}
\ No newline at end of file
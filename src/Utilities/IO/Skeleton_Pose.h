@@ -0,0 +1,25 @@
+#pragma once
+#ifndef	SKELETON_POSE_H
+#define	SKELETON_POSE_H
+
+#include "Utilities/IO/Mesh_IO.h"
+
+
+/** A static helper class used for binding a model's skeleton to its animations, and posing it at a point in time. */
+class Skeleton_Pose {
+public:
+	// Public Methods
+	/** Flatten a model's node hierarchy, resolving its bones and each animation's channels to indices.
+	@param	importedData	reference to the model to bind, filling its skeleton binding. */
+	static void Bind(Mesh_Geometry& importedData);
+	/** Pose a model's bound skeleton, updating a series of transformation matrix representing the bones in the skeleton.
+	@param	transforms		matrix vector representing bones in the skeleton, at least as large as the model's bone list.
+	@param	keyCursors		the key-frames last used by each node's channel, as search hints.
+	@param	globals			scratch space for each node's global transformation.
+	@param	AnimationTime	the current time in the animation.
+	@param	animation_ID	id for the current animation to process.
+	@param	geometry		the bound model to process the animations from. */
+	static void Animate(std::vector<glm::mat4>& transforms, std::vector<size_t>& keyCursors, std::vector<glm::mat4>& globals, const float& AnimationTime, const size_t& animation_ID, const Mesh_Geometry& geometry);
+};
+
+#endif // SKELETON_POSE_H
\ No newline at end of file
@@ -6,7 +6,7 @@
 bool Text_IO::Import_Text(Engine& engine, const std::string& relativePath, std::string& importedData, const std::ios_base::openmode& mode)
 {
 	if (!Engine::File_Exists(relativePath)) {
-		engine.getManager_Messages().error("The file \"" + relativePath + "\" does not exist.");
+		engine.getManager_Messages().error("The file \"" + relativePath + "\" does not exist.", Message_Category::ASSETS);
 		return false;
 	}
 
@@ -2,6 +2,7 @@
 #ifndef MAPPEDCHAR_H
 #define MAPPEDCHAR_H
 
+#include <cstring>
 #include <map>
 #include <optional>
 #include <vector>
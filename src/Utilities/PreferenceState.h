@@ -41,6 +41,7 @@ public:
 
 		// Graphics Options
 		C_MATERIAL_SIZE,
+		C_MATERIAL_COMPRESSION,
 		C_RH_BOUNCE_SIZE,
 
 		C_SHADOW_SIZE,
@@ -60,9 +61,14 @@ public:
 		C_SSR,
 		C_FXAA,
 
+		// Physics Options
+		C_PHYSICS_STEP_RATE,
+		C_PHYSICS_MAX_STEPS,
+
 		// Editor Options
 		E_AUTOSAVE_INTERVAL,
 		E_UNDO_STACKSIZE,
+		E_UNDO_MEMORY,
 		E_OUTLINE_SCALE,
 		E_GIZMO_SCALE,
 		E_GRID_SNAP,
@@ -87,6 +93,7 @@ public:
 
 			// Graphics Options
 			"C_MATERIAL_SIZE",
+			"C_MATERIAL_COMPRESSION",
 			"C_RH_BOUNCE_SIZE",
 
 			"C_SHADOW_SIZE",
@@ -106,9 +113,14 @@ public:
 			"C_SSR",
 			"C_FXAA",
 
+			// Physics Options
+			"C_PHYSICS_STEP_RATE",
+			"C_PHYSICS_MAX_STEPS",
+
 			// Editor Options
 			"E_AUTOSAVE_INTERVAL",
 			"E_UNDO_STACKSIZE",
+			"E_UNDO_MEMORY",
 			"E_OUTLINE_SCALE",
 			"E_GIZMO_SCALE",
 			"E_GRID_SNAP",
@@ -0,0 +1,214 @@
+#include "Utilities/Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+
+/** Maximum number of zones a capture can hold, past which it stops growing. */
+constexpr size_t PROFILER_MAX_CAPTURE = 4000000ULL;
+
+/** A finished zone. */
+struct Profiler_Event {
+	const char* m_category;
+	const char* m_name;
+	std::int64_t m_begin, m_end;
+	unsigned int m_depth, m_thread;
+};
+
+/** A thread's zones, only contended when collected at the end of the frame. */
+struct Profiler_Thread {
+	std::mutex m_mutex;
+	std::vector<Profiler_Event> m_events;
+	const char* m_name = nullptr;
+	unsigned int m_id = 0U;
+	std::atomic_bool m_orphaned = false;
+};
+
+/** Every thread that has recorded zones, and the collected results. */
+static struct Profiler_State {
+	const std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+	std::mutex m_mutex;
+	std::vector<std::shared_ptr<Profiler_Thread>> m_threads;
+	unsigned int m_nextThread = 0U;
+	std::vector<Profiler_Summary> m_summary;
+	std::atomic_bool m_capturing = false;
+	std::vector<Profiler_Event> m_capture;
+	std::vector<std::pair<unsigned int, const char*>> m_captureThreads;
+} g_state;
+
+/** Retrieve the calling thread's zones, registering them if needed. */
+static Profiler_Thread& Get_Thread()
+{
+	/** Releases the calling thread's zones once the thread exits. */
+	struct Thread_Owner {
+		std::shared_ptr<Profiler_Thread> m_thread;
+		~Thread_Owner() {
+			if (m_thread)
+				m_thread->m_orphaned = true;
+		}
+	};
+	thread_local Thread_Owner t_owner;
+	if (!t_owner.m_thread) {
+		t_owner.m_thread = std::make_shared<Profiler_Thread>();
+		std::unique_lock<std::mutex> stateGuard(g_state.m_mutex);
+		t_owner.m_thread->m_id = g_state.m_nextThread++;
+		g_state.m_threads.push_back(t_owner.m_thread);
+	}
+	return *t_owner.m_thread;
+}
+
+/** Write a string as a JSON string literal. */
+static void Write_JSON_String(std::ofstream& file, const char* string)
+{
+	file << '"';
+	for (const auto* c = string != nullptr ? string : ""; *c != '\0'; ++c) {
+		if (*c == '"' || *c == '\\')
+			file << '\\';
+		file << *c;
+	}
+	file << '"';
+}
+
+/** The calling thread's current zone depth. */
+static thread_local unsigned int t_depth = 0U;
+
+std::int64_t Profiler::Get_Time() noexcept
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_state.m_start).count();
+}
+
+void Profiler::Set_Thread_Name(const char* name)
+{
+	auto& thread = Get_Thread();
+	std::unique_lock<std::mutex> threadGuard(thread.m_mutex);
+	thread.m_name = name;
+}
+
+void Profiler::Record_Zone(const char* category, const char* name, const std::int64_t& begin, const std::int64_t& end, const unsigned int& depth)
+{
+	auto& thread = Get_Thread();
+	std::unique_lock<std::mutex> threadGuard(thread.m_mutex);
+	thread.m_events.push_back({ category, name, begin, end, depth, thread.m_id });
+}
+
+void Profiler::New_Frame()
+{
+	std::unique_lock<std::mutex> stateGuard(g_state.m_mutex);
+	const bool capturing = g_state.m_capturing;
+
+	// Swap out each thread's zones, holding its lock only briefly
+	std::map<std::pair<const char*, const char*>, Profiler_Summary> zones;
+	std::vector<Profiler_Event> events;
+	for (const auto& thread : g_state.m_threads) {
+		events.clear();
+		{
+			std::unique_lock<std::mutex> threadGuard(thread->m_mutex);
+			std::swap(events, thread->m_events);
+			if (capturing && thread->m_name != nullptr
+				&& std::find(g_state.m_captureThreads.cbegin(), g_state.m_captureThreads.cend(), std::make_pair(thread->m_id, thread->m_name)) == g_state.m_captureThreads.cend())
+				g_state.m_captureThreads.emplace_back(thread->m_id, thread->m_name);
+		}
+		for (const auto& event : events) {
+			auto& zone = zones[{ event.m_category, event.m_name }];
+			zone.m_category = event.m_category;
+			zone.m_name = event.m_name;
+			zone.m_calls++;
+			zone.m_milliseconds += static_cast<double>(event.m_end - event.m_begin) / 1000000.0;
+		}
+		if (capturing) {
+			const auto count = std::min<size_t>(events.size(), PROFILER_MAX_CAPTURE - std::min<size_t>(PROFILER_MAX_CAPTURE, g_state.m_capture.size()));
+			g_state.m_capture.insert(g_state.m_capture.end(), events.cbegin(), events.cbegin() + static_cast<std::ptrdiff_t>(count));
+		}
+	}
+
+	// Forget threads that have exited, now that their last zones are collected
+	g_state.m_threads.erase(std::remove_if(g_state.m_threads.begin(), g_state.m_threads.end(), [](const auto& thread) {
+		return thread->m_orphaned && thread->m_events.empty();
+		}), g_state.m_threads.end());
+
+	g_state.m_summary.clear();
+	for (const auto& zone : zones)
+		g_state.m_summary.push_back(zone.second);
+	std::sort(g_state.m_summary.begin(), g_state.m_summary.end(), [](const auto& a, const auto& b) noexcept {
+		return a.m_milliseconds > b.m_milliseconds;
+		});
+}
+
+std::vector<Profiler_Summary> Profiler::Get_Frame_Summary()
+{
+	std::unique_lock<std::mutex> stateGuard(g_state.m_mutex);
+	return g_state.m_summary;
+}
+
+void Profiler::Begin_Capture()
+{
+	std::unique_lock<std::mutex> stateGuard(g_state.m_mutex);
+	g_state.m_capture.clear();
+	g_state.m_captureThreads.clear();
+	g_state.m_capturing = true;
+}
+
+bool Profiler::Is_Capturing() noexcept
+{
+	return g_state.m_capturing;
+}
+
+bool Profiler::End_Capture(const std::string& fullPath)
+{
+	// Collect whatever was recorded since the last frame too
+	New_Frame();
+	std::vector<Profiler_Event> capture;
+	std::vector<std::pair<unsigned int, const char*>> captureThreads;
+	{
+		std::unique_lock<std::mutex> stateGuard(g_state.m_mutex);
+		g_state.m_capturing = false;
+		std::swap(capture, g_state.m_capture);
+		std::swap(captureThreads, g_state.m_captureThreads);
+	}
+
+	std::ofstream file(fullPath, std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+		return false;
+
+	// Timestamps are in microseconds, with nanosecond precision kept in the fraction
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	bool first = true;
+	for (const auto& [threadID, name] : captureThreads) {
+		file << (first ? "\n" : ",\n") << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":" << threadID << ",\"args\":{\"name\":";
+		Write_JSON_String(file, name);
+		file << "}}";
+		first = false;
+	}
+	file.precision(3);
+	file << std::fixed;
+	for (const auto& event : capture) {
+		file << (first ? "\n" : ",\n") << "{\"ph\":\"X\",\"pid\":0,\"tid\":" << event.m_thread << ",\"cat\":";
+		Write_JSON_String(file, event.m_category);
+		file << ",\"name\":";
+		Write_JSON_String(file, event.m_name);
+		file << ",\"ts\":" << static_cast<double>(event.m_begin) / 1000.0 << ",\"dur\":" << static_cast<double>(event.m_end - event.m_begin) / 1000.0
+			<< ",\"args\":{\"depth\":" << event.m_depth << "}}";
+		first = false;
+	}
+	file << "\n]}\n";
+	return file.good();
+}
+
+Profiler_Zone::~Profiler_Zone()
+{
+	--t_depth;
+	Profiler::Record_Zone(m_category, m_name, m_begin, Profiler::Get_Time(), m_depth);
+}
+
+Profiler_Zone::Profiler_Zone(const char* category, const char* name) noexcept :
+	m_category(category),
+	m_name(name),
+	m_begin(Profiler::Get_Time()),
+	m_depth(t_depth++)
+{
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+#define PROFILER_CONCAT_INNER(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_INNER(a, b)
+#ifdef PROFILER_ENABLED
+/** Time the rest of the enclosing scope as a named zone. */
+#define PROFILE_ZONE(category, name) const Profiler_Zone PROFILER_CONCAT(profilerZone, __LINE__)(category, name)
+#else
+#define PROFILE_ZONE(category, name) static_cast<void>(0)
+#endif
+
+/** Time spent in a zone over a frame, summed across every thread. */
+struct Profiler_Summary {
+	const char* m_category = nullptr;
+	const char* m_name = nullptr;
+	size_t m_calls = 0ULL;
+	double m_milliseconds = 0.0;
+};
+
+/** A static helper class for recording timed zones, summarizing them per frame and capturing them as Chrome traces. */
+class Profiler {
+public:
+	// Public Methods
+	/** Retrieve the time since the profiler started.
+	@return						the time in nanoseconds. */
+	static std::int64_t Get_Time() noexcept;
+	/** Name the calling thread, for labeling it in captures.
+	@param	name				the thread name, which must outlive the profiler. */
+	static void Set_Thread_Name(const char* name);
+	/** Record a finished zone on the calling thread.
+	@param	category			the zone category, which must outlive the profiler.
+	@param	name				the zone name, which must outlive the profiler.
+	@param	begin				the time the zone began.
+	@param	end					the time the zone ended.
+	@param	depth				how many zones the zone was nested within. */
+	static void Record_Zone(const char* category, const char* name, const std::int64_t& begin, const std::int64_t& end, const unsigned int& depth);
+	/** Collect every thread's zones into the last frame's summary, and into the capture if one is running. */
+	static void New_Frame();
+	/** Retrieve the zones recorded over the last frame.
+	@return						the zone summaries, slowest first. */
+	static std::vector<Profiler_Summary> Get_Frame_Summary();
+	/** Start recording every zone for a capture. */
+	static void Begin_Capture();
+	/** Check if a capture is being recorded.
+	@return						true if capturing, false otherwise. */
+	static bool Is_Capturing() noexcept;
+	/** Stop recording the capture and write it in the Chrome trace_event format.
+	@param	fullPath			the absolute path to write the trace to.
+	@return						true if the trace was written, false otherwise. */
+	static bool End_Capture(const std::string& fullPath);
+};
+
+/** Times its own lifetime, recording it as a zone on destruction. */
+class Profiler_Zone {
+public:
+	// Public (De)Constructors
+	/** Record the zone.*/
+	~Profiler_Zone();
+	/** Begin a zone.
+	@param	category			the zone category, which must outlive the profiler.
+	@param	name				the zone name, which must outlive the profiler. */
+	Profiler_Zone(const char* category, const char* name) noexcept;
+	/** Disallow zone move constructor. */
+	Profiler_Zone(Profiler_Zone&&) noexcept = delete;
+	/** Disallow zone copy constructor. */
+	Profiler_Zone(const Profiler_Zone&) noexcept = delete;
+	/** Disallow zone move assignment. */
+	Profiler_Zone& operator =(Profiler_Zone&&) noexcept = delete;
+	/** Disallow zone copy assignment. */
+	Profiler_Zone& operator =(const Profiler_Zone&) noexcept = delete;
+
+
+private:
+	// Private Attributes
+	const char* m_category;
+	const char* m_name;
+	std::int64_t m_begin;
+	unsigned int m_depth;
+};
+
+#endif // PROFILER_H
\ No newline at end of file
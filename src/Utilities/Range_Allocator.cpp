@@ -0,0 +1,186 @@
+#include "Utilities/Range_Allocator.h"
+#include <iterator>
+
+
+Range_Allocator::Range_Allocator(const size_t& capacity)
+{
+	grow(capacity);
+}
+
+bool Range_Allocator::allocate(const size_t& size, size_t& offset)
+{
+	if (size == 0ULL)
+		return false;
+
+	// Best fit within the range's own size class, otherwise the smallest range in any larger class
+	for (auto sizeClass = Size_Class(size); sizeClass < m_sizeClasses.size(); ++sizeClass) {
+		auto& ranges = m_sizeClasses[sizeClass];
+		const auto candidate = ranges.lower_bound({ size, 0ULL });
+		if (candidate == ranges.end())
+			continue;
+
+		// Take the front of the free range, returning the remainder
+		const auto [freeSize, freeOffset] = *candidate;
+		removeFree(m_free.find(freeOffset));
+		if (freeSize > size)
+			addFree(freeOffset + size, freeSize - size);
+		m_allocated.emplace(freeOffset, size);
+		m_used += size;
+		offset = freeOffset;
+		return true;
+	}
+	return false;
+}
+
+void Range_Allocator::release(const size_t& offset)
+{
+	const auto spot = m_allocated.find(offset);
+	if (spot == m_allocated.end())
+		return;
+	const auto size = spot->second;
+	m_allocated.erase(spot);
+	m_used -= size;
+	addFree(offset, size);
+}
+
+void Range_Allocator::grow(const size_t& capacity)
+{
+	if (capacity <= m_capacity)
+		return;
+	const auto oldCapacity = m_capacity;
+	m_capacity = capacity;
+	addFree(oldCapacity, capacity - oldCapacity);
+}
+
+bool Range_Allocator::shrink(const size_t& capacity)
+{
+	if (capacity >= m_capacity || end() > capacity)
+		return false;
+
+	// The tail is one free range, as free neighbours always merge
+	const auto tail = std::prev(m_free.end());
+	const auto tailOffset = tail->first;
+	removeFree(tail);
+	m_capacity = capacity;
+	if (tailOffset < capacity)
+		addFree(tailOffset, capacity - tailOffset);
+	return true;
+}
+
+bool Range_Allocator::defragment(const size_t& maxSize, size_t& from, size_t& to, size_t& size)
+{
+	if (m_allocated.empty() || m_free.empty())
+		return false;
+
+	// Move the last range that fits into the lowest gap before it, so free space gathers at the end of the buffer
+	// Walk back past ranges too large to move or without a gap to fit in, as ranges before them may still move
+	// Ranges before the first gap are already packed, and nothing can be larger than the largest gap
+	const auto firstGap = m_free.cbegin()->first;
+	const auto largestGap = largestFree();
+	for (auto range = m_allocated.crbegin(); range != m_allocated.crend() && range->first > firstGap; ++range) {
+		const auto [rangeOffset, rangeSize] = *range;
+		if (rangeSize > maxSize || rangeSize > largestGap)
+			continue;
+		for (const auto [freeOffset, freeSize] : m_free) {
+			if (freeOffset >= rangeOffset)
+				break;
+			if (freeSize >= rangeSize) {
+				from = rangeOffset;
+				size = rangeSize;
+				release(rangeOffset);
+				// Re-find the gap, as releasing the range may have merged into it, invalidating this loop
+				const auto gap = m_free.find(freeOffset);
+				const auto gapSize = gap->second;
+				removeFree(gap);
+				if (gapSize > rangeSize)
+					addFree(freeOffset + rangeSize, gapSize - rangeSize);
+				m_allocated.emplace(freeOffset, rangeSize);
+				m_used += rangeSize;
+				to = freeOffset;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void Range_Allocator::clear() noexcept
+{
+	m_free.clear();
+	for (auto& sizeClass : m_sizeClasses)
+		sizeClass.clear();
+	m_allocated.clear();
+	m_used = 0ULL;
+	const auto capacity = m_capacity;
+	m_capacity = 0ULL;
+	grow(capacity);
+}
+
+size_t Range_Allocator::capacity() const noexcept
+{
+	return m_capacity;
+}
+
+size_t Range_Allocator::used() const noexcept
+{
+	return m_used;
+}
+
+size_t Range_Allocator::end() const noexcept
+{
+	if (m_allocated.empty())
+		return 0ULL;
+	const auto& [offset, size] = *m_allocated.crbegin();
+	return offset + size;
+}
+
+size_t Range_Allocator::freeRangeCount() const noexcept
+{
+	return m_free.size();
+}
+
+void Range_Allocator::addFree(size_t offset, size_t size)
+{
+	if (size == 0ULL)
+		return;
+
+	// Merge with the free range after this one
+	if (const auto next = m_free.find(offset + size); next != m_free.end()) {
+		size += next->second;
+		removeFree(next);
+	}
+	// Merge with the free range before this one
+	if (auto next = m_free.lower_bound(offset); next != m_free.begin()) {
+		const auto previous = std::prev(next);
+		if (previous->first + previous->second == offset) {
+			offset = previous->first;
+			size += previous->second;
+			removeFree(previous);
+		}
+	}
+	m_free.emplace(offset, size);
+	m_sizeClasses[Size_Class(size)].emplace(size, offset);
+}
+
+void Range_Allocator::removeFree(const std::map<size_t, size_t>::iterator& spot)
+{
+	const auto [offset, size] = *spot;
+	m_sizeClasses[Size_Class(size)].erase({ size, offset });
+	m_free.erase(spot);
+}
+
+size_t Range_Allocator::largestFree() const noexcept
+{
+	for (auto sizeClass = m_sizeClasses.crbegin(); sizeClass != m_sizeClasses.crend(); ++sizeClass)
+		if (!sizeClass->empty())
+			return sizeClass->crbegin()->first;
+	return 0ULL;
+}
+
+size_t Range_Allocator::Size_Class(const size_t& size) noexcept
+{
+	size_t sizeClass(0ULL);
+	for (auto remainder = size; remainder > 1ULL; remainder >>= 1ULL)
+		++sizeClass;
+	return sizeClass;
+}
\ No newline at end of file
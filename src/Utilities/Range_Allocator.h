@@ -0,0 +1,90 @@
+#pragma once
+#ifndef RANGE_ALLOCATOR_H
+#define RANGE_ALLOCATOR_H
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <set>
+
+
+/** Sub-allocates ranges out of a larger buffer, without touching the buffer itself.
+Free ranges are kept in size-class lists for allocation and coalesced with their neighbours when released.
+Sizes and offsets are in whatever unit the caller uses, such as vertices or indices. */
+class Range_Allocator {
+public:
+	// Public (De)Constructors
+	/** Construct an allocator over a buffer.
+	@param	capacity	the size of the buffer. */
+	explicit Range_Allocator(const size_t& capacity = 0ULL);
+
+
+	// Public Methods
+	/** Find room for a range, using the smallest free range that fits.
+	@param	size		the size of the range, must be greater than 0.
+	@param	offset		reference updated with the range's offset.
+	@return				true if the range was allocated, false if the buffer must grow first. */
+	bool allocate(const size_t& size, size_t& offset);
+	/** Return a previously allocated range.
+	@param	offset		the offset of the range to free. */
+	void release(const size_t& offset);
+	/** Extend the end of the buffer, the new space becoming free.
+	@param	capacity	the new size of the buffer, no smaller than the current size. */
+	void grow(const size_t& capacity);
+	/** Cut the end of the buffer down, only if nothing is allocated past the new end.
+	@param	capacity	the new size of the buffer.
+	@return				true if the buffer was shrunk, false otherwise. */
+	bool shrink(const size_t& capacity);
+	/** Plan a single defragmentation step, moving the last allocated range that can move into the first gap before it that fits.
+	The move is applied to the allocator immediately, the caller must copy the contents to match.
+	@param	maxSize		the largest range that may be moved.
+	@param	from		reference updated with the range's old offset.
+	@param	to			reference updated with the range's new offset.
+	@param	size		reference updated with the range's size.
+	@return				true if a range was moved, false if nothing suitable could be moved. */
+	bool defragment(const size_t& maxSize, size_t& from, size_t& to, size_t& size);
+	/** Free every range. */
+	void clear() noexcept;
+	/** Retrieve the size of the buffer.
+	@return				the buffer capacity. */
+	size_t capacity() const noexcept;
+	/** Retrieve the total size of all allocated ranges.
+	@return				the amount of the buffer in use. */
+	size_t used() const noexcept;
+	/** Retrieve the end of the last allocated range.
+	@return				the offset past the last allocated range. */
+	size_t end() const noexcept;
+	/** Retrieve the number of separate free ranges.
+	@return				the free range count. */
+	size_t freeRangeCount() const noexcept;
+
+
+private:
+	// Private Methods
+	/** Add a free range, merging it with any free neighbours.
+	@param	offset		the offset of the range.
+	@param	size		the size of the range. */
+	void addFree(size_t offset, size_t size);
+	/** Remove a free range from the lookup structures.
+	@param	spot		the free range to remove. */
+	void removeFree(const std::map<size_t, size_t>::iterator& spot);
+	/** Retrieve the size of the largest free range.
+	@return				the largest free range's size, 0 if there are none. */
+	size_t largestFree() const noexcept;
+	/** Retrieve the size class of a range.
+	@param	size		the size of the range.
+	@return				the index of the size class. */
+	static size_t Size_Class(const size_t& size) noexcept;
+
+
+	// Private Attributes
+	/** Free ranges ordered by offset, for coalescing. */
+	std::map<size_t, size_t> m_free;
+	/** Free ranges as (size, offset) pairs, split into power-of-two size classes. */
+	std::array<std::set<std::pair<size_t, size_t>>, 64> m_sizeClasses;
+	/** Allocated ranges ordered by offset. */
+	std::map<size_t, size_t> m_allocated;
+	size_t m_capacity = 0ULL, m_used = 0ULL;
+};
+
+#endif // RANGE_ALLOCATOR_H
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "Test.h"
+#include "Utilities/BVH.h"
+#include "glm/gtc/matrix_transform.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+
+/** Fraction of a box's size the tree pads its leaves by, mirrored here to predict each leaf's bounds. */
+constexpr float LEAF_MARGIN = 0.1F;
+
+/** A box being tracked by the tree, along with the padded bounds its leaf should hold. */
+struct Tracked_Box {
+	glm::vec3 min, max, leafMin, leafMax;
+	int leaf = -1;
+};
+
+/** Make a random box, scattered across a wide and fairly flat level. */
+static void Random_Box(std::mt19937& random, Tracked_Box& box)
+{
+	std::uniform_real_distribution<float> position(-1000.0F, 1000.0F), size(0.5F, 10.0F);
+	const glm::vec3 center(position(random), position(random) * 0.1F, position(random));
+	const glm::vec3 extent(size(random), size(random), size(random));
+	box.min = center - extent;
+	box.max = center + extent;
+}
+
+/** Record the padded bounds the tree gives a box when it (re)inserts its leaf. */
+static void Fatten(Tracked_Box& box)
+{
+	const auto margin = (box.max - box.min) * LEAF_MARGIN;
+	box.leafMin = box.min - margin;
+	box.leafMax = box.max + margin;
+}
+
+/** Make a random camera within the level, looking roughly along the ground. */
+static glm::mat4 Random_Camera(std::mt19937& random, const float& farPlane)
+{
+	std::uniform_real_distribution<float> position(-1000.0F, 1000.0F), angle(-3.14159F, 3.14159F);
+	const glm::vec3 eye(position(random), 5.0F, position(random));
+	const auto yaw = angle(random), pitch = angle(random) * 0.2F;
+	const glm::vec3 forward(std::cos(pitch) * std::sin(yaw), std::sin(pitch), -std::cos(pitch) * std::cos(yaw));
+	return glm::perspective(glm::radians(70.0F), 16.0F / 9.0F, 0.5F, farPlane) * glm::lookAt(eye, eye + forward, glm::vec3(0, 1, 0));
+}
+
+/** Classify a box by transforming its corners into clip space, checking every one against each plane the frustum keeps. */
+static Frustum::Containment Clip_Space_Test(const glm::mat4& pvMatrix, const glm::vec3& min, const glm::vec3& max)
+{
+	bool inside = true;
+	for (int plane = 0; plane < 5; ++plane) {
+		int behind = 0;
+		for (int corner = 0; corner < 8; ++corner) {
+			const glm::vec4 point((corner & 1) ? max.x : min.x, (corner & 2) ? max.y : min.y, (corner & 4) ? max.z : min.z, 1.0F);
+			const auto clip = pvMatrix * point;
+			const float distances[5] = { clip.w + clip.x, clip.w - clip.x, clip.w + clip.y, clip.w - clip.y, clip.w - clip.z };
+			if (distances[plane] < 0.0F)
+				++behind;
+		}
+		if (behind == 8)
+			return Frustum::Containment::OUTSIDE;
+		if (behind != 0)
+			inside = false;
+	}
+	return inside ? Frustum::Containment::INSIDE : Frustum::Containment::INTERSECTS;
+}
+
+/** Check that a frustum classifies boxes the same way as testing their corners in clip space. */
+static void Test_Frustum()
+{
+	std::mt19937 random(21U);
+	size_t mismatches(0ULL), counts[3] = { 0ULL, 0ULL, 0ULL };
+	for (int c = 0; c < 64; ++c) {
+		const auto pvMatrix = Random_Camera(random, 500.0F);
+		const Frustum frustum(pvMatrix);
+		for (int b = 0; b < 2000; ++b) {
+			Tracked_Box box;
+			Random_Box(random, box);
+			const auto expected = Clip_Space_Test(pvMatrix, box.min, box.max);
+			if (frustum.test(box.min, box.max) != expected)
+				++mismatches;
+			++counts[static_cast<int>(expected)];
+		}
+	}
+	// Boxes sitting within a rounding error of a plane may land either side of it
+	TEST_CHECK(mismatches <= 4ULL);
+	TEST_CHECK(counts[0] != 0ULL && counts[1] != 0ULL && counts[2] != 0ULL);
+
+	// The default frustum contains everything
+	TEST_CHECK(Frustum().test(glm::vec3(-1e6F), glm::vec3(1e6F)) == Frustum::Containment::INSIDE);
+}
+
+/** Collect the user data of every leaf a query visits, sorted. */
+static std::vector<size_t> Query(const BVH& bvh, const Frustum& frustum)
+{
+	std::vector<size_t> visible;
+	bvh.query(frustum, [&visible](const size_t& userData) { visible.push_back(userData); });
+	std::sort(visible.begin(), visible.end());
+	return visible;
+}
+
+/** Check the visible set of a tree against testing every box one by one, after moving, removing and re-inserting boxes. */
+static void Test_Visibility()
+{
+	std::mt19937 random(22U);
+	std::uniform_real_distribution<float> nudge(-5.0F, 5.0F);
+	BVH bvh;
+	std::vector<Tracked_Box> boxes(10000ULL);
+	for (size_t i = 0ULL; i < boxes.size(); ++i) {
+		Random_Box(random, boxes[i]);
+		Fatten(boxes[i]);
+		boxes[i].leaf = bvh.insert(boxes[i].min, boxes[i].max, i);
+	}
+	TEST_CHECK(bvh.size() == boxes.size());
+
+	for (int round = 0; round < 8; ++round) {
+		// Nudge most boxes a little, and teleport a few
+		for (size_t i = 0ULL; i < boxes.size(); ++i) {
+			auto& box = boxes[i];
+			if (i % 3ULL == 0ULL)
+				continue;
+			if (i % 50ULL == static_cast<size_t>(round))
+				Random_Box(random, box);
+			else {
+				const glm::vec3 offset(nudge(random) * 0.1F, 0.0F, nudge(random) * 0.1F);
+				box.min += offset;
+				box.max += offset;
+			}
+			if (bvh.update(box.leaf, box.min, box.max))
+				Fatten(box);
+		}
+		// Remove and re-insert others, reusing the freed leaves
+		for (size_t i = static_cast<size_t>(round); i < boxes.size(); i += 17ULL) {
+			bvh.remove(boxes[i].leaf);
+			Fatten(boxes[i]);
+			boxes[i].leaf = bvh.insert(boxes[i].min, boxes[i].max, i);
+		}
+		TEST_CHECK(bvh.size() == boxes.size());
+
+		for (int c = 0; c < 16; ++c) {
+			const Frustum frustum(Random_Camera(random, 500.0F));
+			const auto visible = Query(bvh, frustum);
+			TEST_CHECK(std::adjacent_find(visible.begin(), visible.end()) == visible.end());
+
+			// Leaves are found by their padded bounds, so the tree returns exactly the boxes whose padded bounds are visible
+			std::vector<size_t> expected;
+			for (size_t i = 0ULL; i < boxes.size(); ++i) {
+				const auto& box = boxes[i];
+				if (frustum.test(box.leafMin, box.leafMax) != Frustum::Containment::OUTSIDE)
+					expected.push_back(i);
+				// Which must include every box that is itself visible
+				if (frustum.test(box.min, box.max) != Frustum::Containment::OUTSIDE)
+					TEST_CHECK(std::binary_search(visible.begin(), visible.end(), i));
+			}
+			TEST_CHECK(visible == expected);
+		}
+	}
+
+	// A frustum containing everything finds every box once
+	const auto all = Query(bvh, Frustum());
+	TEST_CHECK(all.size() == boxes.size());
+	for (size_t i = 0ULL; i < all.size(); ++i)
+		TEST_CHECK(all[i] == i);
+
+	bvh.clear();
+	TEST_CHECK(bvh.size() == 0ULL && Query(bvh, Frustum()).empty());
+}
+
+/** Check that the tree stays shallow when boxes arrive in order, and as they are churned through. */
+static void Test_Balance()
+{
+	std::mt19937 random(23U);
+	constexpr size_t count = 4096ULL;
+	const auto bound = [](const size_t& leafCount) {
+		// Height balanced trees stay within about 1.44 log2(n), leaving some slack for the surface area heuristic
+		return static_cast<int>(std::ceil(1.5 * std::log2(static_cast<double>(std::max<size_t>(leafCount, 2ULL))))) + 2;
+	};
+
+	// Boxes inserted along a line would make a list of an unbalanced tree
+	BVH bvh;
+	std::vector<int> leaves(count);
+	for (size_t i = 0ULL; i < count; ++i) {
+		const glm::vec3 min(static_cast<float>(i) * 2.0F, 0.0F, 0.0F);
+		leaves[i] = bvh.insert(min, min + glm::vec3(1.0F), i);
+	}
+	TEST_CHECK(bvh.getHeight() <= bound(bvh.size()));
+
+	// Remove half at random, move the rest far away, then insert them again
+	std::vector<size_t> order(count);
+	for (size_t i = 0ULL; i < count; ++i)
+		order[i] = i;
+	std::shuffle(order.begin(), order.end(), random);
+	for (size_t i = 0ULL; i < count / 2ULL; ++i)
+		bvh.remove(leaves[order[i]]);
+	TEST_CHECK(bvh.size() == count / 2ULL && bvh.getHeight() <= bound(bvh.size()));
+	for (size_t i = count / 2ULL; i < count; ++i) {
+		const glm::vec3 min(static_cast<float>(i), 500.0F, static_cast<float>(i % 64ULL) * 2.0F);
+		bvh.update(leaves[order[i]], min, min + glm::vec3(1.0F));
+	}
+	TEST_CHECK(bvh.getHeight() <= bound(bvh.size()));
+	for (size_t i = 0ULL; i < count / 2ULL; ++i) {
+		const glm::vec3 min(static_cast<float>(i) * 2.0F, 0.0F, 0.0F);
+		leaves[order[i]] = bvh.insert(min, min + glm::vec3(1.0F), order[i]);
+	}
+	TEST_CHECK(bvh.size() == count && bvh.getHeight() <= bound(bvh.size()));
+	std::printf("Height of %zu leaves after churn: %d (bound %d)\n", bvh.size(), bvh.getHeight(), bound(bvh.size()));
+}
+
+/** Compare the time taken to cull a scene against many cameras with the tree, against testing every box. */
+static void Test_Throughput()
+{
+	for (const size_t count : { 10000ULL, 100000ULL }) {
+		std::mt19937 random(24U);
+		BVH bvh;
+		std::vector<Tracked_Box> boxes(count);
+		for (size_t i = 0ULL; i < count; ++i) {
+			Random_Box(random, boxes[i]);
+			boxes[i].leaf = bvh.insert(boxes[i].min, boxes[i].max, i);
+		}
+
+		constexpr int cameras = 256;
+		std::vector<Frustum> frustums;
+		for (int c = 0; c < cameras; ++c)
+			frustums.emplace_back(Random_Camera(random, 500.0F));
+		size_t treeVisible(0ULL), bruteVisible(0ULL);
+		const auto start = std::chrono::steady_clock::now();
+		for (const auto& frustum : frustums)
+			bvh.query(frustum, [&treeVisible](const size_t&) { ++treeVisible; });
+		const auto middle = std::chrono::steady_clock::now();
+		for (const auto& frustum : frustums)
+			for (const auto& box : boxes)
+				if (frustum.test(box.min, box.max) != Frustum::Containment::OUTSIDE)
+					++bruteVisible;
+		const auto end = std::chrono::steady_clock::now();
+		TEST_CHECK(treeVisible >= bruteVisible);
+
+		const auto treeTime = std::chrono::duration<double, std::micro>(middle - start).count() / cameras;
+		const auto bruteTime = std::chrono::duration<double, std::micro>(end - middle).count() / cameras;
+		std::printf("%zu boxes, %d cameras: %zu visible per camera, BVH %.1f us, brute force %.1f us per camera\n", count, cameras, bruteVisible / cameras, treeTime, bruteTime);
+	}
+}
+
+int main()
+{
+	Test_Frustum();
+	Test_Visibility();
+	Test_Balance();
+	Test_Throughput();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "Test.h"
+#include "Utilities/IO/Block_Compression.h"
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+
+
+/** Largest error allowed in the colors of a gradient, as every block shares one 5:6:5 color line and channels running against each other land off it. */
+constexpr int COLOR_ERROR_BOUND = 16;
+/** Largest error allowed in single channel blocks, which get 8 values between their own 8-bit end points. */
+constexpr int CHANNEL_ERROR_BOUND = 4;
+/** Largest error allowed in solid colors, from rounding to 5:6:5. */
+constexpr int SOLID_ERROR_BOUND = 4;
+
+/** Retrieve the largest difference between two images in any of the given channels. */
+static int Max_Error(const std::vector<GLubyte>& expected, const std::vector<GLubyte>& actual, const int& firstChannel, const int& channelCount)
+{
+	int error = 0;
+	for (size_t p = 0ULL; p + 3ULL < expected.size() && p + 3ULL < actual.size(); p += 4ULL)
+		for (int c = firstChannel; c < firstChannel + channelCount; ++c)
+			error = std::max(error, std::abs(static_cast<int>(expected[p + static_cast<size_t>(c)]) - static_cast<int>(actual[p + static_cast<size_t>(c)])));
+	return error;
+}
+
+/** Make an image with a smooth ramp in every channel, with a little noise on top. */
+static std::vector<GLubyte> Make_Gradient(const glm::ivec2& dimensions, std::mt19937& random)
+{
+	std::vector<GLubyte> pixels(static_cast<size_t>(dimensions.x) * static_cast<size_t>(dimensions.y) * 4ULL);
+	for (int y = 0; y < dimensions.y; ++y)
+		for (int x = 0; x < dimensions.x; ++x) {
+			auto* pixel = &pixels[(static_cast<size_t>(y) * static_cast<size_t>(dimensions.x) + static_cast<size_t>(x)) * 4ULL];
+			const int noise = static_cast<int>(random() % 3U) - 1;
+			pixel[0] = static_cast<GLubyte>(std::clamp(x * 4 + noise, 0, 255));
+			pixel[1] = static_cast<GLubyte>(std::clamp(y * 4 + noise, 0, 255));
+			pixel[2] = static_cast<GLubyte>(std::clamp(128 + (x - y) * 2, 0, 255));
+			pixel[3] = static_cast<GLubyte>(std::clamp(255 - (x + y) * 3, 0, 255));
+		}
+	return pixels;
+}
+
+/** Check how far gradients drift for every format and image size, including sizes whose edge blocks overhang the image. */
+static void Test_Gradients()
+{
+	std::mt19937 random(11U);
+	for (const auto& dimensions : { glm::ivec2(64, 64), glm::ivec2(1, 1), glm::ivec2(2, 3), glm::ivec2(5, 3), glm::ivec2(13, 7), glm::ivec2(7, 13) }) {
+		const auto pixels = Make_Gradient(dimensions, random);
+		const auto expectedBytes = static_cast<size_t>((dimensions.x + 3) / 4) * static_cast<size_t>((dimensions.y + 3) / 4);
+		for (const auto& format : { Texture_Format::BC1, Texture_Format::BC3, Texture_Format::BC5 }) {
+			const auto blocks = Block_Compression::Compress_Image(pixels.data(), dimensions, format);
+			TEST_CHECK(blocks.size() == expectedBytes * Block_Compression::Get_Block_Size(format));
+			const auto result = Block_Compression::Decompress_Image(blocks.data(), dimensions, format);
+			TEST_CHECK(result.size() == pixels.size());
+			switch (format) {
+			case Texture_Format::BC1:
+				// Opaque blocks must stay in 4 color mode, never decoding to transparent black
+				TEST_CHECK(Max_Error(pixels, result, 0, 3) <= COLOR_ERROR_BOUND);
+				for (size_t p = 3ULL; p < result.size(); p += 4ULL)
+					TEST_CHECK(result[p] == 255U);
+				break;
+			case Texture_Format::BC3:
+				TEST_CHECK(Max_Error(pixels, result, 0, 3) <= COLOR_ERROR_BOUND);
+				TEST_CHECK(Max_Error(pixels, result, 3, 1) <= CHANNEL_ERROR_BOUND);
+				break;
+			case Texture_Format::BC5:
+				TEST_CHECK(Max_Error(pixels, result, 0, 2) <= CHANNEL_ERROR_BOUND);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
+
+/** Check that blocks of a single color come back as that color, up to the 5:6:5 precision of color blocks. */
+static void Test_Solid()
+{
+	std::mt19937 random(12U);
+	const glm::ivec2 dimensions(9, 6);
+	for (int i = 0; i < 64; ++i) {
+		const GLubyte color[4] = { static_cast<GLubyte>(random()), static_cast<GLubyte>(random()), static_cast<GLubyte>(random()), static_cast<GLubyte>(random()) };
+		std::vector<GLubyte> pixels(static_cast<size_t>(dimensions.x) * static_cast<size_t>(dimensions.y) * 4ULL);
+		for (size_t p = 0ULL; p < pixels.size(); ++p)
+			pixels[p] = color[p % 4ULL];
+		for (const auto& format : { Texture_Format::BC1, Texture_Format::BC3, Texture_Format::BC5 }) {
+			const auto result = Block_Compression::Decompress_Image(Block_Compression::Compress_Image(pixels.data(), dimensions, format).data(), dimensions, format);
+			switch (format) {
+			case Texture_Format::BC1:
+				TEST_CHECK(Max_Error(pixels, result, 0, 3) <= SOLID_ERROR_BOUND);
+				break;
+			case Texture_Format::BC3:
+				TEST_CHECK(Max_Error(pixels, result, 0, 3) <= SOLID_ERROR_BOUND);
+				TEST_CHECK(Max_Error(pixels, result, 3, 1) == 0);
+				break;
+			case Texture_Format::BC5:
+				TEST_CHECK(Max_Error(pixels, result, 0, 2) == 0);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
+
+int main()
+{
+	Test_Gradients();
+	Test_Solid();
+	return Test_Result();
+}
\ No newline at end of file
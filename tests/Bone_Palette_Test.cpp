@@ -0,0 +1,80 @@
+#include "Test.h"
+#include "Modules/Graphics/Geometry/Prop/Bone_Palette.h"
+#include <random>
+#include <vector>
+
+
+/** Check that skeletons get disjoint bone ranges, and that the palette grows to fit them. */
+static void Test_Allocate()
+{
+	Bone_Palette palette(8ULL);
+	const auto a = palette.allocate(5ULL);
+	const auto b = palette.allocate(5ULL);
+	TEST_CHECK(a + 5ULL <= b || b + 5ULL <= a);
+	TEST_CHECK(palette.capacity() >= 10ULL);
+	TEST_CHECK(palette.used() == 10ULL);
+
+	// Released bones are reused before growing again
+	const auto capacity = palette.capacity();
+	palette.release(a);
+	TEST_CHECK(palette.allocate(3ULL) == a);
+	TEST_CHECK(palette.capacity() == capacity);
+	TEST_CHECK(palette.used() == 8ULL);
+
+	// Skeletons larger than the whole palette still fit after growing
+	const auto c = palette.allocate(100ULL);
+	TEST_CHECK(c + 100ULL <= palette.capacity());
+}
+
+/** Check random skeletons never overlap. */
+static void Test_Random_Skeletons()
+{
+	std::mt19937 random(42U);
+	Bone_Palette palette;
+	std::vector<std::pair<size_t, size_t>> skeletons;
+	std::vector<int> owners;
+	for (size_t step = 0ULL; step < 5000ULL; ++step) {
+		if (!skeletons.empty() && random() % 3U == 0U) {
+			const auto index = random() % skeletons.size();
+			palette.release(skeletons[index].first);
+			skeletons.erase(skeletons.begin() + static_cast<std::ptrdiff_t>(index));
+		}
+		else {
+			const auto count = 1ULL + random() % 64U;
+			skeletons.emplace_back(palette.allocate(count), count);
+		}
+	}
+	owners.assign(palette.capacity(), -1);
+	size_t used(0ULL);
+	for (size_t x = 0ULL; x < skeletons.size(); ++x) {
+		const auto& [offset, count] = skeletons[x];
+		used += count;
+		TEST_CHECK(offset + count <= palette.capacity());
+		for (auto bone = offset; bone < offset + count && bone < owners.size(); ++bone) {
+			TEST_CHECK(owners[bone] == -1);
+			owners[bone] = static_cast<int>(x);
+		}
+	}
+	TEST_CHECK(palette.used() == used);
+}
+
+/** Check that packing keeps every element of an affine transform. */
+static void Test_Pack()
+{
+	glm::mat4 transform(1.0F);
+	for (int column = 0; column < 4; ++column)
+		for (int row = 0; row < 3; ++row)
+			transform[column][row] = static_cast<float>(column * 4 + row) + 0.5F;
+	const auto bone = Bone_Palette::Pack(transform);
+	TEST_CHECK(bone.rows[0][3] == transform[3][0]);
+	TEST_CHECK(bone.rows[2][1] == transform[1][2]);
+	TEST_CHECK(Bone_Palette::Unpack(bone) == transform);
+}
+
+int main()
+{
+	Test_Allocate();
+	Test_Random_Skeletons();
+	Test_Pack();
+	return Test_Result();
+}
\ No newline at end of file
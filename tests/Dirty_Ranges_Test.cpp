@@ -0,0 +1,103 @@
+#include "Test.h"
+#include "Utilities/Dirty_Ranges.h"
+#include <random>
+
+
+/** Check that changes coalesce into ranges, and that every buffer receives each change exactly once. */
+static void Test_Collect()
+{
+	Dirty_Ranges dirty(3ULL);
+	std::vector<std::pair<size_t, size_t>> ranges;
+	dirty.resize(10ULL);
+
+	// New elements start dirty in every buffer
+	for (size_t buffer = 0ULL; buffer < 3ULL; ++buffer) {
+		TEST_CHECK(dirty.collect(buffer, ranges) == 10ULL);
+		TEST_CHECK(ranges.size() == 1ULL && ranges[0] == std::make_pair<size_t, size_t>(0ULL, 10ULL));
+	}
+	TEST_CHECK(dirty.collect(0ULL, ranges) == 0ULL && ranges.empty());
+
+	// Neighbouring changes coalesce, separate ones don't
+	dirty.markDirty(2ULL);
+	dirty.markDirty(3ULL);
+	dirty.markDirty(7ULL, 2ULL);
+	TEST_CHECK(dirty.collect(1ULL, ranges) == 4ULL);
+	TEST_CHECK(ranges.size() == 2ULL);
+	TEST_CHECK(ranges[0] == std::make_pair<size_t, size_t>(2ULL, 2ULL));
+	TEST_CHECK(ranges[1] == std::make_pair<size_t, size_t>(7ULL, 2ULL));
+	TEST_CHECK(dirty.collect(1ULL, ranges) == 0ULL);
+
+	// A buffer that missed several frames receives every change since it was last written
+	dirty.markDirty(0ULL);
+	TEST_CHECK(dirty.collect(2ULL, ranges) == 5ULL);
+	TEST_CHECK(dirty.collect(0ULL, ranges) == 5ULL);
+	TEST_CHECK(dirty.collect(1ULL, ranges) == 1ULL);
+
+	// Buffer indices wrap around
+	dirty.markAllDirty();
+	TEST_CHECK(dirty.collect(4ULL, ranges) == 10ULL);
+	TEST_CHECK(dirty.collect(1ULL, ranges) == 0ULL);
+}
+
+/** Check random changes against a copy of every buffer's contents. */
+static void Test_Random_Changes()
+{
+	constexpr size_t bufferCount = 3ULL, elementCount = 200ULL;
+	std::mt19937 random(1234U);
+	Dirty_Ranges dirty(bufferCount);
+	dirty.resize(elementCount);
+	std::vector<unsigned int> source(elementCount, 0U);
+	std::vector<std::vector<unsigned int>> buffers(bufferCount, std::vector<unsigned int>(elementCount, ~0U));
+	std::vector<std::pair<size_t, size_t>> ranges;
+	for (size_t frame = 0ULL; frame < 1000ULL; ++frame) {
+		const auto changes = random() % 8U;
+		for (unsigned int x = 0U; x < changes; ++x) {
+			const auto index = random() % elementCount;
+			source[index] = random();
+			dirty.markDirty(index);
+		}
+		auto& buffer = buffers[frame % bufferCount];
+		dirty.collect(frame, ranges);
+		for (const auto& [first, count] : ranges)
+			for (size_t index = first; index < first + count; ++index)
+				buffer[index] = source[index];
+		TEST_CHECK(buffer == source);
+	}
+}
+
+/** Check the bytes uploaded per frame for a static, a partly animated and a fully animated scene, once every buffer holds the first frame. */
+static void Test_Bytes_Per_Frame()
+{
+	// Each element is an instance's transform
+	constexpr size_t bufferCount = 3ULL, elementCount = 10000ULL, elementSize = sizeof(float) * 16ULL, frameCount = 120ULL;
+	for (const size_t animatedStride : { 0ULL, 10ULL, 1ULL }) {
+		Dirty_Ranges dirty(bufferCount);
+		dirty.resize(elementCount);
+		std::vector<std::pair<size_t, size_t>> ranges;
+		for (size_t frame = 0ULL; frame < bufferCount; ++frame)
+			TEST_CHECK(dirty.collect(frame, ranges) == elementCount);
+
+		const auto animatedCount = animatedStride == 0ULL ? 0ULL : elementCount / animatedStride;
+		size_t bytes(0ULL), rangeCount(0ULL);
+		for (size_t frame = bufferCount; frame < bufferCount + frameCount; ++frame) {
+			for (size_t index = 0ULL; index < animatedCount; ++index)
+				dirty.markDirty(index * animatedStride);
+			const auto written = dirty.collect(frame, ranges) * elementSize;
+			// The same instances change every frame, so each buffer only misses those
+			TEST_CHECK(written == animatedCount * elementSize);
+			bytes += written;
+			rangeCount += ranges.size();
+		}
+		TEST_CHECK(bytes == animatedCount * elementSize * frameCount);
+		std::printf("%zu of %zu instances animated: %zu bytes in %zu ranges per frame, against %zu bytes rewriting every instance\n",
+			animatedCount, elementCount, bytes / frameCount, rangeCount / frameCount, elementCount * elementSize);
+	}
+}
+
+int main()
+{
+	Test_Collect();
+	Test_Random_Changes();
+	Test_Bytes_Per_Frame();
+	return Test_Result();
+}
\ No newline at end of file
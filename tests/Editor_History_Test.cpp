@@ -0,0 +1,181 @@
+#include "Test.h"
+#include "Test_Components.h"
+#include "Modules/Editor/Editor_History.h"
+#include "Modules/ECS/ecsWorld.h"
+#include <random>
+
+
+/** A world of records edited by a seeded sequence of random field changes. */
+struct Test_Level {
+	ecsWorld m_world;
+	std::vector<ComponentHandle> m_records;
+	std::mt19937 m_random;
+
+	inline explicit Test_Level(const size_t& recordCount, const unsigned int& seed) : m_random(seed) {
+		for (size_t x = 0ULL; x < recordCount; ++x) {
+			Test_Record_Component record;
+			record.m_value = static_cast<float>(x);
+			record.m_count = static_cast<int>(x);
+			const ecsBaseComponent* const components[] = { &record };
+			EntityHandle entityHandle;
+			m_world.makeEntity(components, 1ULL, "Record", entityHandle, EntityHandle());
+			m_records.push_back(m_world.getComponent<Test_Record_Component>(entityHandle)->m_handle);
+		}
+	}
+	/** Retrieve the serialized data of every record. */
+	inline std::vector<std::vector<char>> snapshot() const {
+		std::vector<std::vector<char>> data;
+		for (const auto& componentHandle : m_records)
+			data.push_back(m_world.serializeComponent(componentHandle));
+		return data;
+	}
+	/** Pick a random selection of records.
+	@param	selectionSize	the most records to select.
+	@return					the selected records, possibly repeated. */
+	inline std::vector<ComponentHandle> select(const size_t& selectionSize) {
+		std::vector<ComponentHandle> selection;
+		const auto count = 1ULL + (m_random() % selectionSize);
+		for (size_t x = 0ULL; x < count; ++x)
+			selection.push_back(m_records[m_random() % m_records.size()]);
+		return selection;
+	}
+	/** Make a command changing one random field of a selection of records.
+	@param	selection		the records to edit.
+	@param	snapshotSize	reference updated with the bytes a command keeping the selection's whole data before and after would hold. */
+	inline std::shared_ptr<Editor_Command> makeEdit(const std::vector<ComponentHandle>& selection, size_t& snapshotSize) {
+		for (const auto& componentHandle : selection)
+			snapshotSize += 2ULL * m_world.serializeComponent(componentHandle).size();
+		const auto field = m_random() % 3U;
+		const auto amount = static_cast<float>(m_random() % 1000U) * 0.01F;
+		const auto steps = static_cast<int>(m_random() % 24U) - 12;
+		constexpr const char* names[3] = { "Value", "Weight", "Count" };
+		return std::make_shared<Component_Edit_Command>(m_world, names[field], selection, [field, amount, steps](ecsBaseComponent& component) {
+			auto& record = static_cast<Test_Record_Component&>(component);
+			if (field == 0U)
+				record.m_value += amount;
+			else if (field == 1U)
+				record.m_weight *= amount;
+			else
+				record.m_count += steps;
+			});
+	}
+};
+
+/** Check that deltas switch between both versions of a buffer, even as its size changes, and merge into a single delta. */
+static void Test_Delta()
+{
+	const std::vector<char> a = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	const std::vector<char> b = { 1, 2, 9, 4, 5, 6, 7, 8, 10, 11 };
+	const std::vector<char> c = { 1, 2, 3, 4, 12 };
+	const auto ab = Binary_Delta::Diff(a, b), bc = Binary_Delta::Diff(b, c);
+	auto data = a;
+	ab.apply(data);
+	TEST_CHECK(data == b);
+	bc.apply(data);
+	TEST_CHECK(data == c);
+	bc.revert(data);
+	ab.revert(data);
+	TEST_CHECK(data == a);
+
+	// Only the changed bytes are kept
+	auto large = std::vector<char>(4096ULL, 7), changed = large;
+	changed[1000ULL] = 8;
+	TEST_CHECK(Binary_Delta::Diff(large, changed).getMemoryUsage() < 256ULL);
+	TEST_CHECK(Binary_Delta::Diff(large, large).empty());
+
+	// Merged deltas span both changes, and changes made then reverted cancel out
+	auto ac = ab;
+	ac.merge(bc);
+	data = a;
+	ac.apply(data);
+	TEST_CHECK(data == c);
+	ac.revert(data);
+	TEST_CHECK(data == a);
+	auto aa = ab;
+	aa.merge(Binary_Delta::Diff(b, a));
+	TEST_CHECK(aa.empty());
+}
+
+/** Check that thousands of random edits undo back to an identical world, while keeping far less than whole snapshots would. */
+static void Test_Undo()
+{
+	Test_Level level(2000ULL, 11U);
+	const auto original = level.snapshot();
+	Editor_History history;
+	history.setLimits(100000ULL, 1024ULL * 1024ULL * 1024ULL);
+	size_t snapshotSize(0ULL);
+	for (size_t x = 0ULL; x < 5000ULL; ++x)
+		history.perform(level.makeEdit(level.select(16ULL), snapshotSize));
+	const auto edited = level.snapshot();
+	TEST_CHECK(edited != original);
+	const auto memoryUsage = history.getMemoryUsage();
+	std::printf("%zu edits kept in %zu bytes, whole snapshots would take %zu bytes\n", history.getUndoCount(), memoryUsage, snapshotSize);
+	TEST_CHECK(memoryUsage * 2ULL < snapshotSize);
+
+	while (history.undo()) {}
+	TEST_CHECK(level.snapshot() == original);
+	while (history.redo()) {}
+	TEST_CHECK(level.snapshot() == edited);
+}
+
+/** Check that a history over budget coalesces repeated edits of the same data, staying within budget without losing its reach. */
+static void Test_Coalesce()
+{
+	Test_Level level(16ULL, 13U);
+	const auto original = level.snapshot();
+	Editor_History history;
+	constexpr size_t budget = 64ULL * 1024ULL;
+	history.setLimits(100000ULL, budget);
+	size_t snapshotSize(0ULL);
+	for (size_t x = 0ULL; x < 5000ULL; ++x)
+		history.perform(level.makeEdit(level.m_records, snapshotSize));
+	std::printf("%zu coalesced edits kept in %zu bytes\n", history.getUndoCount(), history.getMemoryUsage());
+	TEST_CHECK(history.getMemoryUsage() <= budget);
+	TEST_CHECK(history.getUndoCount() < 5000ULL);
+	while (history.undo()) {}
+	TEST_CHECK(level.snapshot() == original);
+
+	// Shrinking the budget forgets the redo-able actions furthest from the present first
+	const auto redoUsage = history.getMemoryUsage();
+	history.setLimits(100000ULL, redoUsage / 2ULL);
+	TEST_CHECK(history.getMemoryUsage() <= redoUsage / 2ULL);
+	TEST_CHECK(history.canRedo());
+	TEST_CHECK(history.redo());
+	TEST_CHECK(level.snapshot() != original);
+}
+
+/** Check that unrelated edits over budget are forgotten, the latest action always stays undo-able, and the action limit is kept. */
+static void Test_Limits()
+{
+	Test_Level level(256ULL, 17U);
+	Editor_History history;
+	history.setLimits(8ULL, 1ULL);
+	size_t snapshotSize(0ULL);
+	for (size_t x = 0ULL; x < 100ULL; ++x) {
+		const auto before = level.snapshot();
+		history.perform(level.makeEdit(level.select(32ULL), snapshotSize));
+		TEST_CHECK(history.getUndoCount() == 1ULL);
+		TEST_CHECK(history.undo());
+		TEST_CHECK(level.snapshot() == before);
+		TEST_CHECK(history.redo());
+	}
+	constexpr size_t budget = 16ULL * 1024ULL;
+	history.setLimits(100000ULL, budget);
+	for (size_t x = 0ULL; x < 1000ULL; ++x)
+		history.perform(level.makeEdit(level.select(32ULL), snapshotSize));
+	TEST_CHECK(history.getMemoryUsage() <= budget);
+	TEST_CHECK(history.getUndoCount() > 1ULL);
+	history.setLimits(8ULL, 1024ULL * 1024ULL * 1024ULL);
+	for (size_t x = 0ULL; x < 100ULL; ++x)
+		history.perform(level.makeEdit(level.select(32ULL), snapshotSize));
+	TEST_CHECK(history.getUndoCount() <= 8ULL);
+}
+
+int main()
+{
+	Test_Delta();
+	Test_Undo();
+	Test_Coalesce();
+	Test_Limits();
+	return Test_Result();
+}
\ No newline at end of file
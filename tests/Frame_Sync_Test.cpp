@@ -0,0 +1,154 @@
+#include "Test.h"
+#include "Utilities/GL/Frame_Sync.h"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+
+/** Fences on a simulated clock, where the GPU signals each fence a fixed latency after it was inserted.
+Waiting advances the clock, so stalls can be measured exactly. */
+class Simulated_Fences final : public Fence_Interface {
+public:
+	// Public Interface Implementations
+	void* insertFence() final {
+		const auto id = ++m_inserted;
+		m_live[id] = std::max(m_lastSignal, m_now + m_latency);
+		m_lastSignal = m_live[id];
+		return reinterpret_cast<void*>(id);
+	}
+	bool waitFence(void* fence, const std::int64_t& timeout, const bool& flush) final {
+		if (flush)
+			++m_flushes;
+		const auto signal = m_live.at(reinterpret_cast<std::uintptr_t>(fence));
+		if (signal > m_now)
+			m_now += std::min(timeout, signal - m_now);
+		return signal <= m_now;
+	}
+	void deleteFence(void* fence) final {
+		m_live.erase(reinterpret_cast<std::uintptr_t>(fence));
+		++m_deleted;
+	}
+	std::int64_t getTime() final {
+		return m_now;
+	}
+
+
+	// Public Attributes
+	/** The current time, in nanoseconds. */
+	std::int64_t m_now = 0LL;
+	/** Time between inserting a fence and the GPU signaling it. */
+	std::int64_t m_latency = 0LL;
+	/** When the most recent fence signals, as the GPU signals fences in order. */
+	std::int64_t m_lastSignal = 0LL;
+	/** When each live fence signals, by fence ID. */
+	std::map<std::uintptr_t, std::int64_t> m_live;
+	size_t m_inserted = 0ULL, m_deleted = 0ULL, m_flushes = 0ULL;
+};
+
+/** Check that a GPU keeping up never stalls the CPU, and that passed fences are deleted. */
+static void Test_Fast_GPU()
+{
+	auto* fences = new Simulated_Fences();
+	Frame_Sync sync{ std::unique_ptr<Fence_Interface>(fences) };
+	for (size_t frame = 0ULL; frame < 20ULL; ++frame) {
+		sync.beginFrame();
+		TEST_CHECK(sync.getFrameWait().m_stalls == 0ULL);
+		fences->m_now += 1000000LL;
+		sync.endFrame();
+		TEST_CHECK(fences->m_live.size() <= FRAMESYNC_FRAMES_IN_FLIGHT);
+	}
+	TEST_CHECK(fences->m_inserted == 20ULL);
+}
+
+/** Check that a slow GPU holds the CPU back to exactly FRAMESYNC_FRAMES_IN_FLIGHT frames ahead. */
+static void Test_Slow_GPU()
+{
+	constexpr std::int64_t cpuFrame = 1000000LL, gpuLatency = 10000000LL;
+	auto* fences = new Simulated_Fences();
+	fences->m_latency = gpuLatency;
+	Frame_Sync sync{ std::unique_ptr<Fence_Interface>(fences) };
+	std::vector<std::int64_t> frameSignals;
+	for (size_t frame = 0ULL; frame < 20ULL; ++frame) {
+		const auto before = fences->m_now;
+		sync.beginFrame();
+		if (frame >= FRAMESYNC_FRAMES_IN_FLIGHT) {
+			// The frame waits for the one FRAMESYNC_FRAMES_IN_FLIGHT frames ago, and no longer
+			const auto signal = frameSignals[frame - FRAMESYNC_FRAMES_IN_FLIGHT];
+			TEST_CHECK(fences->m_now == std::max(before, signal));
+			TEST_CHECK(sync.getFrameWait().m_stallTime == fences->m_now - before);
+			TEST_CHECK(sync.getFrameWait().m_stalls == (signal > before ? 1ULL : 0ULL));
+		}
+		else
+			TEST_CHECK(fences->m_now == before);
+		fences->m_now += cpuFrame;
+		sync.endFrame();
+		frameSignals.push_back(fences->m_lastSignal);
+	}
+
+	// One fence per frame, and no frame needed more than the single flush of its wait
+	TEST_CHECK(fences->m_inserted == 20ULL);
+	TEST_CHECK(fences->m_flushes <= 20ULL - FRAMESYNC_FRAMES_IN_FLIGHT);
+}
+
+/** Check that buffers reused within a frame close the epoch early, and that timeouts expire on time. */
+static void Test_Buffer_Acquire()
+{
+	constexpr std::int64_t gpuLatency = 5000000LL;
+	auto* fences = new Simulated_Fences();
+	fences->m_latency = gpuLatency;
+	Frame_Sync sync{ std::unique_ptr<Fence_Interface>(fences) };
+	sync.beginFrame();
+
+	// Checking the open epoch fences it, but doesn't wait
+	const auto epoch = sync.epoch();
+	TEST_CHECK(!sync.tryAcquire(epoch));
+	TEST_CHECK(fences->m_inserted == 1ULL);
+	TEST_CHECK(sync.epoch() == epoch + 1ULL);
+	TEST_CHECK(fences->m_now == 0LL);
+
+	// A timed out wait lasts exactly as long as the timeout
+	Sync_Stats stats;
+	TEST_CHECK(!sync.acquire(epoch, stats, 1000000LL));
+	TEST_CHECK(fences->m_now == 1000000LL);
+	TEST_CHECK(stats.m_stalls == 1ULL && stats.m_stallTime == 1000000LL);
+
+	// A full wait lasts until the fence signals, and is added to the frame's buffer stalls
+	TEST_CHECK(sync.acquire(epoch, stats));
+	TEST_CHECK(fences->m_now == gpuLatency);
+	TEST_CHECK(stats.m_stalls == 2ULL && stats.m_stallTime == gpuLatency);
+	TEST_CHECK(sync.tryAcquire(epoch));
+	sync.endFrame();
+	sync.beginFrame();
+	TEST_CHECK(sync.getBufferStalls().m_stalls == 2ULL);
+	TEST_CHECK(sync.getBufferStalls().m_stallTime == gpuLatency);
+}
+
+/** Check that resetting deletes every fence, and treats all work as finished. */
+static void Test_Reset()
+{
+	auto* fences = new Simulated_Fences();
+	fences->m_latency = 1000000000LL;
+	Frame_Sync sync{ std::unique_ptr<Fence_Interface>(fences) };
+	for (size_t frame = 0ULL; frame < FRAMESYNC_FRAMES_IN_FLIGHT; ++frame) {
+		sync.beginFrame();
+		sync.endFrame();
+	}
+	const auto epoch = sync.epoch() - 1ULL;
+	TEST_CHECK(!sync.tryAcquire(epoch));
+	sync.reset();
+	TEST_CHECK(fences->m_live.empty());
+	TEST_CHECK(fences->m_deleted == fences->m_inserted);
+	TEST_CHECK(sync.tryAcquire(epoch));
+	sync.beginFrame();
+	TEST_CHECK(sync.getFrameWait().m_stalls == 0ULL);
+}
+
+int main()
+{
+	Test_Fast_GPU();
+	Test_Slow_GPU();
+	Test_Buffer_Acquire();
+	Test_Reset();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "Test.h"
+#include "Utilities/IO/Image_Kernels.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+constexpr Kernel_Path Paths[] = { Kernel_Path::SCALAR, Kernel_Path::SSE2, Kernel_Path::AVX2 };
+constexpr const char* PathNames[] = { "scalar", "SSE2", "AVX2" };
+
+/** Retrieve whether this CPU can run the paths compiled in, as AVX2 builds may land on older CPUs. */
+static bool Cpu_Supports_Paths()
+{
+	if (!Image_Kernels::Has_Path(Kernel_Path::AVX2))
+		return true;
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+/** Make a buffer of random bytes. */
+static std::vector<GLubyte> Random_Bytes(std::mt19937& random, const size_t& size)
+{
+	std::vector<GLubyte> bytes(size);
+	for (auto& byte : bytes)
+		byte = static_cast<GLubyte>(random());
+	return bytes;
+}
+
+/** Check that every path converts rows of every width identically, including widths that leave SIMD tails and unaligned rows. */
+static void Test_Rows()
+{
+	std::mt19937 random(5U);
+	for (size_t width = 1ULL; width <= 67ULL; ++width)
+		for (size_t offset = 0ULL; offset < 4ULL; ++offset) {
+			const auto source = Random_Bytes(random, offset + width * 4ULL);
+			std::vector<GLubyte> expected(width * 4ULL), expanded(width * 4ULL);
+			Image_Kernels::Swizzle_Row(source.data() + offset, expected.data(), width, Kernel_Path::SCALAR);
+			Image_Kernels::Expand_Row(source.data() + offset, expanded.data(), width, Kernel_Path::SCALAR);
+			TEST_CHECK(expected[0] == source[offset + 2ULL] && expected[2] == source[offset] && expanded[0] == source[offset + 2ULL] && expanded[3] == 255U);
+			for (const auto& path : Paths) {
+				std::vector<GLubyte> swizzled(width * 4ULL), result(width * 4ULL);
+				Image_Kernels::Swizzle_Row(source.data() + offset, swizzled.data(), width, path);
+				TEST_CHECK(swizzled == expected);
+
+				// In place, as used when loading 32-bit images
+				auto inPlace = std::vector<GLubyte>(source.begin() + static_cast<std::ptrdiff_t>(offset), source.end());
+				Image_Kernels::Swizzle_Row(inPlace.data(), inPlace.data(), width, path);
+				TEST_CHECK(inPlace == expected);
+
+				// 24-bit rows are only 3 bytes per pixel, so the source is read well short of its end
+				std::vector<GLubyte> packed(source.begin() + static_cast<std::ptrdiff_t>(offset), source.begin() + static_cast<std::ptrdiff_t>(offset + width * 3ULL));
+				Image_Kernels::Expand_Row(packed.data(), result.data(), width, path);
+				std::vector<GLubyte> packedExpected(width * 4ULL);
+				Image_Kernels::Expand_Row(packed.data(), packedExpected.data(), width, Kernel_Path::SCALAR);
+				TEST_CHECK(result == packedExpected);
+			}
+		}
+}
+
+/** Check that every path resamples identically, growing and shrinking images of odd sizes with both filters. */
+static void Test_Resample()
+{
+	std::mt19937 random(7U);
+	const glm::ivec2 sizes[] = { glm::ivec2(1, 1), glm::ivec2(3, 5), glm::ivec2(17, 9), glm::ivec2(61, 45), glm::ivec2(64, 64), glm::ivec2(129, 7) };
+	for (const auto& sourceSize : sizes) {
+		const auto source = Random_Bytes(random, static_cast<size_t>(sourceSize.x) * static_cast<size_t>(sourceSize.y) * 4ULL);
+		for (const auto& newSize : sizes)
+			for (const auto& resizePolicy : { Resize_Policy::LINEAR, Resize_Policy::NEAREST }) {
+				std::vector<GLubyte> expected(static_cast<size_t>(newSize.x) * static_cast<size_t>(newSize.y) * 4ULL);
+				Image_Kernels::Resample(source.data(), sourceSize, expected.data(), newSize, resizePolicy, Kernel_Path::SCALAR);
+				for (const auto& path : Paths) {
+					std::vector<GLubyte> result(expected.size());
+					Image_Kernels::Resample(source.data(), sourceSize, result.data(), newSize, resizePolicy, path);
+					TEST_CHECK(result == expected);
+				}
+			}
+	}
+
+	// A solid image stays solid, despite Catmull-Rom's negative lobes
+	std::vector<GLubyte> solid(13ULL * 7ULL * 4ULL);
+	for (size_t x = 0ULL; x < solid.size(); x += 4ULL) {
+		solid[x] = 10U;
+		solid[x + 1ULL] = 200U;
+		solid[x + 2ULL] = 255U;
+		solid[x + 3ULL] = 0U;
+	}
+	std::vector<GLubyte> resized(40ULL * 3ULL * 4ULL);
+	Image_Kernels::Resample(solid.data(), glm::ivec2(13, 7), resized.data(), glm::ivec2(40, 3), Resize_Policy::LINEAR);
+	bool stayedSolid = true;
+	for (size_t x = 0ULL; x < resized.size(); x += 4ULL)
+		stayedSolid = stayedSolid && std::equal(resized.begin() + static_cast<std::ptrdiff_t>(x), resized.begin() + static_cast<std::ptrdiff_t>(x + 4ULL), solid.begin());
+	TEST_CHECK(stayedSolid);
+}
+
+/** Report the throughput of every path compiled in, in megapixels per second. */
+static void Test_Throughput()
+{
+	std::mt19937 random(11U);
+	constexpr size_t width = 2048ULL, height = 1024ULL, megapixels = width * height;
+	const auto source = Random_Bytes(random, megapixels * 4ULL);
+	std::vector<GLubyte> destination(megapixels * 4ULL), resized(1024ULL * 512ULL * 4ULL);
+	const auto rate = [](const size_t& pixels, const std::chrono::steady_clock::duration& duration) {
+		return static_cast<double>(pixels) / 1000000.0 / std::chrono::duration<double>(duration).count();
+	};
+	for (size_t p = 0ULL; p < 3ULL; ++p) {
+		if (!Image_Kernels::Has_Path(Paths[p]))
+			continue;
+		auto start = std::chrono::steady_clock::now();
+		for (size_t y = 0ULL; y < height; ++y)
+			Image_Kernels::Swizzle_Row(source.data() + y * width * 4ULL, destination.data() + y * width * 4ULL, width, Paths[p]);
+		const auto swizzleTime = std::chrono::steady_clock::now() - start;
+		start = std::chrono::steady_clock::now();
+		for (size_t y = 0ULL; y < height; ++y)
+			Image_Kernels::Expand_Row(source.data() + y * width * 3ULL, destination.data() + y * width * 4ULL, width, Paths[p]);
+		const auto expandTime = std::chrono::steady_clock::now() - start;
+		start = std::chrono::steady_clock::now();
+		Image_Kernels::Resample(source.data(), glm::ivec2(static_cast<int>(width), static_cast<int>(height)), resized.data(), glm::ivec2(1024, 512), Resize_Policy::LINEAR, Paths[p]);
+		const auto resampleTime = std::chrono::steady_clock::now() - start;
+		std::printf("%s: swizzle %.1f MP/s, expand %.1f MP/s, resample %.1f MP/s\n", PathNames[p], rate(megapixels, swizzleTime), rate(megapixels, expandTime), rate(megapixels, resampleTime));
+	}
+}
+
+int main()
+{
+	if (!Cpu_Supports_Paths()) {
+		std::printf("Skipped, this CPU lacks the instruction sets compiled in\n");
+		return 0;
+	}
+	Test_Rows();
+	Test_Resample();
+	Test_Throughput();
+	return Test_Result();
+}
\ No newline at end of file
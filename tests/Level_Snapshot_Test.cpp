@@ -0,0 +1,152 @@
+#include "Test.h"
+#include "Test_Components.h"
+#include "Modules/Editor/Level_Snapshot.h"
+#include "Utilities/IO/Atomic_File.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+
+/** Make a world full of records, one entity each. */
+static void Fill_World(ecsWorld& world, const size_t& entityCount)
+{
+	for (size_t x = 0ULL; x < entityCount; ++x) {
+		Test_Record_Component record;
+		record.m_value = static_cast<float>(x);
+		record.m_count = static_cast<int>(x);
+		const ecsBaseComponent* const components[] = { &record };
+		EntityHandle entityHandle;
+		world.makeEntity(components, 1ULL, "Record", entityHandle, EntityHandle());
+	}
+}
+
+/** Retrieve the serialized data of the whole world at once, the way a single-frame snapshot would. */
+static std::vector<char> Serialize_World(const ecsWorld& world)
+{
+	EntityHandle rootHandle;
+	return world.serializeEntities(world.getEntityHandles(rootHandle));
+}
+
+/** Read a whole file from disk. */
+static std::vector<char> Read_File(const std::filesystem::path& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/** Check that snapshotting a 100k entity level in slices stalls each frame far less than serializing it at once, and yields identical data. */
+static void Test_Stall()
+{
+	ecsWorld world;
+	Fill_World(world, 100000ULL);
+	auto start = std::chrono::steady_clock::now();
+	const auto whole = Serialize_World(world);
+	const auto wholeTime = std::chrono::steady_clock::now() - start;
+
+	Level_Snapshot snapshot;
+	constexpr auto budget = std::chrono::microseconds(2000);
+	std::chrono::steady_clock::duration longestStep(0);
+	size_t steps(0ULL);
+	snapshot.begin(0ULL);
+	for (bool complete = false; !complete; ++steps) {
+		start = std::chrono::steady_clock::now();
+		complete = snapshot.step(world, 0ULL, budget);
+		longestStep = std::max(longestStep, std::chrono::steady_clock::now() - start);
+	}
+	using Milliseconds = std::chrono::duration<double, std::milli>;
+	std::printf("Serializing at once stalls %.2f ms, %zu slices stall at most %.2f ms each\n", Milliseconds(wholeTime).count(), steps, Milliseconds(longestStep).count());
+	TEST_CHECK(steps > 1ULL);
+	TEST_CHECK(longestStep * 4 < wholeTime);
+	TEST_CHECK(snapshot.isActive());
+	TEST_CHECK(Level_Snapshot::Join(snapshot.take()) == whole);
+	TEST_CHECK(!snapshot.isActive());
+}
+
+/** Check that a level changing mid-snapshot restarts it, so the result matches the latest version, and that constant changes can't postpone it forever. */
+static void Test_Restart()
+{
+	ecsWorld world;
+	Fill_World(world, 2000ULL);
+	Level_Snapshot snapshot;
+	constexpr auto budget = std::chrono::microseconds(0);
+	size_t version(0ULL);
+	snapshot.begin(version);
+	TEST_CHECK(!snapshot.step(world, version, budget));
+	TEST_CHECK(!snapshot.step(world, version, budget));
+
+	// Edit an entity already serialized, and add another
+	EntityHandle rootHandle;
+	const auto firstHandle = world.getEntityHandles(rootHandle).front();
+	world.getComponent<Test_Record_Component>(firstHandle)->m_value = -1.0F;
+	Fill_World(world, 1ULL);
+	++version;
+	while (!snapshot.step(world, version, budget)) {}
+	TEST_CHECK(snapshot.getRestartCount() == 1ULL);
+	TEST_CHECK(Level_Snapshot::Join(snapshot.take()) == Serialize_World(world));
+
+	// Keep changing the level every slice
+	snapshot.begin(version);
+	size_t steps(0ULL);
+	while (!snapshot.step(world, ++version, budget))
+		++steps;
+	TEST_CHECK(steps < 10ULL);
+	TEST_CHECK(Level_Snapshot::Join(snapshot.take()) == Serialize_World(world));
+
+	// Cancelled snapshots are dropped
+	snapshot.begin(version);
+	snapshot.step(world, version, budget);
+	snapshot.cancel();
+	TEST_CHECK(!snapshot.isActive());
+	TEST_CHECK(!snapshot.step(world, version, budget));
+}
+
+/** Check that a failed or interrupted write never damages the previous file, and never leaves its temporary file behind. */
+static void Test_Crash_Safety()
+{
+	const auto directory = std::filesystem::temp_directory_path() / "reVision_Level_Snapshot_Test";
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+	const auto path = directory / "My Map.autosave";
+	const auto tempPath = std::filesystem::path(path.string() + ".tmp");
+
+	ecsWorld world;
+	Fill_World(world, 1000ULL);
+	const auto first = Serialize_World(world);
+	TEST_CHECK(Atomic_File::Write(path.string(), first));
+	TEST_CHECK(Read_File(path) == first);
+	TEST_CHECK(!std::filesystem::exists(tempPath));
+
+	// A crash part-way through writing leaves a partial temporary file, which neither damages nor blocks the level
+	{
+		std::ofstream partial(tempPath, std::ios::binary);
+		partial.write(first.data(), static_cast<std::streamsize>(first.size() / 2ULL));
+	}
+	TEST_CHECK(Read_File(path) == first);
+	Fill_World(world, 1ULL);
+	const auto second = Serialize_World(world);
+	TEST_CHECK(Atomic_File::Write(path.string(), second));
+	TEST_CHECK(Read_File(path) == second);
+	TEST_CHECK(!std::filesystem::exists(tempPath));
+
+	// Failing to write the temporary file leaves the level intact
+	std::filesystem::create_directory(tempPath);
+	TEST_CHECK(!Atomic_File::Write(path.string(), first));
+	TEST_CHECK(Read_File(path) == second);
+	std::filesystem::remove(tempPath);
+
+	// Failing to swap the temporary file in cleans it up
+	const auto blockedPath = directory / "Blocked.autosave";
+	std::filesystem::create_directories(blockedPath / "Contents");
+	TEST_CHECK(!Atomic_File::Write(blockedPath.string(), first));
+	TEST_CHECK(!std::filesystem::exists(blockedPath.string() + ".tmp"));
+	std::filesystem::remove_all(directory);
+}
+
+int main()
+{
+	Test_Stall();
+	Test_Restart();
+	Test_Crash_Safety();
+	return Test_Result();
+}
\ No newline at end of file
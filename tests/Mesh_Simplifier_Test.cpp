@@ -0,0 +1,142 @@
+#include "Test.h"
+#include "Utilities/IO/Mesh_Simplifier.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+
+/** Build a closed sphere by subdividing an octahedron.
+@param	levels		the number of times to subdivide.
+@param	positions	output vertex positions.
+@param	indices		output triangle list. */
+static void Make_Sphere(const int& levels, std::vector<glm::vec3>& positions, std::vector<GLuint>& indices)
+{
+	positions = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+	indices = { 0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4, 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5 };
+	for (int level = 0; level < levels; ++level) {
+		std::map<std::pair<GLuint, GLuint>, GLuint> midpoints;
+		const auto midpoint = [&](GLuint a, GLuint b) {
+			if (a > b)
+				std::swap(a, b);
+			const auto [spot, inserted] = midpoints.try_emplace({ a, b }, static_cast<GLuint>(positions.size()));
+			if (inserted)
+				positions.push_back(glm::normalize((positions[a] + positions[b]) * 0.5F));
+			return spot->second;
+		};
+		std::vector<GLuint> subdivided;
+		for (size_t t = 0ULL; t < indices.size(); t += 3ULL) {
+			const auto a = indices[t], b = indices[t + 1ULL], c = indices[t + 2ULL];
+			const auto ab = midpoint(a, b), bc = midpoint(b, c), ca = midpoint(c, a);
+			subdivided.insert(subdivided.end(), { a, ab, ca, ab, b, bc, ca, bc, c, ab, bc, ca });
+		}
+		indices = std::move(subdivided);
+	}
+}
+
+/** Build a closed torus from a grid of quads.
+@param	rings		the number of segments around the torus.
+@param	sides		the number of segments around its tube.
+@param	positions	output vertex positions.
+@param	indices		output triangle list. */
+static void Make_Torus(const GLuint& rings, const GLuint& sides, std::vector<glm::vec3>& positions, std::vector<GLuint>& indices)
+{
+	positions.clear();
+	indices.clear();
+	for (GLuint r = 0U; r < rings; ++r)
+		for (GLuint s = 0U; s < sides; ++s) {
+			const auto u = static_cast<float>(r) / static_cast<float>(rings) * 6.2831853F;
+			const auto v = static_cast<float>(s) / static_cast<float>(sides) * 6.2831853F;
+			positions.emplace_back((1.0F + 0.25F * std::cos(v)) * std::cos(u), (1.0F + 0.25F * std::cos(v)) * std::sin(u), 0.25F * std::sin(v));
+		}
+	for (GLuint r = 0U; r < rings; ++r)
+		for (GLuint s = 0U; s < sides; ++s) {
+			const auto a = r * sides + s, b = ((r + 1U) % rings) * sides + s;
+			const auto c = ((r + 1U) % rings) * sides + ((s + 1U) % sides), d = r * sides + ((s + 1U) % sides);
+			indices.insert(indices.end(), { a, b, c, a, c, d });
+		}
+}
+
+/** Retrieve whether every edge of a triangle list is shared by exactly two triangles, with no triangle repeating a vertex.
+@param	indices		the triangle list to check.
+@return				true if the triangle list is a closed manifold, false otherwise. */
+static bool Is_Closed_Manifold(const std::vector<GLuint>& indices)
+{
+	std::map<std::pair<GLuint, GLuint>, int> edges;
+	for (size_t t = 0ULL; t < indices.size(); t += 3ULL)
+		for (size_t e = 0ULL; e < 3ULL; ++e) {
+			auto a = indices[t + e], b = indices[t + ((e + 1ULL) % 3ULL)];
+			if (a == b)
+				return false;
+			++edges[{ std::min(a, b), std::max(a, b) }];
+		}
+	return std::all_of(edges.cbegin(), edges.cend(), [](const auto& edge) { return edge.second == 2; });
+}
+
+/** Check that heavy simplification keeps a closed surface closed and manifold, as the link condition requires. */
+static void Test_Link_Condition()
+{
+	std::vector<glm::vec3> positions;
+	std::vector<GLuint> indices, result;
+	Make_Sphere(4, positions, indices);
+	TEST_CHECK(Is_Closed_Manifold(indices));
+	for (const auto& target : { indices.size() / 2ULL, indices.size() / 8ULL, 12ULL }) {
+		Mesh_Simplifier::Simplify(positions, {}, indices, target, 10.0F, result);
+		TEST_CHECK(result.size() < indices.size());
+		TEST_CHECK(Is_Closed_Manifold(result));
+
+		// Every triangle keeps facing outwards
+		for (size_t t = 0ULL; t < result.size(); t += 3ULL) {
+			const auto& p0 = positions[result[t]], & p1 = positions[result[t + 1ULL]], & p2 = positions[result[t + 2ULL]];
+			TEST_CHECK(glm::dot(glm::cross(p1 - p0, p2 - p0), p0 + p1 + p2) > 0.0F);
+		}
+	}
+
+	// A thin tube is where collapses pass the flip test yet pinch the surface shut
+	Make_Torus(48U, 12U, positions, indices);
+	TEST_CHECK(Is_Closed_Manifold(indices));
+	for (const auto& target : { indices.size() / 4ULL, 12ULL }) {
+		Mesh_Simplifier::Simplify(positions, {}, indices, target, 10.0F, result);
+		TEST_CHECK(result.size() < indices.size());
+		TEST_CHECK(Is_Closed_Manifold(result));
+	}
+}
+
+/** Check that vertices bordering another region are never collapsed away. */
+static void Test_Regions()
+{
+	std::vector<glm::vec3> positions;
+	std::vector<GLuint> indices, result;
+	Make_Sphere(4, positions, indices);
+
+	// Split the sphere into two regions at its equator
+	std::vector<GLuint> regions(positions.size());
+	for (size_t v = 0ULL; v < positions.size(); ++v)
+		regions[v] = positions[v].z > 0.01F ? 1U : 0U;
+	std::vector<bool> border(positions.size(), false);
+	for (size_t t = 0ULL; t < indices.size(); t += 3ULL)
+		for (size_t e = 0ULL; e < 3ULL; ++e) {
+			const auto a = indices[t + e], b = indices[t + ((e + 1ULL) % 3ULL)];
+			if (regions[a] != regions[b])
+				border[a] = border[b] = true;
+		}
+
+	Mesh_Simplifier::Simplify(positions, regions, indices, indices.size() / 8ULL, 10.0F, result);
+	TEST_CHECK(result.size() < indices.size());
+	TEST_CHECK(Is_Closed_Manifold(result));
+	std::vector<bool> kept(positions.size(), false);
+	for (const auto& index : result)
+		kept[index] = true;
+	for (size_t v = 0ULL; v < positions.size(); ++v)
+		if (border[v])
+			TEST_CHECK(kept[v]);
+}
+
+int main()
+{
+	Test_Link_Condition();
+	Test_Regions();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "Test.h"
+#include "Managers/MessageManager.h"
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/** Check that messages outside the severity threshold or category mask are discarded. */
+static void Test_Filtering()
+{
+	MessageManager messages;
+	TEST_CHECK(messages.isEnabled(Message_Severity::STATEMENT, Message_Category::ASSETS));
+	messages.setSeverityThreshold(Message_Severity::WARNING);
+	messages.setCategoryMask(static_cast<Message_Category>(static_cast<unsigned int>(Message_Category::GENERAL) | static_cast<unsigned int>(Message_Category::EDITOR)));
+	TEST_CHECK(!messages.isEnabled(Message_Severity::STATEMENT, Message_Category::GENERAL));
+	TEST_CHECK(!messages.isEnabled(Message_Severity::FAILURE, Message_Category::ASSETS));
+	TEST_CHECK(messages.isEnabled(Message_Severity::WARNING, Message_Category::EDITOR));
+
+	messages.statement("filtered by severity");
+	messages.error("filtered by category", Message_Category::GRAPHICS);
+	messages.warning("kept", Message_Category::EDITOR);
+	messages.error("kept");
+	messages.flush();
+	const auto history = messages.getHistory();
+	TEST_CHECK(history.size() == 2ULL);
+	TEST_CHECK(history.size() == 2ULL && history[0] == "Warning: kept" && history[1] == "Error: kept");
+}
+
+/** Check that every message sent from several threads is written out, keeping each thread's order. */
+static void Test_Threads()
+{
+	constexpr int threadCount = 4, messageCount = 200;
+	MessageManager messages;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCount; ++t)
+		threads.emplace_back([&messages, t] {
+			for (int i = 0; i < messageCount; ++i)
+				messages.statement(std::to_string(t) + " " + std::to_string(i));
+			});
+	for (auto& thread : threads)
+		thread.join();
+	messages.flush();
+
+	const auto history = messages.getHistory();
+	TEST_CHECK(history.size() == static_cast<size_t>(threadCount * messageCount));
+	std::vector<int> next(threadCount, 0);
+	for (const auto& text : history) {
+		const auto t = std::stoi(text.substr(0ULL, text.find(' ')));
+		const auto i = std::stoi(text.substr(text.find(' ') + 1ULL));
+		TEST_CHECK(i == next[t]);
+		next[t] = i + 1;
+	}
+}
+
+/** Check that a manager built where an old one was gets its own ring, rather than the old manager's. */
+static void Test_Reuse()
+{
+	std::optional<MessageManager> messages;
+	for (int i = 0; i < 3; ++i) {
+		messages.emplace();
+		messages->statement(std::to_string(i));
+		messages->flush();
+		const auto history = messages->getHistory();
+		TEST_CHECK(history.size() == 1ULL && history[0] == std::to_string(i));
+	}
+}
+
+int main()
+{
+	Test_Filtering();
+	Test_Threads();
+	Test_Reuse();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include "Test.h"
+#include "Modules/Physics/Body_Placement.h"
+#include "Modules/Physics/Interpolated_MotionState.h"
+#include "Modules/Physics/Physics_Clock.h"
+#include "btBulletDynamicsCommon.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+/** A physics world on its own, set up like the physics module's, holding a pile of boxes above the ground. */
+struct Test_World {
+	btDbvtBroadphase broadphase;
+	btDefaultCollisionConfiguration collisionConfiguration;
+	btCollisionDispatcher dispatcher{ &collisionConfiguration };
+	btSequentialImpulseConstraintSolver solver;
+	btDiscreteDynamicsWorld world{ &dispatcher, &broadphase, &solver, &collisionConfiguration };
+	btBoxShape groundShape{ btVector3(100, 1, 100) };
+	btBoxShape boxShape{ btVector3(0.5F, 0.5F, 0.5F) };
+	std::vector<std::unique_ptr<Interpolated_MotionState>> motionStates;
+	std::vector<std::unique_ptr<btRigidBody>> bodies;
+
+	/** Build the same pile for the same number of boxes, so separate worlds start out identical. */
+	explicit Test_World(const int& boxCount) {
+		world.setGravity(btVector3(0, static_cast<btScalar>(-9.8), 0));
+		addBody(groundShape, 0.0F, btTransform(btQuaternion::getIdentity(), btVector3(0, -1, 0)));
+		std::mt19937 random(41U);
+		std::uniform_real_distribution<float> jitter(-0.2F, 0.2F), angle(-0.5F, 0.5F);
+		for (int i = 0; i < boxCount; ++i) {
+			const btVector3 position((i % 8) * 1.2F - 4.0F + jitter(random), 1.0F + (i / 64) * 1.3F, ((i / 8) % 8) * 1.2F - 4.0F + jitter(random));
+			addBody(boxShape, 1.0F, btTransform(btQuaternion(angle(random), angle(random), angle(random)), position));
+		}
+	}
+	~Test_World() {
+		for (auto& body : bodies)
+			world.removeRigidBody(body.get());
+	}
+	Test_World(const Test_World&) = delete;
+	Test_World& operator=(const Test_World&) = delete;
+
+	/** Add a rigid body to the world, tracked by an interpolated motion state as colliders are. */
+	void addBody(btCollisionShape& shape, const btScalar& mass, const btTransform& transform) {
+		btVector3 inertia(0, 0, 0);
+		if (mass != 0.0F)
+			shape.calculateLocalInertia(mass, inertia);
+		motionStates.push_back(std::make_unique<Interpolated_MotionState>(transform));
+		bodies.push_back(std::make_unique<btRigidBody>(btRigidBody::btRigidBodyConstructionInfo(mass, motionStates.back().get(), &shape, inertia)));
+		world.addRigidBody(bodies.back().get());
+	}
+};
+
+/** Check whether 2 transforms are bit-for-bit the same. */
+static bool Same_Transform(const btTransform& a, const btTransform& b)
+{
+	for (int r = 0; r < 3; ++r)
+		for (int c = 0; c < 3; ++c)
+			if (a.getBasis()[r][c] != b.getBasis()[r][c])
+				return false;
+	return a.getOrigin().x() == b.getOrigin().x() && a.getOrigin().y() == b.getOrigin().y() && a.getOrigin().z() == b.getOrigin().z();
+}
+
+/** Check whether every body in 2 worlds is in exactly the same state. */
+static bool Same_State(const Test_World& a, const Test_World& b)
+{
+	if (a.bodies.size() != b.bodies.size())
+		return false;
+	for (size_t i = 0ULL; i < a.bodies.size(); ++i) {
+		const auto& bodyA = *a.bodies[i];
+		const auto& bodyB = *b.bodies[i];
+		if (!Same_Transform(bodyA.getWorldTransform(), bodyB.getWorldTransform())
+			|| !(bodyA.getLinearVelocity() == bodyB.getLinearVelocity())
+			|| !(bodyA.getAngularVelocity() == bodyB.getAngularVelocity())
+			|| !Same_Transform(a.motionStates[i]->getInterpolatedTransform(0.0F), b.motionStates[i]->getInterpolatedTransform(0.0F))
+			|| !Same_Transform(a.motionStates[i]->getInterpolatedTransform(1.0F), b.motionStates[i]->getInterpolatedTransform(1.0F)))
+			return false;
+	}
+	return true;
+}
+
+/** Feed a clock frames of random length until it has been given a set amount of time, returning the number of steps taken.
+@param	minimum		the shortest frame, which may be 0.
+@param	maximum		the longest frame, short enough that the step budget never drops any time. */
+static int Run_Frames(Test_World& testWorld, Physics_Clock& clock, std::mt19937& random, const float& minimum, const float& maximum, const double& totalTime)
+{
+	std::uniform_real_distribution<float> frameTime(minimum, maximum);
+	int steps = 0;
+	for (double elapsed = 0.0; elapsed < totalTime;) {
+		const auto deltaTime = static_cast<float>(std::min<double>(frameTime(random), totalTime - elapsed));
+		steps += clock.advance(testWorld.world, deltaTime);
+		elapsed += deltaTime;
+		TEST_CHECK(clock.getInterpolation() >= 0.0F && clock.getInterpolation() < 1.0F);
+	}
+	return steps;
+}
+
+/** Check that a world ends up bit-identical however the same time is split into frames, and identical to stepping it directly. */
+static void Test_Determinism()
+{
+	constexpr int boxCount = 256, stepCount = 300;
+	Test_World steady(boxCount), uneven(boxCount), choppy(boxCount);
+	TEST_CHECK(Same_State(steady, uneven) && Same_State(steady, choppy));
+
+	// Stop half way through a step, so rounding in the accumulator can't change the step count
+	Physics_Clock unevenClock, choppyClock;
+	const auto totalTime = (stepCount + 0.5) * static_cast<double>(unevenClock.getStepSize());
+	std::mt19937 random(42U);
+	for (int s = 0; s < stepCount; ++s)
+		steady.world.stepSimulation(unevenClock.getStepSize(), 0);
+	TEST_CHECK(Run_Frames(uneven, unevenClock, random, 0.004F, 0.05F, totalTime) == stepCount);
+	TEST_CHECK(Run_Frames(choppy, choppyClock, random, 0.0F, 0.003F, totalTime) == stepCount);
+
+	// Make sure the boxes actually fell and collided, rather than resting where they started
+	TEST_CHECK(!Same_Transform(steady.bodies.back()->getWorldTransform(), Test_World(boxCount).bodies.back()->getWorldTransform()));
+	TEST_CHECK(Same_State(steady, uneven));
+	TEST_CHECK(Same_State(steady, choppy));
+}
+
+/** Check the step budget, step rate limits, and the transforms interpolated between steps. */
+static void Test_Clock()
+{
+	Test_World testWorld(8);
+	Physics_Clock clock;
+
+	// A long frame takes only as many steps as the budget allows, and drops the rest
+	clock.setMaxSteps(3);
+	TEST_CHECK(clock.advance(testWorld.world, 1.0F) == 3);
+	TEST_CHECK(clock.getInterpolation() >= 0.0F && clock.getInterpolation() < 1.0F);
+	TEST_CHECK(clock.advance(testWorld.world, 0.0F) == 0);
+	clock.setMaxSteps(0);
+	TEST_CHECK(clock.advance(testWorld.world, 1.0F) == 1);
+	clock.setStepRate(0.0F);
+	TEST_CHECK(clock.getStepSize() == 1.0F);
+	clock.setStepRate(120.0F);
+	TEST_CHECK(clock.getStepSize() == 1.0F / 120.0F);
+
+	// A motion state spans the body's transforms from before and after its latest step
+	Physics_Clock frameClock;
+	auto& body = *testWorld.bodies.back();
+	const auto before = body.getWorldTransform();
+	while (frameClock.advance(testWorld.world, 0.004F) == 0) {}
+	const auto& motionState = *testWorld.motionStates.back();
+	TEST_CHECK(!Same_Transform(before, body.getWorldTransform()));
+	TEST_CHECK(Same_Transform(motionState.getInterpolatedTransform(1.0F), body.getWorldTransform()));
+	TEST_CHECK(std::abs(motionState.getInterpolatedTransform(0.0F).getOrigin().y() - before.getOrigin().y()) < 1e-5F);
+	const auto halfway = motionState.getInterpolatedTransform(0.5F).getOrigin().y();
+	TEST_CHECK(std::abs(halfway - (before.getOrigin().y() + body.getWorldTransform().getOrigin().y()) * 0.5F) < 1e-5F);
+}
+
+/** Report how long it takes to simulate a second of a busy scene, fed by frames of a typical length. */
+static void Test_Cost()
+{
+	for (const int& boxCount : { 256, 1024 }) {
+		Test_World testWorld(boxCount);
+		Physics_Clock clock;
+		std::mt19937 random(43U);
+		constexpr double simulatedTime = 5.0;
+		const auto start = std::chrono::steady_clock::now();
+		const auto steps = Run_Frames(testWorld, clock, random, 0.005F, 0.02F, simulatedTime);
+		const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::printf("%d boxes: %.1f ms per simulated second (%d steps)\n", boxCount, elapsed / simulatedTime, steps);
+	}
+}
+
+/** Compare moving bodies in place against removing and rebuilding them, as the physics sync system did whenever a transform changed.
+Both ways must leave the same scene, and moving should cost less. */
+static void Test_Move()
+{
+	for (const int& boxCount : { 1024, 4096 }) {
+		Test_World moved(boxCount), rebuilt(boxCount);
+		Physics_Clock clock;
+		std::mt19937 random(44U);
+		std::uniform_real_distribution<float> angle(-3.0F, 3.0F);
+		constexpr int frameCount = 32;
+		double moveTime(0.0), rebuildTime(0.0);
+		for (int frame = 0; frame < frameCount; ++frame) {
+			// Scatter every box above the ground, far enough apart that none touch
+			std::vector<btTransform> targets(static_cast<size_t>(boxCount) + 1ULL);
+			for (int i = 1; i <= boxCount; ++i) {
+				const btVector3 position(((i - 1) % 64) * 3.0F - 96.0F + frame, 20.0F + frame, ((i - 1) / 64) * 3.0F - 96.0F);
+				targets[static_cast<size_t>(i)] = btTransform(btQuaternion(angle(random), angle(random), angle(random)), position);
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			for (size_t i = 1ULL; i < targets.size(); ++i) {
+				moved.motionStates[i]->reset(targets[i]);
+				Body_Placement::Move(moved.world, *moved.bodies[i], targets[i]);
+			}
+			moved.world.stepSimulation(clock.getStepSize(), 0);
+			moveTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			start = std::chrono::steady_clock::now();
+			for (size_t i = 1ULL; i < targets.size(); ++i) {
+				auto& body = rebuilt.bodies[i];
+				rebuilt.world.removeRigidBody(body.get());
+				rebuilt.motionStates[i]->reset(targets[i]);
+				btVector3 inertia(0, 0, 0);
+				rebuilt.boxShape.calculateLocalInertia(1.0F, inertia);
+				body = std::make_unique<btRigidBody>(btRigidBody::btRigidBodyConstructionInfo(1.0F, rebuilt.motionStates[i].get(), &rebuilt.boxShape, inertia));
+				rebuilt.world.addRigidBody(body.get());
+			}
+			rebuilt.world.stepSimulation(clock.getStepSize(), 0);
+			rebuildTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			// A moved body must fall from its new place, found there by the broadphase
+			for (size_t i = 1ULL; i < targets.size(); ++i) {
+				auto& movedBody = *moved.bodies[i];
+				const auto& rebuiltBody = *rebuilt.bodies[i];
+				const auto& origin = movedBody.getWorldTransform().getOrigin();
+				const auto* proxy = movedBody.getBroadphaseHandle();
+				TEST_CHECK(std::abs(origin.x() - targets[i].getOrigin().x()) < 1e-4F && std::abs(origin.z() - targets[i].getOrigin().z()) < 1e-4F);
+				TEST_CHECK(origin.y() < targets[i].getOrigin().y() && origin.y() > targets[i].getOrigin().y() - 0.01F);
+				TEST_CHECK(proxy->m_aabbMin.y() <= origin.y() && proxy->m_aabbMax.y() >= origin.y());
+				TEST_CHECK((origin - rebuiltBody.getWorldTransform().getOrigin()).length() < 1e-4F);
+				TEST_CHECK((movedBody.getLinearVelocity() - rebuiltBody.getLinearVelocity()).length() < 1e-4F);
+			}
+		}
+		std::printf("%d boxes: moved in place %.2f ms, rebuilt %.2f ms per frame\n", boxCount, moveTime / frameCount, rebuildTime / frameCount);
+	}
+}
+
+int main()
+{
+	Test_Determinism();
+	Test_Clock();
+	Test_Cost();
+	Test_Move();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "Test.h"
+#include "Utilities/Profiler.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/** Read a capture back one line at a time, each event being written on its own line. */
+static std::vector<std::string> Read_Lines(const std::filesystem::path& path)
+{
+	std::ifstream file(path);
+	std::vector<std::string> lines;
+	for (std::string line; std::getline(file, line);)
+		lines.push_back(line);
+	return lines;
+}
+
+/** Retrieve the first captured line holding a zone of a given name, or an empty string if there is none. */
+static std::string Find_Zone(const std::vector<std::string>& lines, const std::string& name)
+{
+	const auto key = "\"name\":\"" + name + "\"";
+	for (const auto& line : lines)
+		if (line.find("\"ph\":\"X\"") != std::string::npos && line.find(key) != std::string::npos)
+			return line;
+	return {};
+}
+
+/** Retrieve the summary of a zone from the last frame, with no calls if it wasn't recorded. */
+static Profiler_Summary Find_Summary(const std::vector<Profiler_Summary>& summary, const std::string& name)
+{
+	for (const auto& zone : summary)
+		if (zone.m_name != nullptr && name == zone.m_name)
+			return zone;
+	return {};
+}
+
+/** Check that nested zones record their depth, and are summarized per frame. */
+static void Test_Nesting()
+{
+	Profiler::New_Frame();
+	const auto path = std::filesystem::temp_directory_path() / "reVision_Profiler_Test.json";
+	Profiler::Begin_Capture();
+	TEST_CHECK(Profiler::Is_Capturing());
+	{
+		PROFILE_ZONE("test", "outer");
+		for (int i = 0; i < 2; ++i) {
+			PROFILE_ZONE("test", "middle");
+			PROFILE_ZONE("test", "inner");
+		}
+	}
+	{
+		PROFILE_ZONE("test", "sibling");
+	}
+	Profiler::New_Frame();
+	const auto summary = Profiler::Get_Frame_Summary();
+	TEST_CHECK(summary.size() == 4ULL);
+	TEST_CHECK(Find_Summary(summary, "outer").m_calls == 1ULL && Find_Summary(summary, "middle").m_calls == 2ULL && Find_Summary(summary, "inner").m_calls == 2ULL);
+	TEST_CHECK(Find_Summary(summary, "outer").m_milliseconds >= Find_Summary(summary, "middle").m_milliseconds);
+	TEST_CHECK(std::is_sorted(summary.cbegin(), summary.cend(), [](const auto& a, const auto& b) { return a.m_milliseconds > b.m_milliseconds; }));
+
+	TEST_CHECK(Profiler::End_Capture(path.string()));
+	TEST_CHECK(!Profiler::Is_Capturing());
+	const auto lines = Read_Lines(path);
+	TEST_CHECK(Find_Zone(lines, "outer").find("\"depth\":0}") != std::string::npos);
+	TEST_CHECK(Find_Zone(lines, "middle").find("\"depth\":1}") != std::string::npos);
+	TEST_CHECK(Find_Zone(lines, "inner").find("\"depth\":2}") != std::string::npos);
+	TEST_CHECK(Find_Zone(lines, "sibling").find("\"depth\":0}") != std::string::npos);
+	std::filesystem::remove(path);
+
+	// Zones are only summarized for the frame they finished in
+	Profiler::New_Frame();
+	TEST_CHECK(Profiler::Get_Frame_Summary().empty());
+}
+
+/** Check that zones from several named threads are all collected, and labeled in captures. */
+static void Test_Threads()
+{
+	constexpr int zoneCount = 500;
+	const auto path = std::filesystem::temp_directory_path() / "reVision_Profiler_Test_Threads.json";
+	Profiler::New_Frame();
+	Profiler::Begin_Capture();
+	const auto work = [](const char* threadName, const char* zoneName) {
+		Profiler::Set_Thread_Name(threadName);
+		for (int i = 0; i < zoneCount; ++i) {
+			const Profiler_Zone zone("test", zoneName);
+		}
+	};
+	std::thread first(work, "First \"Worker\"", "first work"), second(work, "Second\\Worker", "second work");
+	first.join();
+	second.join();
+
+	// The threads have exited, but their zones must still be collected
+	Profiler::New_Frame();
+	const auto summary = Profiler::Get_Frame_Summary();
+	TEST_CHECK(summary.size() == 2ULL);
+	TEST_CHECK(Find_Summary(summary, "first work").m_calls == static_cast<size_t>(zoneCount));
+	TEST_CHECK(Find_Summary(summary, "second work").m_calls == static_cast<size_t>(zoneCount));
+
+	// Thread names must be escaped, and every zone written out as its own event
+	TEST_CHECK(Profiler::End_Capture(path.string()));
+	const auto lines = Read_Lines(path);
+	TEST_CHECK(!lines.empty() && lines.front() == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" && lines.back() == "]}");
+	const auto count = [&lines](const std::string& text) {
+		return std::count_if(lines.cbegin(), lines.cend(), [&text](const std::string& line) { return line.find(text) != std::string::npos; });
+	};
+	TEST_CHECK(count("\"name\":\"thread_name\"") == 2);
+	TEST_CHECK(count("\"args\":{\"name\":\"First \\\"Worker\\\"\"}") == 1);
+	TEST_CHECK(count("\"args\":{\"name\":\"Second\\\\Worker\"}") == 1);
+	TEST_CHECK(count("\"ph\":\"X\"") == 2 * zoneCount);
+	TEST_CHECK(count("\"name\":\"first work\"") == zoneCount && count("\"name\":\"second work\"") == zoneCount);
+
+	// Every line but the first and last is a single object, separated by commas
+	for (size_t i = 1ULL; i + 1ULL < lines.size(); ++i) {
+		const auto& line = lines[i];
+		const auto last = i + 2ULL < lines.size() ? "}," : "}";
+		TEST_CHECK(line.front() == '{' && line.compare(line.size() - std::char_traits<char>::length(last), std::string::npos, last) == 0);
+		int depth = 0;
+		bool inString = false, balanced = true;
+		for (size_t c = 0ULL; c < line.size(); ++c) {
+			if (inString && line[c] == '\\')
+				++c;
+			else if (line[c] == '"')
+				inString = !inString;
+			else if (!inString && line[c] == '{')
+				++depth;
+			else if (!inString && line[c] == '}' && --depth == 0 && c + 1ULL < line.size() && line.substr(c + 1ULL) != ",")
+				balanced = false;
+		}
+		TEST_CHECK(!inString && depth == 0 && balanced);
+	}
+	std::filesystem::remove(path);
+
+	// Exited threads are forgotten once collected
+	Profiler::New_Frame();
+	TEST_CHECK(Profiler::Get_Frame_Summary().empty());
+}
+
+/** Check how long recording a zone takes, loosely enough to pass on debug builds. */
+static void Test_Cost()
+{
+	constexpr int zoneCount = 200000;
+	Profiler::New_Frame();
+	const auto start = Profiler::Get_Time();
+	for (int i = 0; i < zoneCount; ++i) {
+		PROFILE_ZONE("test", "cost");
+	}
+	const auto nanoseconds = static_cast<double>(Profiler::Get_Time() - start) / zoneCount;
+	Profiler::New_Frame();
+	TEST_CHECK(Find_Summary(Profiler::Get_Frame_Summary(), "cost").m_calls == static_cast<size_t>(zoneCount));
+	TEST_CHECK(nanoseconds < 2000.0);
+	std::printf("%.1f ns per zone\n", nanoseconds);
+}
+
+int main()
+{
+	Test_Nesting();
+	Test_Threads();
+	Test_Cost();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "Test.h"
+#include "Modules/Graphics/Geometry/Prop/Prop_Batcher.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <set>
+#include <tuple>
+
+
+/** An instance as drawn: its camera, layer, prop, skeleton, geometry, and whether it is occlusion culled. */
+using Drawn_Instance = std::tuple<int, int, GLuint, int, GLuint, GLuint, GLint, bool>;
+
+/** Make a random scene of props spread over several models and levels of detail, seen by several perspectives. */
+static void Random_Scene(std::mt19937& random, std::vector<PropData::ViewInfo>& viewInfo, std::vector<std::pair<int, int>>& perspectives)
+{
+	const auto viewCount = 1U + static_cast<GLuint>(random() % 8U), modelCount = 1U + static_cast<GLuint>(random() % 20U), propCount = static_cast<GLuint>(random() % 500U);
+	viewInfo.assign(viewCount, {});
+	perspectives.clear();
+	for (auto& view : viewInfo)
+		for (GLuint prop = 0U; prop < propCount; ++prop) {
+			if (random() % 3U == 0U)
+				continue;
+			// Each model owns its own range of the shared index buffer, split between its levels of detail
+			const auto model = static_cast<GLuint>(random() % modelCount), lod = static_cast<GLuint>(random() % 3U);
+			const bool occluded = random() % 5U == 0U;
+			view.visibleIndices.push_back(prop);
+			view.skeletonData.push_back(random() % 4U == 0U ? static_cast<int>(random() % 100U) : -1);
+			view.cullingDrawData.emplace_back(36, occluded ? 1 : 0, 0, 1);
+			view.renderingDrawData.push_back({ 300U - lod * 100U, occluded ? 0U : 1U, model * 1000U + lod * 300U, static_cast<GLint>(model * 500U), 1U });
+		}
+	for (GLuint camIndex = 0U; camIndex < viewCount; ++camIndex)
+		if (random() % 4U != 0U)
+			perspectives.emplace_back(static_cast<int>(camIndex), static_cast<int>(random() % 6U));
+}
+
+/** List every instance the unbatched draw list would draw, one draw per visible prop of each perspective. */
+static std::vector<Drawn_Instance> Unbatched_Instances(const std::vector<PropData::ViewInfo>& viewInfo, const std::vector<std::pair<int, int>>& perspectives)
+{
+	std::vector<Drawn_Instance> instances;
+	for (const auto& [camIndex, layer] : perspectives) {
+		const auto& view = viewInfo[camIndex];
+		for (size_t x = 0ULL; x < view.visibleIndices.size(); ++x) {
+			const auto& draw = view.renderingDrawData[x];
+			instances.emplace_back(camIndex, layer, view.visibleIndices[x], view.skeletonData[x], draw.count, draw.firstIndex, draw.baseVertex, view.cullingDrawData[x].y != 0);
+		}
+	}
+	return instances;
+}
+
+/** Check that the batched draw list draws exactly the instances of the unbatched one, and that its draws are laid out as the culling and rendering passes expect. */
+static void Test_Matches()
+{
+	std::mt19937 random(25U);
+	Prop_Batcher batcher;
+	PropData::DrawList drawList;
+	std::vector<PropData::ViewInfo> viewInfo;
+	std::vector<std::pair<int, int>> perspectives;
+	size_t draws(0ULL), instances(0ULL);
+	for (int trial = 0; trial < 200; ++trial) {
+		// Reuse the batcher, as the technique does every frame
+		Random_Scene(random, viewInfo, perspectives);
+		batcher.build(viewInfo, perspectives, drawList);
+		TEST_CHECK(drawList.cullingDrawData.size() == drawList.renderingDrawData.size());
+		TEST_CHECK(drawList.camIndices.size() == drawList.propIndices.size() && drawList.propIndices.size() == drawList.skeletonIndices.size());
+
+		std::vector<Drawn_Instance> batched;
+		std::set<std::pair<GLuint, GLuint>> batchedGeometry;
+		GLuint nextInstance = 0U;
+		bool batching = false;
+		for (size_t d = 0ULL; d < drawList.renderingDrawData.size(); ++d) {
+			const auto& draw = drawList.renderingDrawData[d];
+			const auto& culling = drawList.cullingDrawData[d];
+			const bool occluded = culling.y != 0;
+			const auto instanceCount = occluded ? 1U : draw.instanceCount;
+
+			// Draws tile the instance arrays in order, both passes starting at the same instance
+			TEST_CHECK(draw.baseInstance == nextInstance && static_cast<GLuint>(culling.w) == draw.baseInstance);
+			if (occluded) {
+				// Occlusion culled props keep a single instance draw each, ahead of every batch
+				TEST_CHECK(culling.y == 1 && !batching);
+				TEST_CHECK(draw.instanceCount == 0U);
+			}
+			else {
+				// Each geometry range is batched into exactly one draw
+				TEST_CHECK(draw.instanceCount > 0U && culling.y == 0);
+				TEST_CHECK(batchedGeometry.emplace(draw.firstIndex, draw.count).second);
+				batching = true;
+			}
+			for (auto i = draw.baseInstance; i < draw.baseInstance + instanceCount && i < drawList.propIndices.size(); ++i)
+				batched.emplace_back(drawList.camIndices[i].x, drawList.camIndices[i].y, drawList.propIndices[i], drawList.skeletonIndices[i], draw.count, draw.firstIndex, draw.baseVertex, occluded);
+			nextInstance += instanceCount;
+		}
+		TEST_CHECK(nextInstance == drawList.propIndices.size());
+
+		auto expected = Unbatched_Instances(viewInfo, perspectives);
+		std::sort(expected.begin(), expected.end());
+		std::sort(batched.begin(), batched.end());
+		TEST_CHECK(batched == expected);
+		draws += drawList.renderingDrawData.size();
+		instances += expected.size();
+	}
+	TEST_CHECK(draws < instances);
+}
+
+/** Report how long it takes to batch 30000 instances, for scenes made of few to many distinct models. */
+static void Test_Throughput()
+{
+	constexpr int viewCount = 6, propCount = 5000, buildCount = 200;
+	for (const int& modelCount : { 10, 50, 500 }) {
+		std::vector<PropData::ViewInfo> viewInfo(viewCount);
+		std::vector<std::pair<int, int>> perspectives;
+		for (int camIndex = 0; camIndex < viewCount; ++camIndex) {
+			// Like the faces of a point light's shadow
+			perspectives.emplace_back(camIndex, camIndex);
+			auto& view = viewInfo[camIndex];
+			for (int prop = 0; prop < propCount; ++prop) {
+				const auto model = static_cast<GLuint>(prop % modelCount), lod = static_cast<GLuint>((prop / modelCount) % 3);
+				view.visibleIndices.push_back(static_cast<GLuint>(prop));
+				view.skeletonData.push_back(-1);
+				view.cullingDrawData.emplace_back(36, 0, 0, 1);
+				view.renderingDrawData.push_back({ 300U, 1U, model * 1000U + lod * 300U, static_cast<GLint>(model * 500U), 1U });
+			}
+		}
+
+		Prop_Batcher batcher;
+		PropData::DrawList drawList;
+		batcher.build(viewInfo, perspectives, drawList);
+		const auto start = std::chrono::steady_clock::now();
+		for (int build = 0; build < buildCount; ++build)
+			batcher.build(viewInfo, perspectives, drawList);
+		const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / buildCount;
+		TEST_CHECK(drawList.propIndices.size() == static_cast<size_t>(viewCount * propCount));
+		TEST_CHECK(drawList.renderingDrawData.size() == static_cast<size_t>(std::min(modelCount * 3, propCount)));
+		std::printf("%d models: %zu instances in %zu draws, %.1f us per build\n", modelCount, drawList.propIndices.size(), drawList.renderingDrawData.size(), elapsed);
+	}
+}
+
+int main()
+{
+	Test_Matches();
+	Test_Throughput();
+	return Test_Result();
+}
\ No newline at end of file
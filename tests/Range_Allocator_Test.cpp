@@ -0,0 +1,197 @@
+#include "Test.h"
+#include "Utilities/Range_Allocator.h"
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <random>
+
+
+/** Check allocation, release, and coalescing of free ranges. */
+static void Test_Allocate_Release()
+{
+	Range_Allocator ranges(100ULL);
+	size_t a(0ULL), b(0ULL), c(0ULL), unused(0ULL);
+	TEST_CHECK(!ranges.allocate(0ULL, unused));
+	TEST_CHECK(ranges.allocate(10ULL, a) && a == 0ULL);
+	TEST_CHECK(ranges.allocate(20ULL, b) && b == 10ULL);
+	TEST_CHECK(ranges.allocate(30ULL, c) && c == 30ULL);
+	TEST_CHECK(ranges.used() == 60ULL);
+	TEST_CHECK(ranges.end() == 60ULL);
+	TEST_CHECK(!ranges.allocate(41ULL, unused));
+
+	// Freed neighbours merge back into one range
+	ranges.release(a);
+	ranges.release(b);
+	TEST_CHECK(ranges.freeRangeCount() == 2ULL);
+	TEST_CHECK(ranges.allocate(30ULL, a) && a == 0ULL);
+	ranges.release(a);
+	ranges.release(c);
+	TEST_CHECK(ranges.freeRangeCount() == 1ULL);
+	TEST_CHECK(ranges.used() == 0ULL);
+	TEST_CHECK(ranges.end() == 0ULL);
+
+	// Releasing an unknown offset does nothing
+	ranges.release(55ULL);
+	TEST_CHECK(ranges.used() == 0ULL);
+}
+
+/** Check that the smallest free range fitting a request is used. */
+static void Test_Best_Fit()
+{
+	Range_Allocator ranges(100ULL);
+	size_t offsets[5] = {};
+	for (auto& offset : offsets)
+		TEST_CHECK(ranges.allocate(10ULL, offset));
+	ranges.release(offsets[1]);
+	size_t wide(0ULL), narrow(0ULL);
+	TEST_CHECK(ranges.allocate(5ULL, narrow) && narrow == offsets[1]);
+	TEST_CHECK(ranges.allocate(20ULL, wide) && wide == 50ULL);
+}
+
+/** Check growing and shrinking the buffer. */
+static void Test_Grow_Shrink()
+{
+	Range_Allocator ranges(10ULL);
+	size_t a(0ULL), b(0ULL);
+	TEST_CHECK(ranges.allocate(10ULL, a));
+	TEST_CHECK(!ranges.allocate(10ULL, b));
+	ranges.grow(30ULL);
+	TEST_CHECK(ranges.capacity() == 30ULL);
+	TEST_CHECK(ranges.allocate(10ULL, b) && b == 10ULL);
+	TEST_CHECK(!ranges.shrink(15ULL));
+	ranges.release(b);
+	TEST_CHECK(ranges.shrink(15ULL));
+	TEST_CHECK(ranges.capacity() == 15ULL);
+	TEST_CHECK(!ranges.allocate(10ULL, b));
+	TEST_CHECK(ranges.allocate(5ULL, b) && b == 10ULL);
+	ranges.clear();
+	TEST_CHECK(ranges.used() == 0ULL && ranges.capacity() == 15ULL && ranges.freeRangeCount() == 1ULL);
+}
+
+/** Check that defragmenting moves ranges down into gaps. */
+static void Test_Defragment()
+{
+	Range_Allocator ranges(100ULL);
+	size_t a(0ULL), b(0ULL), c(0ULL);
+	ranges.allocate(10ULL, a);
+	ranges.allocate(10ULL, b);
+	ranges.allocate(10ULL, c);
+	ranges.release(a);
+	size_t from(0ULL), to(0ULL), size(0ULL);
+	TEST_CHECK(ranges.defragment(10ULL, from, to, size));
+	TEST_CHECK(from == c && to == a && size == 10ULL);
+	TEST_CHECK(ranges.end() == 20ULL);
+	TEST_CHECK(!ranges.defragment(10ULL, from, to, size));
+}
+
+/** Check that defragmenting walks back past the last range when it can't move, rather than getting stuck on it. */
+static void Test_Defragment_Walk_Back()
+{
+	Range_Allocator ranges(100ULL);
+	size_t a(0ULL), b(0ULL), c(0ULL), d(0ULL);
+	ranges.allocate(10ULL, a);
+	ranges.allocate(10ULL, b);
+	ranges.allocate(10ULL, c);
+	ranges.allocate(40ULL, d);
+	ranges.release(a);
+
+	// The last range is larger than both the gap and the limit, but the one before it fits
+	size_t from(0ULL), to(0ULL), size(0ULL);
+	TEST_CHECK(ranges.defragment(20ULL, from, to, size));
+	TEST_CHECK(from == c && to == a && size == 10ULL);
+	TEST_CHECK(!ranges.defragment(20ULL, from, to, size));
+	TEST_CHECK(ranges.freeRangeCount() == 2ULL);
+}
+
+/** Check the allocator's invariants against a model of its allocated ranges.
+@param	ranges		the allocator to check.
+@param	model		the offset and size of every range the allocator should hold. */
+static void Check_Model(const Range_Allocator& ranges, const std::map<size_t, size_t>& model)
+{
+	size_t used(0ULL), end(0ULL), gaps(0ULL), previousEnd(0ULL);
+	for (const auto& [offset, size] : model) {
+		TEST_CHECK(offset >= previousEnd);
+		if (offset > previousEnd)
+			++gaps;
+		previousEnd = offset + size;
+		used += size;
+		end = offset + size;
+	}
+	TEST_CHECK(end <= ranges.capacity());
+	if (end < ranges.capacity())
+		++gaps;
+	TEST_CHECK(ranges.used() == used);
+	TEST_CHECK(ranges.end() == end);
+	// Free neighbours always merge, so every gap between ranges is a single free range
+	TEST_CHECK(ranges.freeRangeCount() == gaps);
+}
+
+/** Randomly allocate, release, grow, shrink, and defragment, checking the allocator against a model after every step. */
+static void Test_Fuzz()
+{
+	for (unsigned int seed = 0U; seed < 20U; ++seed) {
+		std::mt19937 random(seed);
+		Range_Allocator ranges(64ULL);
+		std::map<size_t, size_t> model;
+		for (size_t step = 0ULL; step < 2000ULL; ++step) {
+			const auto action = random() % 10U;
+			if (action < 5U) {
+				// Allocate, growing when out of room, as the engine does
+				const auto size = static_cast<size_t>(1U + (random() % 3U == 0U ? random() % 200U : random() % 16U));
+				size_t offset(0ULL);
+				if (!ranges.allocate(size, offset)) {
+					ranges.grow(std::max<size_t>(ranges.capacity() * 2ULL, ranges.capacity() + size));
+					TEST_CHECK(ranges.allocate(size, offset));
+				}
+				TEST_CHECK(offset + size <= ranges.capacity());
+				TEST_CHECK(model.emplace(offset, size).second);
+			}
+			else if (action < 8U && !model.empty()) {
+				auto spot = model.begin();
+				std::advance(spot, static_cast<std::ptrdiff_t>(random() % model.size()));
+				ranges.release(spot->first);
+				model.erase(spot);
+			}
+			else if (action < 9U) {
+				// Defragment to completion with a random size limit
+				const auto maxSize = static_cast<size_t>(random() % 64U);
+				size_t from(0ULL), to(0ULL), size(0ULL), moves(0ULL);
+				while (ranges.defragment(maxSize, from, to, size)) {
+					const auto spot = model.find(from);
+					TEST_CHECK(spot != model.end() && spot->second == size && size <= maxSize && to < from);
+					if (spot == model.end() || ++moves > 100000ULL)
+						break;
+					model.erase(spot);
+					TEST_CHECK(model.emplace(to, size).second);
+				}
+
+				// Nothing movable may be left behind: no range within the limit fits in a gap before it
+				size_t previousEnd(0ULL), largestGap(0ULL);
+				for (const auto& [offset, size] : model) {
+					TEST_CHECK(size > maxSize || size > largestGap);
+					largestGap = std::max(largestGap, offset - previousEnd);
+					previousEnd = offset + size;
+				}
+			}
+			else {
+				// Shrinking only succeeds when nothing is allocated past the new end
+				const auto capacity = ranges.capacity() / 2ULL;
+				const auto expected = capacity < ranges.capacity() && ranges.end() <= capacity;
+				TEST_CHECK(ranges.shrink(capacity) == expected);
+				TEST_CHECK(ranges.capacity() == (expected ? capacity : capacity * 2ULL + ranges.capacity() % 2ULL));
+			}
+			Check_Model(ranges, model);
+		}
+	}
+}
+
+int main()
+{
+	Test_Allocate_Release();
+	Test_Best_Fit();
+	Test_Grow_Shrink();
+	Test_Defragment();
+	Test_Defragment_Walk_Back();
+	Test_Fuzz();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "Test.h"
+#include "Utilities/IO/Skeleton_Pose.h"
+#include "glm/gtc/matrix_transform.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+
+/** Search for a node in the animation system matching the name specified, as animating used to for every node of every frame.
+	@param	pAnimation		the animation system to search through.
+	@param	NodeName		the name of the node to find.
+	@return					pointer to the node matching the name specified if found, nullptr otherwise. */
+static const Node_Animation* Find_Node_Anim(const Animation& pAnimation, const std::string& NodeName)
+{
+	for (auto& pNodeAnim : pAnimation.channels)
+		if (pNodeAnim.nodeName == NodeName)
+			return &pNodeAnim;
+	return nullptr;
+}
+
+/** Search for a key-frame appropriate for the current animation time, scanning from the first key-frame. */
+template <typename Keys>
+static size_t Find_Key(const float& AnimationTime, const size_t& count, const Keys& keyVector)
+{
+	for (size_t i = 0; i < count; i++)
+		if (AnimationTime < static_cast<float>((keyVector[i + 1]).time))
+			return i;
+	return 0ULL;
+}
+
+/** Interpolate between this key-frame, and the next one, based on the animation time. */
+template <typename Keys>
+static auto Interpolate_Keys(const float& AnimationTime, const Keys& keyVector)
+{
+	const size_t& keyCount = keyVector.size();
+	const auto& Result = keyVector[0].value;
+	if (keyCount > 1) {
+		const size_t Index = Find_Key(AnimationTime, keyCount - 1, keyVector);
+		const size_t NextIndex = (Index + 1) > keyCount ? 0 : (Index + 1);
+		const auto& Key = keyVector[Index];
+		const auto& NextKey = keyVector[NextIndex];
+		const float DeltaTime = static_cast<float>(NextKey.time - Key.time);
+		const float Factor = glm::clamp((AnimationTime - static_cast<float>(Key.time)) / DeltaTime, 0.0f, 1.0f);
+		if constexpr (std::is_same<typename std::decay<decltype(Key.value)>::type, glm::quat>::value)
+			return glm::slerp(Key.value, NextKey.value, Factor);
+		else
+			return glm::mix(Key.value, NextKey.value, Factor);
+	}
+	return Result;
+}
+
+/** Pose a skeleton the way it was before it was bound, walking the node tree and looking up channels and bones by name.
+Kept as the reference the bound skeleton must match. */
+static void Read_Node_Heirarchy(std::vector<glm::mat4>& transforms, const float& AnimationTime, const size_t& animation_ID, const Node& parentNode, const Mesh_Geometry& geometry, const glm::mat4& ParentTransform)
+{
+	const std::string& NodeName = parentNode.name;
+	const Animation& pAnimation = geometry.animations[animation_ID];
+	glm::mat4 NodeTransformation = parentNode.transformation;
+
+	if (const auto* pNodeAnim = Find_Node_Anim(pAnimation, NodeName)) {
+		const glm::vec3 Scaling = Interpolate_Keys(AnimationTime, pNodeAnim->scalingKeys);
+		const glm::quat Rotation = Interpolate_Keys(AnimationTime, pNodeAnim->rotationKeys);
+		const glm::vec3 Translation = Interpolate_Keys(AnimationTime, pNodeAnim->positionKeys);
+		NodeTransformation = glm::translate(glm::mat4(1.0F), Translation) * glm::mat4_cast(Rotation) * glm::scale(glm::mat4(1.0F), Scaling);
+	}
+
+	const glm::mat4 GlobalTransformation = ParentTransform * NodeTransformation;
+	const glm::mat4 GlobalInverseTransform = glm::inverse(geometry.rootNode.transformation);
+	const std::map<std::string, size_t>& BoneMap = geometry.boneMap;
+	if (BoneMap.find(NodeName) != BoneMap.end()) {
+		const size_t BoneIndex = BoneMap.at(NodeName);
+		transforms.at(BoneIndex) = GlobalInverseTransform * GlobalTransformation * geometry.boneTransforms.at(BoneIndex);
+	}
+
+	for (const auto& childNode : parentNode.children)
+		Read_Node_Heirarchy(transforms, AnimationTime, animation_ID, childNode, geometry, GlobalTransformation);
+}
+
+/** Make a random unit quaternion. */
+static glm::quat Random_Rotation(std::mt19937& random)
+{
+	std::normal_distribution<float> normal;
+	const glm::quat q(normal(random), normal(random), normal(random), normal(random));
+	const auto length = std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+	return glm::quat(q.w / length, q.x / length, q.y / length, q.z / length);
+}
+
+/** Make a random rigid transformation. */
+static glm::mat4 Random_Transform(std::mt19937& random)
+{
+	std::uniform_real_distribution<float> offset(-2.0F, 2.0F);
+	return glm::translate(glm::mat4(1.0F), glm::vec3(offset(random), offset(random), offset(random))) * glm::mat4_cast(Random_Rotation(random));
+}
+
+/** Make a list of key-frames spanning an animation, with the given number of keys. */
+template <typename T, typename Generator>
+static std::vector<Animation_Time_Key<T>> Random_Keys(std::mt19937& random, const size_t& count, const double& duration, Generator&& generator)
+{
+	std::vector<Animation_Time_Key<T>> keys(count);
+	for (size_t k = 0ULL; k < count; ++k) {
+		keys[k].time = count > 1ULL ? duration * static_cast<double>(k) / static_cast<double>(count - 1ULL) : 0.0;
+		keys[k].value = generator(random);
+	}
+	return keys;
+}
+
+/** Add children to a node until the tree holds the requested number of nodes. */
+static void Grow_Tree(std::mt19937& random, Node& root, const size_t& nodeCount)
+{
+	std::vector<Node*> nodes{ &root };
+	nodes.reserve(nodeCount);
+	root.name = "Node_0";
+	root.transformation = Random_Transform(random);
+	// Grow breadth-first, giving each node up to 3 children, so no node moves once pointed to
+	for (size_t x = 0ULL; x < nodes.size() && nodes.size() < nodeCount; ++x) {
+		const auto childCount = std::min<size_t>(1ULL + random() % 3U, nodeCount - nodes.size());
+		nodes[x]->children.resize(childCount);
+		for (auto& child : nodes[x]->children) {
+			child.name = "Node_" + std::to_string(nodes.size());
+			child.transformation = Random_Transform(random);
+			nodes.push_back(&child);
+		}
+	}
+}
+
+/** Make a model with a random skeleton, bones on most of its nodes, and a few animations over most of them. */
+static Mesh_Geometry Make_Model(std::mt19937& random, const size_t& nodeCount, const size_t& animationCount)
+{
+	Mesh_Geometry geometry;
+	Grow_Tree(random, geometry.rootNode, nodeCount);
+	for (size_t x = 0ULL; x < nodeCount; ++x)
+		if (random() % 4U != 0U) {
+			geometry.boneMap["Node_" + std::to_string(x)] = geometry.boneTransforms.size();
+			geometry.boneTransforms.push_back(Random_Transform(random));
+		}
+
+	std::uniform_real_distribution<float> position(-1.0F, 1.0F), scale(0.5F, 1.5F);
+	for (size_t a = 0ULL; a < animationCount; ++a) {
+		Animation animation;
+		animation.duration = 10.0 + static_cast<double>(a) * 7.0;
+		animation.ticksPerSecond = 25.0;
+		for (size_t x = 0ULL; x < nodeCount; ++x) {
+			if (random() % 5U == 0U)
+				continue;
+			Node_Animation channel;
+			channel.nodeName = "Node_" + std::to_string(x);
+			channel.scalingKeys = Random_Keys<glm::vec3>(random, 1ULL + random() % 4U, animation.duration, [&](std::mt19937& r) { return glm::vec3(scale(r), scale(r), scale(r)); });
+			channel.rotationKeys = Random_Keys<glm::quat>(random, 1ULL + random() % 12U, animation.duration, Random_Rotation);
+			channel.positionKeys = Random_Keys<glm::vec3>(random, 1ULL + random() % 8U, animation.duration, [&](std::mt19937& r) { return glm::vec3(position(r), position(r), position(r)); });
+			animation.channels.push_back(std::move(channel));
+		}
+		// Channels needn't be in node order
+		std::shuffle(animation.channels.begin(), animation.channels.end(), random);
+		animation.numChannels = static_cast<unsigned int>(animation.channels.size());
+		geometry.animations.push_back(std::move(animation));
+	}
+	Skeleton_Pose::Bind(geometry);
+	return geometry;
+}
+
+/** Retrieve the largest difference between two sets of bone transforms, relative to their size. */
+static float Max_Error(const std::vector<glm::mat4>& expected, const std::vector<glm::mat4>& actual)
+{
+	float error = 0.0F;
+	for (size_t b = 0ULL; b < expected.size(); ++b)
+		for (int c = 0; c < 4; ++c)
+			for (int r = 0; r < 4; ++r)
+				error = std::max(error, std::abs(expected[b][c][r] - actual[b][c][r]) / (1.0F + std::abs(expected[b][c][r])));
+	return error;
+}
+
+/** Check that a bound skeleton poses exactly as walking its node tree by name did, as time moves forward, loops, jumps and switches animation. */
+static void Test_Matches()
+{
+	std::mt19937 random(31U);
+	for (int model = 0; model < 8; ++model) {
+		const auto geometry = Make_Model(random, 8ULL + random() % 120U, 2ULL);
+		TEST_CHECK(geometry.skeleton.parents.size() == geometry.skeleton.bones.size());
+		TEST_CHECK(geometry.skeleton.channels.size() == geometry.animations.size());
+
+		std::vector<glm::mat4> transforms(geometry.boneTransforms.size()), expected(geometry.boneTransforms.size()), globals;
+		std::vector<size_t> keyCursors;
+		float time = 0.0F;
+		for (int frame = 0; frame < 400; ++frame) {
+			const auto animation_ID = static_cast<size_t>(frame / 150) % geometry.animations.size();
+			const auto duration = static_cast<float>(geometry.animations[animation_ID].duration);
+			// Mostly play forward, but occasionally jump somewhere else
+			time = (frame % 37 == 36)
+				? std::uniform_real_distribution<float>(0.0F, duration)(random)
+				: std::fmod(time + std::uniform_real_distribution<float>(0.0F, 0.8F)(random), duration);
+
+			Skeleton_Pose::Animate(transforms, keyCursors, globals, time, animation_ID, geometry);
+			Read_Node_Heirarchy(expected, time, animation_ID, geometry.rootNode, geometry, glm::mat4(1.0F));
+			TEST_CHECK(Max_Error(expected, transforms) < 1e-4F);
+		}
+	}
+}
+
+/** Compare the time taken to animate many skeletons with the bound skeleton, against walking the node tree by name. */
+static void Test_Throughput()
+{
+	std::mt19937 random(32U);
+	const auto geometry = Make_Model(random, 96ULL, 1ULL);
+	constexpr size_t skeletonCount = 1000ULL;
+	constexpr int frameCount = 30;
+	const auto duration = static_cast<float>(geometry.animations[0].duration);
+	std::vector<float> offsets(skeletonCount);
+	for (auto& offset : offsets)
+		offset = std::uniform_real_distribution<float>(0.0F, duration)(random);
+
+	std::vector<std::vector<glm::mat4>> transforms(skeletonCount, std::vector<glm::mat4>(geometry.boneTransforms.size()));
+	std::vector<std::vector<size_t>> keyCursors(skeletonCount);
+	std::vector<glm::mat4> globals, expected(geometry.boneTransforms.size());
+	const auto start = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frameCount; ++frame)
+		for (size_t s = 0ULL; s < skeletonCount; ++s)
+			Skeleton_Pose::Animate(transforms[s], keyCursors[s], globals, std::fmod(offsets[s] + static_cast<float>(frame) * 0.6F, duration), 0ULL, geometry);
+	const auto middle = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frameCount; ++frame)
+		for (size_t s = 0ULL; s < skeletonCount; ++s)
+			Read_Node_Heirarchy(expected, std::fmod(offsets[s] + static_cast<float>(frame) * 0.6F, duration), 0ULL, geometry.rootNode, geometry, glm::mat4(1.0F));
+	const auto end = std::chrono::steady_clock::now();
+
+	// The last skeleton posed by both should agree
+	TEST_CHECK(Max_Error(expected, transforms.back()) < 1e-4F);
+	const auto boundTime = std::chrono::duration<double, std::micro>(middle - start).count() / static_cast<double>(skeletonCount * frameCount);
+	const auto namedTime = std::chrono::duration<double, std::micro>(end - middle).count() / static_cast<double>(skeletonCount * frameCount);
+	std::printf("%zu skeletons of %zu nodes, %zu bones: bound %.2f us, by name %.2f us per skeleton per frame (%.1fx)\n",
+		skeletonCount, geometry.skeleton.parents.size(), geometry.boneTransforms.size(), boundTime, namedTime, namedTime / boundTime);
+}
+
+int main()
+{
+	Test_Matches();
+	Test_Throughput();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#ifndef TEST_H
+#define TEST_H
+
+#include <cstdio>
+
+
+/** Number of checks which failed so far in this test. */
+inline int Test_Failures = 0;
+
+/** Check a condition, reporting where it failed without stopping the test. */
+#define TEST_CHECK(...) \
+	do { \
+		if (!(__VA_ARGS__)) { \
+			++Test_Failures; \
+			std::fprintf(stderr, "%s(%d): check failed: %s\n", __FILE__, __LINE__, #__VA_ARGS__); \
+		} \
+	} while (false)
+
+/** Retrieve the exit code for this test, reporting the number of failed checks.
+@return				0 if every check passed, 1 otherwise. */
+inline int Test_Result()
+{
+	if (Test_Failures == 0)
+		return 0;
+	std::fprintf(stderr, "%d check(s) failed\n", Test_Failures);
+	return 1;
+}
+
+#endif // TEST_H
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef TEST_COMPONENTS_H
+#define TEST_COMPONENTS_H
+
+#include "Modules/ECS/ecsComponent.h"
+
+
+inline constexpr char testPositionName[] = "Test_Position_Component";
+/** Test component holding a position. */
+struct Test_Position_Component final : public ecsComponent<Test_Position_Component, testPositionName> {
+	float m_position[3] = { 0.0F, 0.0F, 0.0F };
+};
+
+inline constexpr char testVelocityName[] = "Test_Velocity_Component";
+/** Test component holding a velocity. */
+struct Test_Velocity_Component final : public ecsComponent<Test_Velocity_Component, testVelocityName> {
+	float m_velocity[3] = { 0.0F, 0.0F, 0.0F };
+};
+
+inline constexpr char testEnergyName[] = "Test_Energy_Component";
+/** Test component accumulating a value over time. */
+struct Test_Energy_Component final : public ecsComponent<Test_Energy_Component, testEnergyName> {
+	float m_energy = 0.0F;
+};
+
+inline constexpr char testRecordName[] = "Test_Record_Component";
+/** Test component with serialized fields. */
+struct Test_Record_Component final : public ecsComponent<Test_Record_Component, testRecordName> {
+	float m_value = 0.0F, m_weight = 1.0F;
+	int m_count = 0;
+
+	inline std::vector<char> serialize() {
+		return Serializer::Serialize_Set(
+			std::pair("m_value", m_value),
+			std::pair("m_weight", m_weight),
+			std::pair("m_count", m_count)
+		);
+	}
+	inline void deserialize(const Serial_Data& data) {
+		Serializer::Deserialize_Set(data,
+			std::pair("m_value", &m_value),
+			std::pair("m_weight", &m_weight),
+			std::pair("m_count", &m_count)
+		);
+	}
+};
+
+#endif // TEST_COMPONENTS_H
\ No newline at end of file
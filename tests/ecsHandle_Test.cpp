@@ -0,0 +1,70 @@
+#include "Test.h"
+#include "Modules/ECS/ecsHandleIndex.h"
+#include <cstring>
+#include <map>
+#include <random>
+
+
+/** Check that handles round-trip through hex, and order the same way their hex characters do. */
+static void Test_Hex()
+{
+	const char id[32] = { '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f','F','E','D','C','B','A','9','8','7','6','5','4','3','2','1','0' };
+	const ecsHandle handle(id);
+	TEST_CHECK(handle.m_uuid.m_high == 0x0123456789ABCDEFULL);
+	TEST_CHECK(handle.m_uuid.m_low == 0xFEDCBA9876543210ULL);
+	char hex[32];
+	handle.toHex(hex);
+	TEST_CHECK(std::memcmp(hex, "0123456789abcdeffedcba9876543210", 32ULL) == 0);
+	TEST_CHECK(ecsHandle(hex) == handle);
+	TEST_CHECK(!ecsHandle().isValid());
+	TEST_CHECK(handle.isValid());
+
+	std::mt19937_64 generator(7ULL);
+	for (int i = 0; i < 1000; ++i) {
+		const ecsHandle a(ecsBinaryHandle{ generator() >> (generator() % 64ULL), generator() }), b(ecsBinaryHandle{ generator() >> (generator() % 64ULL), generator() });
+		char hexA[32], hexB[32];
+		a.toHex(hexA);
+		b.toHex(hexB);
+		TEST_CHECK((a < b) == (std::memcmp(hexA, hexB, 32ULL) < 0));
+		TEST_CHECK(ecsHandle(hexA) == a);
+	}
+}
+
+/** Check the handle index against a map under random inserts, overwrites, and erasures. */
+static void Test_Index()
+{
+	std::mt19937_64 generator(11ULL);
+	ecsHandleIndex<int> index;
+	std::map<ecsHandle, int> model;
+	std::vector<ecsHandle> handles;
+	for (int i = 0; i < 512; ++i)
+		handles.emplace_back(ecsBinaryHandle{ generator() % 4ULL, generator() });
+	for (int step = 0; step < 20000; ++step) {
+		const auto& handle = handles[generator() % handles.size()];
+		if (generator() % 3ULL == 0ULL) {
+			TEST_CHECK(index.erase(handle) == (model.erase(handle) != 0ULL));
+		}
+		else {
+			const auto value = static_cast<int>(generator() % 1000ULL);
+			index.insertOrAssign(handle, value);
+			model.insert_or_assign(handle, value);
+		}
+		if (step % 500 == 0)
+			index.reserve(model.size() * 2ULL);
+		TEST_CHECK(index.size() == model.size());
+	}
+	for (const auto& handle : handles) {
+		const auto* value = index.find(handle);
+		const auto found = model.find(handle);
+		TEST_CHECK((value != nullptr) == (found != model.cend()));
+		if (value != nullptr && found != model.cend())
+			TEST_CHECK(*value == found->second);
+	}
+}
+
+int main()
+{
+	Test_Hex();
+	Test_Index();
+	return Test_Result();
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "Test.h"
+#include "Test_Components.h"
+#include "Modules/ECS/ecsWorld.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+
+/** The query used throughout, matching every entity with a position. */
+static const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>> Query_Types = {
+	{ Test_Position_Component::Runtime_ID, ecsBaseSystem::RequirementsFlag::FLAG_REQUIRED },
+	{ Test_Velocity_Component::Runtime_ID, ecsBaseSystem::RequirementsFlag::FLAG_OPTIONAL },
+	{ Test_Energy_Component::Runtime_ID, ecsBaseSystem::RequirementsFlag::FLAG_OPTIONAL }
+};
+
+/** Retrieve the query's rows, sorted for comparison.
+@param	world		the world to query.
+@return				the sorted rows. */
+static std::vector<std::vector<ecsBaseComponent*>> Query_Rows(ecsWorld& world)
+{
+	std::vector<std::vector<ecsBaseComponent*>> rows;
+	world.updateSystem(0.0F, Query_Types, [&rows](const float&, const std::vector<std::vector<ecsBaseComponent*>>& components) { rows = components; });
+	std::sort(rows.begin(), rows.end());
+	return rows;
+}
+
+/** Retrieve the rows the query should hold, looking every entity up on its own.
+@param	world		the world to search.
+@param	entities	every entity in the world.
+@return				the sorted rows. */
+static std::vector<std::vector<ecsBaseComponent*>> Expected_Rows(ecsWorld& world, const std::vector<EntityHandle>& entities)
+{
+	std::vector<std::vector<ecsBaseComponent*>> rows;
+	for (const auto& entity : entities)
+		if (auto* position = world.getComponent<Test_Position_Component>(entity))
+			rows.push_back({ position, world.getComponent<Test_Velocity_Component>(entity), world.getComponent<Test_Energy_Component>(entity) });
+	std::sort(rows.begin(), rows.end());
+	return rows;
+}
+
+/** Refresh the query, measuring how long it took.
+@param	world		the world to query.
+@return				the time taken, in milliseconds. */
+static double Refresh_Time(ecsWorld& world)
+{
+	const auto start = std::chrono::steady_clock::now();
+	world.updateSystem(0.0F, Query_Types, [](const float&, const std::vector<std::vector<ecsBaseComponent*>>&) {});
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/** Add an entity holding some of the test components.
+@param	world		the world to add to.
+@param	mix			bit 0 adds a position, bit 1 a velocity, bit 2 an energy.
+@return				handle to the new entity. */
+static EntityHandle Add_Entity(ecsWorld& world, const unsigned int& mix)
+{
+	Test_Position_Component position;
+	Test_Velocity_Component velocity;
+	Test_Energy_Component energy;
+	std::vector<const ecsBaseComponent*> components;
+	if ((mix & 1U) != 0U)
+		components.push_back(&position);
+	if ((mix & 2U) != 0U)
+		components.push_back(&velocity);
+	if ((mix & 4U) != 0U)
+		components.push_back(&energy);
+	EntityHandle handle;
+	world.makeEntity(components.data(), components.size(), "Entity", handle, EntityHandle());
+	return handle;
+}
+
+/** Check that a query over 100k entities only rewrites the rows of the archetype that changed. */
+static void Test_Large_World()
+{
+	ecsWorld world;
+	world.reserve(100000ULL, 200000ULL);
+	std::vector<EntityHandle> entities;
+	entities.reserve(100000ULL);
+	for (size_t x = 0ULL; x < 10ULL; ++x)
+		entities.push_back(Add_Entity(world, 7U));
+	for (size_t x = 0ULL; x < 39990ULL; ++x)
+		entities.push_back(Add_Entity(world, 3U));
+	for (size_t x = 0ULL; x < 60000ULL; ++x)
+		entities.push_back(Add_Entity(world, 1U));
+
+	// The first refresh writes every row
+	const auto fullTime = Refresh_Time(world);
+	TEST_CHECK(world.getQueryStatistics().m_rewrittenRows == 100000ULL);
+	TEST_CHECK(Query_Rows(world) == Expected_Rows(world, entities));
+
+	// Changing the smallest archetype, whose span comes first, shifts the others without rewriting them
+	world.resetQueryStatistics();
+	entities.push_back(Add_Entity(world, 7U));
+	world.removeEntity(entities[3]);
+	entities.erase(entities.begin() + 3);
+	entities.push_back(Add_Entity(world, 7U));
+	const auto partialTime = Refresh_Time(world);
+	TEST_CHECK(world.getQueryStatistics().m_rebuilds == 1ULL);
+	TEST_CHECK(world.getQueryStatistics().m_rewrittenRows == 11ULL);
+	const auto rows = Query_Rows(world);
+	TEST_CHECK(rows.size() == 100001ULL);
+	TEST_CHECK(rows == Expected_Rows(world, entities));
+
+	// The changed archetype's span now comes last, so changing it again shifts nothing
+	world.resetQueryStatistics();
+	world.removeEntity(entities.back());
+	entities.pop_back();
+	const auto repeatTime = Refresh_Time(world);
+	TEST_CHECK(world.getQueryStatistics().m_rewrittenRows == 10ULL);
+	TEST_CHECK(Query_Rows(world) == Expected_Rows(world, entities));
+
+	// Nothing changed, nothing is rewritten
+	world.resetQueryStatistics();
+	Refresh_Time(world);
+	TEST_CHECK(world.getQueryStatistics().m_hits == 1ULL && world.getQueryStatistics().m_rewrittenRows == 0ULL);
+	std::printf("100k entity query refresh: %.3f ms writing every row, %.3f ms after one archetype changed, %.3f ms after it changed again\n", fullTime, partialTime, repeatTime);
+}
+
+/** Check the query against a lookup of every entity, while entities and components come and go at random. */
+static void Test_Random_Changes()
+{
+	std::mt19937 random(99U);
+	ecsWorld world;
+	std::vector<EntityHandle> entities;
+	for (size_t x = 0ULL; x < 2000ULL; ++x)
+		entities.push_back(Add_Entity(world, 1U + random() % 7U));
+	TEST_CHECK(Query_Rows(world) == Expected_Rows(world, entities));
+	for (size_t frame = 0ULL; frame < 200ULL; ++frame) {
+		const auto changes = 1U + random() % 20U;
+		for (unsigned int x = 0U; x < changes; ++x) {
+			const auto action = random() % 4U;
+			const auto index = random() % entities.size();
+			if (action == 0U)
+				entities.push_back(Add_Entity(world, 1U + random() % 7U));
+			else if (action == 1U && entities.size() > 1ULL) {
+				world.removeEntity(entities[index]);
+				entities.erase(entities.begin() + static_cast<std::ptrdiff_t>(index));
+			}
+			else if (action == 2U) {
+				// Moves the entity to another archetype
+				if (world.getComponent<Test_Velocity_Component>(entities[index]) != nullptr)
+					world.removeEntityComponent(entities[index], Test_Velocity_Component::Runtime_ID);
+				else {
+					Test_Velocity_Component velocity;
+					ComponentHandle handle;
+					world.makeComponent(entities[index], &velocity, handle);
+				}
+			}
+		}
+		// Refresh only some frames, so changes pile up across several archetypes
+		if (random() % 3U != 0U)
+			TEST_CHECK(Query_Rows(world) == Expected_Rows(world, entities));
+	}
+}
+
+int main()
+{
+	Test_Large_World();
+	Test_Random_Changes();
+	return Test_Result();
+}
@@ -0,0 +1,190 @@
+#include "Test.h"
+#include "Test_Components.h"
+#include "Modules/ECS/ecsScheduler.h"
+#include "Modules/ECS/ecsWorld.h"
+#include <cstring>
+#include <random>
+
+
+/** Concurrent system moving positions by their velocities, split into chunks. */
+class Integrate_System final : public ecsBaseSystem {
+public:
+	inline const char* getName() const noexcept final { return "Integrate_System"; }
+	inline Integrate_System() {
+		addComponentType(Test_Position_Component::Runtime_ID, RequirementsFlag::FLAG_REQUIRED, AccessFlag::ACCESS_READ_WRITE);
+		addComponentType(Test_Velocity_Component::Runtime_ID, RequirementsFlag::FLAG_REQUIRED, AccessFlag::ACCESS_READ_ONLY);
+		setConcurrent(true, 37ULL);
+	}
+	inline void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final {
+		updateComponentRange(deltaTime, components, 0ULL, components.size());
+	}
+	inline void updateComponentRange(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components, const size_t& begin, const size_t& end) final {
+		for (auto x = begin; x < end; ++x) {
+			auto* position = static_cast<Test_Position_Component*>(components[x][0]);
+			const auto* velocity = static_cast<Test_Velocity_Component*>(components[x][1]);
+			for (int axis = 0; axis < 3; ++axis)
+				position->m_position[axis] += velocity->m_velocity[axis] * deltaTime;
+		}
+	}
+};
+
+/** Concurrent system damping velocities, conflicting with the integrate system. */
+class Damp_System final : public ecsBaseSystem {
+public:
+	inline const char* getName() const noexcept final { return "Damp_System"; }
+	inline Damp_System() {
+		addComponentType(Test_Velocity_Component::Runtime_ID);
+		setConcurrent(true, 64ULL);
+	}
+	inline void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final {
+		updateComponentRange(deltaTime, components, 0ULL, components.size());
+	}
+	inline void updateComponentRange(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components, const size_t& begin, const size_t& end) final {
+		for (auto x = begin; x < end; ++x) {
+			auto* velocity = static_cast<Test_Velocity_Component*>(components[x][0]);
+			for (auto& axis : velocity->m_velocity)
+				axis *= 1.0F - (0.1F * deltaTime);
+		}
+	}
+};
+
+/** Concurrent, unsplit system accumulating every position's distance into its energy, where the order of additions matters. */
+class Energy_System final : public ecsBaseSystem {
+public:
+	inline const char* getName() const noexcept final { return "Energy_System"; }
+	inline Energy_System() {
+		addComponentType(Test_Position_Component::Runtime_ID, RequirementsFlag::FLAG_REQUIRED, AccessFlag::ACCESS_READ_ONLY);
+		addComponentType(Test_Energy_Component::Runtime_ID);
+		setConcurrent(true);
+	}
+	inline void updateComponents(const float&, const std::vector<std::vector<ecsBaseComponent*>>& components) final {
+		float running(0.0F);
+		for (const auto& componentParam : components) {
+			const auto* position = static_cast<Test_Position_Component*>(componentParam[0]);
+			auto* energy = static_cast<Test_Energy_Component*>(componentParam[1]);
+			running += position->m_position[0] * 0.001F + position->m_position[1] * position->m_position[2];
+			energy->m_energy += running;
+		}
+	}
+};
+
+/** Non-concurrent system acting as a barrier, feeding energy back into velocities. */
+class Feedback_System final : public ecsBaseSystem {
+public:
+	inline const char* getName() const noexcept final { return "Feedback_System"; }
+	inline Feedback_System() {
+		addComponentType(Test_Velocity_Component::Runtime_ID);
+		addComponentType(Test_Energy_Component::Runtime_ID, RequirementsFlag::FLAG_OPTIONAL, AccessFlag::ACCESS_READ_ONLY);
+	}
+	inline void updateComponents(const float& deltaTime, const std::vector<std::vector<ecsBaseComponent*>>& components) final {
+		for (const auto& componentParam : components) {
+			auto* velocity = static_cast<Test_Velocity_Component*>(componentParam[0]);
+			if (const auto* energy = static_cast<Test_Energy_Component*>(componentParam[1]))
+				velocity->m_velocity[1] += (energy->m_energy * 1e-6F) * deltaTime;
+		}
+	}
+};
+
+/** A world built and edited by a seeded sequence, so two worlds given the same seed hold the same components in the same order. */
+struct Test_World {
+	ecsWorld m_world;
+	std::vector<EntityHandle> m_entities;
+	std::mt19937 m_random;
+
+	inline explicit Test_World(const unsigned int& seed) : m_random(seed) {}
+	/** Add an entity with a random mix of components. */
+	inline void addEntity() {
+		Test_Position_Component position;
+		Test_Velocity_Component velocity;
+		Test_Energy_Component energy;
+		for (int axis = 0; axis < 3; ++axis) {
+			position.m_position[axis] = static_cast<float>(m_random() % 2000U) * 0.01F - 10.0F;
+			velocity.m_velocity[axis] = static_cast<float>(m_random() % 2000U) * 0.001F - 1.0F;
+		}
+		const auto mix = m_random() % 4U;
+		std::vector<const ecsBaseComponent*> components = { &position };
+		if (mix != 0U)
+			components.push_back(&velocity);
+		if (mix >= 2U)
+			components.push_back(&energy);
+		EntityHandle handle;
+		m_world.makeEntity(components.data(), components.size(), "Entity", handle, EntityHandle());
+		m_entities.push_back(handle);
+	}
+	/** Remove a random entity. */
+	inline void removeEntity() {
+		const auto index = m_random() % m_entities.size();
+		m_world.removeEntity(m_entities[index]);
+		m_entities.erase(m_entities.begin() + static_cast<std::ptrdiff_t>(index));
+	}
+};
+
+/** Check that every component of two worlds holds the exact same bits. */
+static bool Same_Bits(ecsWorld& a, ecsWorld& b)
+{
+	const std::vector<std::pair<ComponentID, ecsBaseSystem::RequirementsFlag>> componentTypes = {
+		{ Test_Position_Component::Runtime_ID, ecsBaseSystem::RequirementsFlag::FLAG_REQUIRED },
+		{ Test_Velocity_Component::Runtime_ID, ecsBaseSystem::RequirementsFlag::FLAG_OPTIONAL },
+		{ Test_Energy_Component::Runtime_ID, ecsBaseSystem::RequirementsFlag::FLAG_OPTIONAL }
+	};
+	std::vector<std::vector<ecsBaseComponent*>> componentsA, componentsB;
+	a.updateSystem(0.0F, componentTypes, [&componentsA](const float&, const std::vector<std::vector<ecsBaseComponent*>>& components) { componentsA = components; });
+	b.updateSystem(0.0F, componentTypes, [&componentsB](const float&, const std::vector<std::vector<ecsBaseComponent*>>& components) { componentsB = components; });
+	if (componentsA.size() != componentsB.size())
+		return false;
+	for (size_t x = 0ULL; x < componentsA.size(); ++x) {
+		const auto* positionA = static_cast<Test_Position_Component*>(componentsA[x][0]);
+		const auto* positionB = static_cast<Test_Position_Component*>(componentsB[x][0]);
+		if (std::memcmp(positionA->m_position, positionB->m_position, sizeof(positionA->m_position)) != 0)
+			return false;
+		const auto* velocityA = static_cast<Test_Velocity_Component*>(componentsA[x][1]);
+		const auto* velocityB = static_cast<Test_Velocity_Component*>(componentsB[x][1]);
+		if ((velocityA == nullptr) != (velocityB == nullptr) || (velocityA != nullptr && std::memcmp(velocityA->m_velocity, velocityB->m_velocity, sizeof(velocityA->m_velocity)) != 0))
+			return false;
+		const auto* energyA = static_cast<Test_Energy_Component*>(componentsA[x][2]);
+		const auto* energyB = static_cast<Test_Energy_Component*>(componentsB[x][2]);
+		if ((energyA == nullptr) != (energyB == nullptr) || (energyA != nullptr && std::memcmp(&energyA->m_energy, &energyB->m_energy, sizeof(float)) != 0))
+			return false;
+	}
+	return true;
+}
+
+/** Check that scheduled updates match a serial update bit for bit, for several thread counts, while entities come and go. */
+static void Test_Determinism()
+{
+	ecsSystemList systems;
+	systems.makeSystem<Integrate_System>();
+	systems.makeSystem<Damp_System>();
+	systems.makeSystem<Energy_System>();
+	systems.makeSystem<Feedback_System>();
+	systems.makeSystem<Integrate_System>();
+	systems.makeSystem<Energy_System>();
+	TEST_CHECK(systems.size() == 6ULL);
+
+	for (const size_t threadCount : { 0ULL, 1ULL, 3ULL, 8ULL }) {
+		ecsScheduler scheduler(threadCount);
+		Test_World serial(7U), scheduled(7U);
+		for (size_t x = 0ULL; x < 2000ULL; ++x) {
+			serial.addEntity();
+			scheduled.addEntity();
+		}
+		for (size_t frame = 0ULL; frame < 50ULL; ++frame) {
+			constexpr float deltaTime = 1.0F / 60.0F;
+			serial.m_world.updateSystems(systems, deltaTime);
+			scheduled.m_world.updateSystems(systems, deltaTime, scheduler);
+			for (size_t x = 0ULL; x < 20ULL; ++x) {
+				serial.removeEntity();
+				scheduled.removeEntity();
+				serial.addEntity();
+				scheduled.addEntity();
+			}
+		}
+		TEST_CHECK(Same_Bits(serial.m_world, scheduled.m_world));
+	}
+}
+
+int main()
+{
+	Test_Determinism();
+	return Test_Result();
+}
\ No newline at end of file